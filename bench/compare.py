@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Compara dos corridas JSON de core_numeric_bench y falla si alguna empeora.
+
+Uso: compare.py base.json nueva.json [--threshold 5]
+
+Sale con codigo 1 si algun caso es mas lento que la base por encima del
+umbral (en porcentaje), para usarlo como paso de CI de rendimiento.
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {b["name"]: b for b in data["benchmarks"] if b.get("run_type", "iteration") == "iteration"}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("base")
+    parser.add_argument("contender")
+    parser.add_argument("--threshold", type=float, default=5.0, help="porcentaje de regresion tolerado")
+    args = parser.parse_args()
+
+    base = load(args.base)
+    new = load(args.contender)
+    regressions = 0
+
+    print(f"{'benchmark':60} {'base':>12} {'nuevo':>12} {'cambio':>8}")
+    for name in sorted(base.keys() & new.keys()):
+        a = base[name]["real_time"]
+        b = new[name]["real_time"]
+        change = (b - a) / a * 100.0 if a else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = "  REGRESION"
+            regressions += 1
+        print(f"{name:60} {a:12.1f} {b:12.1f} {change:+7.1f}%{mark}")
+
+    for name in sorted(base.keys() - new.keys()):
+        print(f"{name:60} falta en la corrida nueva")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,562 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <list>
+#include <map>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+
+// Banco de pruebas de core_numeric. Cada caso reporta bytes_per_second (GB/s)
+// e items_per_second (elementos/s). Los tamanos van de 1K a 1G elementos; el
+// tope por defecto es 2^24 para no agotar la memoria y se sube con
+// CORE_NUMERIC_BENCH_MAX_ELEMS (por ejemplo 1073741824).
+//
+// Comparacion de regresiones: guardar una corrida con
+//   core_numeric_bench --benchmark_out=base.json --benchmark_out_format=json
+// y compararla con otra mediante bench/compare.py base.json nueva.json.
+
+namespace {
+
+    std::size_t max_elems() {
+        if (const char* env = std::getenv("CORE_NUMERIC_BENCH_MAX_ELEMS"))
+            return std::strtoull(env, nullptr, 10);
+        return std::size_t{1} << 24;
+    }
+
+    template<typename T>
+    std::vector<T> make_data(std::size_t n) {
+        std::mt19937_64 g(42);
+        std::vector<T> v(n);
+        if constexpr (core_numeric::HalfFloat<T>) {
+            std::uniform_real_distribution<float> d(-1000.0f, 1000.0f);
+            for (auto& x : v) x = T(d(g));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            std::uniform_real_distribution<T> d(T(-1000), T(1000));
+            for (auto& x : v) x = d(g);
+        } else {
+            std::uniform_int_distribution<T> d(-1000, 1000);
+            for (auto& x : v) x = d(g);
+        }
+        return v;
+    }
+
+    template<typename C>
+    C make_container(std::size_t n) {
+        auto v = make_data<typename C::value_type>(n);
+        return C(v.begin(), v.end());
+    }
+
+    template<typename C>
+    void report(benchmark::State& state, std::size_t n) {
+        const auto items = static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(n);
+        state.SetItemsProcessed(items);
+        state.SetBytesProcessed(items * static_cast<std::int64_t>(sizeof(typename C::value_type)));
+        state.counters["isa"] = static_cast<double>(core_numeric::simd::active());
+    }
+
+    template<typename C, typename F>
+    void run(benchmark::State& state, F f) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const C data = make_container<C>(n);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(data));
+        report<C>(state, n);
+    }
+
+    // Una familia por funcion; C fija tipo de elemento y disposicion en memoria.
+    template<typename C> void BM_sum(benchmark::State& s)      { run<C>(s, [](const C& c) { return core_numeric::sum(c); }); }
+    template<typename C> void BM_mean(benchmark::State& s)     { run<C>(s, [](const C& c) { return core_numeric::mean(c); }); }
+    template<typename C> void BM_variance(benchmark::State& s) { run<C>(s, [](const C& c) { return core_numeric::variance(c); }); }
+    template<typename C> void BM_max(benchmark::State& s)      { run<C>(s, [](const C& c) { return core_numeric::max(c); }); }
+    template<typename C> void BM_moments(benchmark::State& s)  { run<C>(s, [](const C& c) { return core_numeric::moments(c).m2; }); }
+
+    template<typename C>
+    void BM_transform_reduce(benchmark::State& s) {
+        using Q = typename C::value_type;
+        run<C>(s, [](const C& c) { return core_numeric::transform_reduce(c, [](Q x) { return x * x; }); });
+    }
+
+    // Referencia: el mismo lazo escrito a mano.
+    template<typename C>
+    void BM_transform_reduce_handwritten(benchmark::State& s) {
+        using Q = typename C::value_type;
+        run<C>(s, [](const C& c) {
+            Q r{};
+            for (const Q& x : c) r += x * x;
+            return r;
+        });
+    }
+
+    template<typename C> void BM_argmax(benchmark::State& s) { run<C>(s, [](const C& c) { return core_numeric::argmax(c); }); }
+    template<typename C> void BM_minmax(benchmark::State& s) { run<C>(s, [](const C& c) { return core_numeric::minmax(c).max; }); }
+
+    // top_k con k = 100: tras llenar el umbral deberia ir a la velocidad de sum.
+    template<typename C>
+    void BM_top_k(benchmark::State& s) {
+        run<C>(s, [](const C& c) { return core_numeric::top_k(c, 100).back(); });
+    }
+
+    template<typename C>
+    void BM_describe(benchmark::State& s) {
+        using core_numeric::stats;
+        run<C>(s, [](const C& c) {
+            auto d = core_numeric::describe<stats::sum, stats::mean, stats::variance, stats::max>(c);
+            return d.variance() + static_cast<double>(d.max());
+        });
+    }
+
+    // describe con cuantiles en la misma pasada (DDSketch al 1%).
+    template<typename C>
+    void BM_describe_quantiles(benchmark::State& s) {
+        using core_numeric::stats;
+        run<C>(s, [](const C& c) {
+            auto d = core_numeric::describe<stats::mean, stats::variance, stats::max, stats::quantiles>(c);
+            return d.variance() + d.quantile(0.99);
+        });
+    }
+
+    // Las cuatro llamadas separadas que describe reemplaza.
+    template<typename C>
+    void BM_four_calls(benchmark::State& s) {
+        run<C>(s, [](const C& c) {
+            return static_cast<double>(core_numeric::sum(c)) + static_cast<double>(core_numeric::mean(c)) +
+                   core_numeric::variance(c) + static_cast<double>(core_numeric::max(c));
+        });
+    }
+
+    template<typename S, typename C>
+    void BM_sum_policy(benchmark::State& s) {
+        run<C>(s, [](const C& c) { return core_numeric::sum<S>(c); });
+    }
+
+    // Varianza de cada ventana de 256 elementos: incremental frente a recalcular.
+    template<typename C>
+    void BM_rolling_variance(benchmark::State& s) {
+        run<C>(s, [](const C& c) { return core_numeric::rolling_variance(c, 256).back(); });
+    }
+
+    template<typename C>
+    void BM_rolling_variance_batch(benchmark::State& s) {
+        using Q = typename C::value_type;
+        run<C>(s, [](const C& c) {
+            double last = 0.0;
+            for (std::size_t i = 0; i + 256 <= c.size(); ++i)
+                last = core_numeric::variance(std::span<const Q>(c.data() + i, 256));
+            return last;
+        });
+    }
+
+    // sum((x - y)^2): expresion perezosa frente a un vector temporal.
+    void BM_expr_sq_diff(benchmark::State& state) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const V x = make_container<V>(n), y = make_container<V>(n);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::sum(core_numeric::square(core_numeric::expr(x) - y)));
+        report<V>(state, 2 * n);
+    }
+
+    void BM_temporary_sq_diff(benchmark::State& state) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const V x = make_container<V>(n), y = make_container<V>(n);
+        for (auto _ : state) {
+            V d(n);
+            for (std::size_t i = 0; i < n; ++i) d[i] = (x[i] - y[i]) * (x[i] - y[i]);
+            benchmark::DoNotOptimize(core_numeric::sum(d));
+        }
+        report<V>(state, 2 * n);
+    }
+
+    // Media de los validos (1 de cada 8 invalido): mascara de bits frente a compactar y llamar a mean.
+    void BM_masked_mean(benchmark::State& state) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const V x = make_container<V>(n);
+        const std::vector<std::uint8_t> bits((n + 7) / 8, 0xef);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::masked_mean(x, bits));
+        report<V>(state, n);
+    }
+
+    // Un NaN cada 64 elementos: politica skip contra filtrar a mano y llamar a mean.
+    template<typename F>
+    void run_with_nans(benchmark::State& state, F f) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        V x = make_container<V>(n);
+        for (std::size_t i = 0; i < n; i += 64) x[i] = std::numeric_limits<double>::quiet_NaN();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(f(x));
+        report<V>(state, n);
+    }
+
+    void BM_nan_skip_mean(benchmark::State& state) {
+        run_with_nans(state, [](const auto& x) { return core_numeric::mean<core_numeric::nan_policy::skip>(x); });
+    }
+
+    void BM_nan_skip_variance(benchmark::State& state) {
+        run_with_nans(state, [](const auto& x) { return core_numeric::variance<core_numeric::nan_policy::skip>(x); });
+    }
+
+    void BM_nan_propagate_max(benchmark::State& state) {
+        run_with_nans(state, [](const auto& x) { return core_numeric::max<core_numeric::nan_policy::propagate>(x); });
+    }
+
+    void BM_nan_filtered_mean(benchmark::State& state) {
+        run_with_nans(state, [](const auto& x) {
+            std::vector<double> kept;
+            kept.reserve(x.size());
+            for (double v : x)
+                if (v == v) kept.push_back(v);
+            return core_numeric::mean(kept);
+        });
+    }
+
+    void BM_compacted_mean(benchmark::State& state) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const V x = make_container<V>(n);
+        const std::vector<std::uint8_t> bits((n + 7) / 8, 0xef);
+        for (auto _ : state) {
+            V kept;
+            kept.reserve(n);
+            for (std::size_t i = 0; i < n; ++i)
+                if (core_numeric::simd::valid_bit(bits.data(), i)) kept.push_back(x[i]);
+            benchmark::DoNotOptimize(core_numeric::mean(kept));
+        }
+        report<V>(state, n);
+    }
+
+    void BM_weighted_variance(benchmark::State& state) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const V x = make_container<V>(n), w = make_container<V>(n);
+        V aw(n);
+        for (std::size_t i = 0; i < n; ++i) aw[i] = w[i] < 0 ? -w[i] : w[i];
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::weighted_variance(x, aw));
+        report<V>(state, n);
+    }
+
+    // GROUP BY con range(1) claves distintas: tabla hash contra el
+    // std::map<clave, vector> con una reduccion por cubo.
+    std::vector<std::int64_t> make_keys(std::size_t n, std::int64_t distinct) {
+        std::mt19937_64 g(7);
+        std::uniform_int_distribution<std::int64_t> d(0, distinct - 1);
+        std::vector<std::int64_t> k(n);
+        for (auto& x : k) x = d(g);
+        return k;
+    }
+
+    void BM_group_reduce(benchmark::State& state) {
+        using V = std::vector<double>;
+        using core_numeric::stats;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n, state.range(1));
+        const V x = make_container<V>(n);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::group_reduce<stats::mean, stats::variance, stats::max>(keys, x));
+        report<V>(state, n);
+    }
+
+    void BM_group_map(benchmark::State& state) {
+        using V = std::vector<double>;
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys(n, state.range(1));
+        const V x = make_container<V>(n);
+        for (auto _ : state) {
+            std::map<std::int64_t, V> buckets;
+            for (std::size_t i = 0; i < n; ++i) buckets[keys[i]].push_back(x[i]);
+            double acc = 0.0;
+            for (const auto& [k, b] : buckets)
+                acc += core_numeric::mean(b) + core_numeric::variance(b) + core_numeric::max(b);
+            benchmark::DoNotOptimize(acc);
+        }
+        report<V>(state, n);
+    }
+
+    void by_groups(benchmark::internal::Benchmark* b) {
+        const auto n = static_cast<std::int64_t>(std::min<std::size_t>(max_elems(), std::size_t{1} << 22));
+        for (std::int64_t groups : {16, 1024, 65536}) b->Args({n, groups});
+    }
+
+    template<typename C>
+    void BM_histogram(benchmark::State& s) {
+        run<C>(s, [](const C& c) { return core_numeric::histogram_of(c, -1000.0, 1000.0, 256).overflow(); });
+    }
+
+    // Escalado de 1 a N hilos: range(1) es el numero de hilos. Desde 16K
+    // elementos para ver el corte secuencial en tamanos medios.
+    template<typename C>
+    void BM_parallel_sum(benchmark::State& s) {
+        const auto policy = core_numeric::execution::par.on(static_cast<std::size_t>(s.range(1)));
+        run<C>(s, [&](const C& c) { return core_numeric::sum(policy, c); });
+    }
+
+    template<typename C>
+    void BM_parallel_variance(benchmark::State& s) {
+        const auto policy = core_numeric::execution::par.on(static_cast<std::size_t>(s.range(1)));
+        run<C>(s, [&](const C& c) { return core_numeric::variance(policy, c); });
+    }
+
+    // Variadicas contra la misma aritmetica escrita a mano sobre un punto 4D.
+    void BM_variance_variadic(benchmark::State& state) {
+        double x = 1.0, y = 2.0, z = 3.0, w = 4.0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            benchmark::DoNotOptimize(core_numeric::variance_variadic(x, y, z, w));
+        }
+        state.SetItemsProcessed(state.iterations() * 4);
+    }
+
+    void BM_variance_handwritten(benchmark::State& state) {
+        double x = 1.0, y = 2.0, z = 3.0, w = 4.0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            const double m = (x + y + z + w) / 4;
+            const double r = ((x - m) * (x - m) + (y - m) * (y - m) + (z - m) * (z - m) + (w - m) * (w - m)) / 4;
+            benchmark::DoNotOptimize(r);
+        }
+        state.SetItemsProcessed(state.iterations() * 4);
+    }
+
+    void BM_max_variadic(benchmark::State& state) {
+        double x = 1.0, y = 2.0, z = 3.0, w = 4.0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            benchmark::DoNotOptimize(core_numeric::max_variadic(x, y, z, w));
+        }
+        state.SetItemsProcessed(state.iterations() * 4);
+    }
+
+    void BM_max_handwritten(benchmark::State& state) {
+        double x = 1.0, y = 2.0, z = 3.0, w = 4.0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            double m = x > y ? x : y;
+            m = m > z ? m : z;
+            benchmark::DoNotOptimize(m > w ? m : w);
+        }
+        state.SetItemsProcessed(state.iterations() * 4);
+    }
+
+    // Ancho de banda por nodo NUMA: memoria ligada al nodo range(1) y leida por
+    // un pool fijado a las CPUs de ese mismo nodo.
+    void BM_numa_sum_node(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const int node = static_cast<int>(state.range(1));
+        core_numeric::thread_pool pool({0, true, node});
+        core_numeric::numa::buffer<double> buf(n, core_numeric::numa::placement::bind, node);
+        const auto par = core_numeric::execution::par.with(pool);
+        core_numeric::first_touch(par, buf, 1.0);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::sum(par, buf));
+        report<std::vector<double>>(state, n);
+        state.counters["node"] = node;
+        state.counters["threads"] = static_cast<double>(pool.size());
+    }
+
+    // Todo el sistema: paginas intercaladas, o por primer contacto y cada
+    // bloque enviado al nodo que lo aloja (par.numa()).
+    template<core_numeric::numa::placement Where>
+    void BM_numa_sum_all(benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        core_numeric::thread_pool pool({0, true});
+        core_numeric::numa::buffer<double> buf(n, Where);
+        auto par = core_numeric::execution::par.with(pool);
+        core_numeric::first_touch(par, buf, 1.0);
+        if (Where == core_numeric::numa::placement::first_touch) par = par.numa();
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::sum(par, buf));
+        report<std::vector<double>>(state, n);
+        state.counters["threads"] = static_cast<double>(pool.size());
+    }
+
+    void by_node(benchmark::internal::Benchmark* b) {
+        const std::int64_t n = static_cast<std::int64_t>(std::min<std::size_t>(max_elems(), std::size_t{1} << 26));
+        for (int node = 0; node < core_numeric::numa::node_count(); ++node) b->Args({n, node});
+        b->UseRealTime();
+    }
+
+    void by_large(benchmark::internal::Benchmark* b) {
+        b->Arg(static_cast<std::int64_t>(std::min<std::size_t>(max_elems(), std::size_t{1} << 26)));
+        b->UseRealTime();
+    }
+
+    // Matriz por filas de range(0) x range(1): API por lotes contra una
+    // llamada a moments() por columna con su recoleccion estridada.
+    template<typename T>
+    void BM_column_moments(benchmark::State& state) {
+        const auto rows = static_cast<std::size_t>(state.range(0));
+        const auto cols = static_cast<std::size_t>(state.range(1));
+        const auto data = make_data<T>(rows * cols);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::column_moments(data.data(), rows, cols));
+        report<std::vector<T>>(state, rows * cols);
+    }
+
+    template<typename T>
+    void BM_column_loop(benchmark::State& state) {
+        const auto rows = static_cast<std::size_t>(state.range(0));
+        const auto cols = static_cast<std::size_t>(state.range(1));
+        const auto data = make_data<T>(rows * cols);
+        std::vector<T> column(rows);
+        for (auto _ : state) {
+            std::vector<core_numeric::moments_state<T>> out(cols);
+            for (std::size_t j = 0; j < cols; ++j) {
+                for (std::size_t i = 0; i < rows; ++i) column[i] = data[i * cols + j];
+                out[j] = core_numeric::moments(column);
+            }
+            benchmark::DoNotOptimize(out);
+        }
+        report<std::vector<T>>(state, rows * cols);
+    }
+
+    template<typename T>
+    void BM_row_moments(benchmark::State& state) {
+        const auto rows = static_cast<std::size_t>(state.range(0));
+        const auto cols = static_cast<std::size_t>(state.range(1));
+        const auto data = make_data<T>(rows * cols);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(core_numeric::row_moments(data.data(), rows, cols));
+        report<std::vector<T>>(state, rows * cols);
+    }
+
+    void by_shape(benchmark::internal::Benchmark* b) {
+        for (std::int64_t cols : {16, 256, 4096})
+            for (std::int64_t rows : {1024, 16384})
+                if (static_cast<std::size_t>(rows * cols) <= max_elems()) b->Args({rows, cols});
+    }
+
+    template<typename F>
+    void sizes(benchmark::internal::Benchmark* b, std::size_t from, F&& args) {
+        for (std::size_t n = from; n <= max_elems() && n <= (std::size_t{1} << 30); n *= 8) args(b, n);
+    }
+
+    void by_size(benchmark::internal::Benchmark* b) {
+        sizes(b, std::size_t{1} << 10, [](auto* bm, std::size_t n) { bm->Arg(static_cast<std::int64_t>(n)); });
+    }
+
+    // Las disposiciones no contiguas solo hasta 2^20: son lentas y ocupan mucha memoria.
+    void by_size_small(benchmark::internal::Benchmark* b) {
+        for (std::size_t n = std::size_t{1} << 10; n <= (std::size_t{1} << 20) && n <= max_elems(); n *= 8)
+            b->Arg(static_cast<std::int64_t>(n));
+    }
+
+    void by_threads(benchmark::internal::Benchmark* b) {
+        const std::int64_t hw = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+        sizes(b, std::size_t{1} << 14, [hw](auto* bm, std::size_t n) {
+            for (std::int64_t t = 1; t <= hw; t *= 2) bm->Args({static_cast<std::int64_t>(n), t});
+            if ((hw & (hw - 1)) != 0) bm->Args({static_cast<std::int64_t>(n), hw});
+        });
+        b->UseRealTime();
+    }
+
+    template<typename C>
+    void register_reductions(const std::string& tag, void (*apply)(benchmark::internal::Benchmark*)) {
+        benchmark::RegisterBenchmark(("sum/" + tag).c_str(), BM_sum<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("mean/" + tag).c_str(), BM_mean<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("variance/" + tag).c_str(), BM_variance<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("max/" + tag).c_str(), BM_max<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("moments/" + tag).c_str(), BM_moments<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("argmax/" + tag).c_str(), BM_argmax<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("minmax/" + tag).c_str(), BM_minmax<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("top_k/" + tag).c_str(), BM_top_k<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("transform_reduce/" + tag).c_str(), BM_transform_reduce<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("transform_reduce_handwritten/" + tag).c_str(), BM_transform_reduce_handwritten<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("describe/" + tag).c_str(), BM_describe<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("four_calls/" + tag).c_str(), BM_four_calls<C>)->Apply(apply);
+        benchmark::RegisterBenchmark(("describe_quantiles/" + tag).c_str(), BM_describe_quantiles<C>)->Apply(apply);
+    }
+
+    // Flotantes de 16 bits: solo las reducciones con kernel que ensancha.
+    template<typename C>
+    void register_widening(const std::string& tag) {
+        benchmark::RegisterBenchmark(("sum/" + tag).c_str(), BM_sum<C>)->Apply(by_size);
+        benchmark::RegisterBenchmark(("mean/" + tag).c_str(), BM_mean<C>)->Apply(by_size);
+        benchmark::RegisterBenchmark(("variance/" + tag).c_str(), BM_variance<C>)->Apply(by_size);
+        benchmark::RegisterBenchmark(("max/" + tag).c_str(), BM_max<C>)->Apply(by_size);
+    }
+
+    void register_all() {
+        register_reductions<std::vector<int>>("vector<int>", by_size);
+        register_reductions<std::vector<std::int64_t>>("vector<int64>", by_size);
+        register_reductions<std::vector<float>>("vector<float>", by_size);
+        register_reductions<std::vector<double>>("vector<double>", by_size);
+        register_widening<std::vector<core_numeric::float16>>("vector<float16>");
+        register_widening<std::vector<core_numeric::bfloat16>>("vector<bfloat16>");
+        register_reductions<std::deque<double>>("deque<double>", by_size_small);
+        register_reductions<std::list<double>>("list<double>", by_size_small);
+
+        using namespace core_numeric::summation;
+        using V = std::vector<double>;
+        benchmark::RegisterBenchmark("sum_policy/naive", BM_sum_policy<naive, V>)->Apply(by_size);
+        benchmark::RegisterBenchmark("sum_policy/pairwise", BM_sum_policy<pairwise, V>)->Apply(by_size);
+        benchmark::RegisterBenchmark("sum_policy/kahan", BM_sum_policy<kahan, V>)->Apply(by_size);
+        benchmark::RegisterBenchmark("sum_policy/blocked", BM_sum_policy<blocked, V>)->Apply(by_size);
+
+        benchmark::RegisterBenchmark("expr/sum_sq_diff", BM_expr_sq_diff)->Apply(by_size);
+        benchmark::RegisterBenchmark("expr/sum_sq_diff_temporary", BM_temporary_sq_diff)->Apply(by_size);
+
+        benchmark::RegisterBenchmark("masked_mean/double", BM_masked_mean)->Apply(by_size);
+        benchmark::RegisterBenchmark("masked_mean_compacted/double", BM_compacted_mean)->Apply(by_size);
+        benchmark::RegisterBenchmark("weighted_variance/double", BM_weighted_variance)->Apply(by_size);
+        benchmark::RegisterBenchmark("nan_skip_mean/double", BM_nan_skip_mean)->Apply(by_size);
+        benchmark::RegisterBenchmark("nan_filtered_mean/double", BM_nan_filtered_mean)->Apply(by_size);
+        benchmark::RegisterBenchmark("nan_skip_variance/double", BM_nan_skip_variance)->Apply(by_size);
+        benchmark::RegisterBenchmark("nan_propagate_max/double", BM_nan_propagate_max)->Apply(by_size);
+
+        benchmark::RegisterBenchmark("group_reduce/int64_double", BM_group_reduce)->Apply(by_groups);
+        benchmark::RegisterBenchmark("group_map/int64_double", BM_group_map)->Apply(by_groups);
+        benchmark::RegisterBenchmark("histogram/vector<double>", BM_histogram<V>)->Apply(by_size);
+
+        benchmark::RegisterBenchmark("rolling_variance/vector<double>", BM_rolling_variance<V>)->Arg(1 << 20);
+        benchmark::RegisterBenchmark("rolling_variance_batch/vector<double>", BM_rolling_variance_batch<V>)->Arg(1 << 20);
+        benchmark::RegisterBenchmark("rolling_variance/vector<int>", BM_rolling_variance<std::vector<int>>)->Arg(1 << 20);
+
+        benchmark::RegisterBenchmark("parallel_sum/vector<double>", BM_parallel_sum<V>)->Apply(by_threads);
+        benchmark::RegisterBenchmark("parallel_variance/vector<double>", BM_parallel_variance<V>)->Apply(by_threads);
+
+        using core_numeric::numa::placement;
+        benchmark::RegisterBenchmark("numa_sum/node", BM_numa_sum_node)->Apply(by_node);
+        benchmark::RegisterBenchmark("numa_sum/interleaved", BM_numa_sum_all<placement::interleaved>)->Apply(by_large);
+        benchmark::RegisterBenchmark("numa_sum/first_touch_by_node", BM_numa_sum_all<placement::first_touch>)->Apply(by_large);
+
+        benchmark::RegisterBenchmark("column_moments/double", BM_column_moments<double>)->Apply(by_shape);
+        benchmark::RegisterBenchmark("column_loop/double", BM_column_loop<double>)->Apply(by_shape);
+        benchmark::RegisterBenchmark("row_moments/double", BM_row_moments<double>)->Apply(by_shape);
+        benchmark::RegisterBenchmark("column_moments/float", BM_column_moments<float>)->Apply(by_shape);
+        benchmark::RegisterBenchmark("column_loop/float", BM_column_loop<float>)->Apply(by_shape);
+
+        // Rangos cortos: el coste por llamada del despacho domina.
+        benchmark::RegisterBenchmark("dispatch/sum_small", BM_sum<V>)->Arg(4)->Arg(16)->Arg(64);
+        benchmark::RegisterBenchmark("dispatch/max_small", BM_max<V>)->Arg(4)->Arg(16)->Arg(64);
+
+        benchmark::RegisterBenchmark("variadic/variance", BM_variance_variadic);
+        benchmark::RegisterBenchmark("variadic/variance_handwritten", BM_variance_handwritten);
+        benchmark::RegisterBenchmark("variadic/max", BM_max_variadic);
+        benchmark::RegisterBenchmark("variadic/max_handwritten", BM_max_handwritten);
+    }
+}
+
+int main(int argc, char** argv) {
+    register_all();
+    // Variante de kernels elegida al arrancar (o la de CORE_NUMERIC_ISA).
+    benchmark::AddCustomContext("core_numeric_isa", core_numeric::simd::name(core_numeric::simd::active()));
+    benchmark::AddCustomContext("core_numeric_cpu_isa", core_numeric::simd::name(core_numeric::simd::detect()));
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
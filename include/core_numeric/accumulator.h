@@ -0,0 +1,223 @@
+#ifndef CORE_NUMERIC_ACCUMULATOR_H
+#define CORE_NUMERIC_ACCUMULATOR_H
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/sketch.h"
+
+namespace core_numeric {
+
+    // Estadisticos que puede llevar un acumulador: stats::mean | stats::variance | ...
+    enum class stats : unsigned {
+        none     = 0,
+        count    = 1u << 0,
+        sum      = 1u << 1,
+        mean     = 1u << 2,
+        variance = 1u << 3,
+        min      = 1u << 4,
+        max      = 1u << 5,
+        quantiles = 1u << 6, // DDSketch, ver sketch.h
+    };
+
+    constexpr stats operator|(stats a, stats b) {
+        return static_cast<stats>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+    }
+
+    constexpr bool has(stats set, stats s) {
+        return (static_cast<unsigned>(set) & static_cast<unsigned>(s)) != 0;
+    }
+
+    namespace detail {
+        struct no_sketch {};
+        struct state_codec; // serialize.h
+    }
+
+    // Acumulador en flujo con memoria O(1). Usa las mismas funciones que las
+    // versiones por contenedor (sum, floating_sum, moments, max), asi que
+    // empujar todo un bloque de datos da el mismo resultado que llamar a
+    // sum/mean/variance/max sobre ese contenedor. Dos acumuladores se combinan
+    // con merge() (Chan para la varianza). Con stats::quantiles la memoria
+    // queda acotada por los cubos del sketch.
+    template<typename Q, stats S>
+    class accumulator {
+        static constexpr bool needs_moments = has(S, stats::variance);
+        static constexpr bool needs_extrema = has(S, stats::min) || has(S, stats::max);
+        static constexpr bool needs_sketch = has(S, stats::quantiles);
+
+        using sum_t = detail::wide_t<Q>;
+        using mean_sum_t = std::conditional_t<std::is_integral_v<Q>, sum_t, double>;
+        using sketch_t = std::conditional_t<needs_sketch, ddsketch, detail::no_sketch>;
+
+    public:
+        accumulator() = default;
+
+        // Precision y memoria del sketch: accumulator<double, S>(ddsketch(0.001, 4096)).
+        explicit accumulator(ddsketch sketch) requires (needs_sketch) : sketch_(std::move(sketch)) {}
+
+        // Estado acumulado por otro medio (las columnas de group_table, group.h).
+        // m aporta min, max y, con stats::variance, mean y M2.
+        static accumulator from_state(std::size_t count, sum_t sum, mean_sum_t mean_sum, const moments_state<Q>& m)
+        requires (!needs_sketch) {
+            accumulator a;
+            a.count_ = count;
+            a.sum_ = sum;
+            a.mean_sum_ = mean_sum;
+            a.m_ = m;
+            return a;
+        }
+
+        void push(Q x) {
+            ++count_;
+            if constexpr (needs_sketch) sketch_.push(static_cast<double>(x));
+            if constexpr (has(S, stats::sum)) sum_ += x;
+            if constexpr (has(S, stats::mean)) mean_sum_ += static_cast<mean_sum_t>(x);
+            if constexpr (needs_moments) {
+                core_numeric::push(m_, x);
+            } else if constexpr (needs_extrema) {
+                if (count_ == 1 || x < m_.min) m_.min = x;
+                if (count_ == 1 || x > m_.max) m_.max = x;
+            }
+        }
+
+        void push(std::span<const Q> xs) {
+            if (xs.empty()) return;
+
+            if constexpr (needs_sketch) {
+                if constexpr (std::is_same_v<Q, double>) sketch_.push(xs);
+                else for (const auto& x : xs) sketch_.push(static_cast<double>(x));
+            }
+
+            if constexpr (has(S, stats::sum)) sum_ += core_numeric::sum(xs);
+            if constexpr (has(S, stats::mean)) {
+                if constexpr (std::is_integral_v<Q>) mean_sum_ += core_numeric::sum(xs);
+                else mean_sum_ += detail::floating_sum(xs);
+            }
+            if constexpr (needs_moments) {
+                if constexpr (simd::Lane<Q> || HalfFloat<Q>)
+                    m_ = core_numeric::merge(m_, simd::moments<Q, needs_extrema>(xs.data(), xs.size(), count_ > 0));
+                else
+                    m_ = core_numeric::merge(m_, core_numeric::moments(xs));
+            } else if constexpr (needs_extrema) {
+                // Como push(x): tras el primer elemento los NaN no cuentan.
+                const auto rest = xs.subspan(count_ == 0 ? 0 : simd::skip_nan(xs.data(), xs.size()));
+                if (!rest.empty()) {
+                    moments_state<Q> e;
+                    e.min = rest[0];
+                    e.max = rest[0];
+                    if constexpr (simd::Lane<Q>) {
+                        if constexpr (has(S, stats::min)) e.min = simd::min(rest.data(), rest.size());
+                        if constexpr (has(S, stats::max)) e.max = simd::max(rest.data(), rest.size());
+                    } else {
+                        for (const auto& x : rest) {
+                            if (x < e.min) e.min = x;
+                            if (x > e.max) e.max = x;
+                        }
+                    }
+                    if (count_ == 0) {
+                        m_.min = e.min;
+                        m_.max = e.max;
+                    } else {
+                        if (e.min < m_.min) m_.min = e.min;
+                        if (e.max > m_.max) m_.max = e.max;
+                    }
+                }
+            }
+            count_ += xs.size();
+        }
+
+        void merge(const accumulator& other) {
+            if (other.count_ == 0) return;
+            if constexpr (needs_sketch) sketch_.merge(other.sketch_);
+            if constexpr (has(S, stats::sum)) sum_ += other.sum_;
+            if constexpr (has(S, stats::mean)) mean_sum_ += other.mean_sum_;
+            if constexpr (needs_moments) {
+                m_ = core_numeric::merge(m_, other.m_);
+            } else if constexpr (needs_extrema) {
+                if (count_ == 0 || other.m_.min < m_.min) m_.min = other.m_.min;
+                if (count_ == 0 || other.m_.max > m_.max) m_.max = other.m_.max;
+            }
+            count_ += other.count_;
+        }
+
+        std::size_t count() const { return count_; }
+
+        sum_t sum() const requires (has(S, stats::sum)) { return sum_; }
+
+        auto mean() const requires (has(S, stats::mean)) {
+            if constexpr (std::is_integral_v<Q>) {
+                // Como mean(container): vacio lanza con enteros y da NaN con flotantes.
+                if (count_ == 0) throw std::invalid_argument("mean: empty range");
+                return static_cast<Q>(mean_sum_ / static_cast<sum_t>(count_));
+            } else {
+                return mean_sum_ / static_cast<double>(count_);
+            }
+        }
+
+        double variance() const requires (has(S, stats::variance)) {
+            return core_numeric::variance(m_);
+        }
+
+        double variance(std::size_t ddof) const requires (has(S, stats::variance)) {
+            return core_numeric::variance(m_, ddof);
+        }
+
+        Q min() const requires (has(S, stats::min)) { return m_.min; }
+        Q max() const requires (has(S, stats::max)) { return m_.max; }
+
+        const moments_state<Q>& moments() const requires (needs_moments) { return m_; }
+
+        // Cuantil aproximado (error relativo <= sketch().relative_accuracy()).
+        double quantile(double q) const requires (needs_sketch) { return sketch_.quantile(q); }
+        double median() const requires (needs_sketch) { return sketch_.quantile(0.5); }
+        const ddsketch& sketch() const requires (needs_sketch) { return sketch_; }
+
+    private:
+        friend struct detail::state_codec;
+
+        std::size_t count_ = 0;
+        sum_t sum_{};
+        mean_sum_t mean_sum_{};
+        moments_state<Q> m_;
+        [[no_unique_address]] sketch_t sketch_;
+    };
+
+    // Consulta fusionada: describe<stats::sum, stats::mean, stats::variance, stats::max>(v)
+    // calcula todo en un solo recorrido. Los datos contiguos se empujan al
+    // acumulador en bloques de L1, asi cada kernel SIMD lee el bloque desde cache;
+    // los estadisticos no pedidos no generan codigo. La varianza coincide con
+    // variance(v); sum y mean difieren a lo sumo en el redondeo entre bloques.
+    namespace detail {
+        // Empuja xs en bloques de L1 para que todos los kernels lean desde cache.
+        template<typename Q, stats S>
+        void push_blocks(accumulator<Q, S>& acc, std::span<const Q> xs) {
+            const std::size_t n = xs.size();
+            for (std::size_t i = 0; i < n; i += simd::moments_block)
+                acc.push(xs.subspan(i, n - i < simd::moments_block ? n - i : simd::moments_block));
+        }
+    }
+
+    template<stats... S, Iterable T>
+    requires (sizeof...(S) > 0)
+    auto describe(const T& container) {
+        CORE_NUMERIC_METRIC("describe", container, simd::Contiguous<T>);
+        using Q = element_t<T>;
+        accumulator<Q, (stats::none | ... | S)> acc;
+
+        if constexpr (simd::Contiguous<T>) {
+            detail::push_blocks(acc, std::span<const Q>(std::ranges::data(container), std::ranges::size(container)));
+        } else {
+            for (const auto& x : container) acc.push(x);
+        }
+        return acc;
+    }
+}
+
+#endif // CORE_NUMERIC_ACCUMULATOR_H
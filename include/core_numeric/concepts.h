@@ -0,0 +1,40 @@
+#ifndef CORE_NUMERIC_CONCEPTS_H
+#define CORE_NUMERIC_CONCEPTS_H
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "core_numeric/half.h"
+
+// Cualquier rango recorrible como const: contenedores, std::span, vistas de
+// std::ranges y las vistas propias (strided_view). No exige value_type miembro.
+template<typename C>
+concept Iterable = std::ranges::input_range<const C>;
+
+// Tipo de elemento de un Iterable, sin const ni referencias.
+template<typename C>
+using element_t = std::remove_cv_t<std::ranges::range_value_t<const C>>;
+
+// Los flotantes de 16 bits (half.h) operan en float, pero se reducen como
+// cualquier otro tipo numerico: acumulando en float / double.
+template<typename T>
+concept Addable = requires (T a, T b) {
+    {a + b} -> std::same_as<T>;
+} || core_numeric::HalfFloat<T>;
+
+template<typename T>
+concept Divisible = requires (T a , std::size_t n) {
+    {a / n} -> std::convertible_to<T>;
+} || core_numeric::HalfFloat<T>;
+
+template<typename T>
+concept Comparable = core_numeric::HalfFloat<T> || (
+    std::is_arithmetic_v<T> &&
+    !std::is_same_v<T, char> &&
+    !std::is_same_v<T, signed char> &&
+    !std::is_same_v<T, unsigned char>);
+
+#endif // CORE_NUMERIC_CONCEPTS_H
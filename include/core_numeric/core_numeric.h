@@ -0,0 +1,45 @@
+#ifndef CORE_NUMERIC_CORE_NUMERIC_H
+#define CORE_NUMERIC_CORE_NUMERIC_H
+
+// Cabecera de conveniencia con toda la biblioteca. Enlazar con el target
+// core_numeric (CMake), que aporta los kernels SIMD compilados.
+
+#include "core_numeric/half.h"
+#include "core_numeric/concepts.h"
+#include "core_numeric/memory.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/thread_pool.h"
+#include "core_numeric/numa.h"
+#include "core_numeric/simd.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/summation.h"
+#include "core_numeric/sketch.h"
+#include "core_numeric/accumulator.h"
+#include "core_numeric/parallel.h"
+#include "core_numeric/rolling.h"
+#include "core_numeric/integer.h"
+#include "core_numeric/extrema.h"
+#include "core_numeric/nan.h"
+#include "core_numeric/variadic.h"
+#include "core_numeric/mapped_column.h"
+#include "core_numeric/stream.h"
+#include "core_numeric/views.h"
+#include "core_numeric/expr.h"
+#include "core_numeric/weighted.h"
+#include "core_numeric/group.h"
+#include "core_numeric/histogram.h"
+#include "core_numeric/serialize.h"
+#include "core_numeric/distributed.h"
+#include "core_numeric/matrix.h"
+#include "core_numeric/instantiations.h"
+
+#if defined(CORE_NUMERIC_MPI)
+#include "core_numeric/mpi.h"
+#endif
+
+#if defined(CORE_NUMERIC_CUDA)
+#include "core_numeric/gpu.h"
+#endif
+
+#endif // CORE_NUMERIC_CORE_NUMERIC_H
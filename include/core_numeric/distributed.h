@@ -0,0 +1,112 @@
+#ifndef CORE_NUMERIC_DISTRIBUTED_H
+#define CORE_NUMERIC_DISTRIBUTED_H
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/serialize.h"
+
+// Reduccion entre procesos o nodos: cada uno resume sus datos en un estado
+// parcial (accumulator, moments_state, ddsketch) y solo viajan los estados
+// serializados, nunca los datos. tree_reduce y all_reduce siguen un arbol
+// binomial: log2(p) rondas y, por nodo, como mucho log2(p) mensajes de
+// tamano fijo. El orden de las combinaciones depende solo del rango, asi que
+// el resultado es reproducible y coincide bit a bit con merge_all() sobre los
+// parciales en orden de rango. Con MPI ver mpi.h (mpi_communicator).
+namespace core_numeric {
+
+    // Transporte punto a punto: rank() en [0, size()), send() entrega un
+    // mensaje completo a peer y recv(peer) espera el siguiente de ese peer.
+    template<typename C>
+    concept Communicator = requires(C& c, int peer, std::span<const std::byte> msg) {
+        { c.rank() } -> std::convertible_to<int>;
+        { c.size() } -> std::convertible_to<int>;
+        c.send(peer, msg);
+        { c.recv(peer) } -> std::same_as<std::vector<std::byte>>;
+    };
+
+    namespace detail {
+        template<typename X>
+        void merge_into(X& into, const X& other) {
+            if constexpr (requires { into.merge(other); }) into.merge(other);
+            else into = core_numeric::merge<4>(into, other); // moments_state
+        }
+
+        // El arbol se arma sobre rangos virtuales con la raiz en 0.
+        struct tree_ranks {
+            int rank;
+            int size;
+            int root;
+
+            int actual(int v) const { return (v + root) % size; }
+            int virtual_rank() const { return (rank - root + size) % size; }
+        };
+
+        template<Communicator C>
+        tree_ranks ranks_of(C& comm, int root) {
+            const int size = static_cast<int>(comm.size());
+            if (root < 0 || root >= size) throw std::invalid_argument("tree_reduce: root outside the communicator");
+            return {static_cast<int>(comm.rank()), size, root};
+        }
+    }
+
+    // Combina parciales locales por parejas (0+1, 2+3, ... y luego 0+2, ...),
+    // el mismo arbol que tree_reduce con parts[i] en el rango i.
+    template<Serializable X>
+    X merge_all(std::span<const X> parts) {
+        if (parts.empty()) return X{};
+        std::vector<X> level(parts.begin(), parts.end());
+        for (std::size_t step = 1; step < level.size(); step *= 2)
+            for (std::size_t i = 0; i + step < level.size(); i += 2 * step)
+                detail::merge_into(level[i], level[i + step]);
+        return std::move(level.front());
+    }
+
+    // Devuelve el estado global en root; en los demas rangos, el parcial de
+    // su subarbol.
+    template<Communicator C, Serializable X>
+    X tree_reduce(C& comm, X local, int root = 0) {
+        const auto t = detail::ranks_of(comm, root);
+        const int v = t.virtual_rank();
+        for (int step = 1; step < t.size; step *= 2) {
+            if (v % (2 * step) != 0) {
+                const auto bytes = serialize(local);
+                comm.send(t.actual(v - step), std::span<const std::byte>(bytes));
+                break;
+            }
+            if (v + step < t.size) {
+                const auto bytes = comm.recv(t.actual(v + step));
+                merge_serialized(local, std::span<const std::byte>(bytes));
+            }
+        }
+        return local;
+    }
+
+    // tree_reduce y difusion del resultado por el mismo arbol: todos los
+    // rangos terminan con el mismo estado global.
+    template<Communicator C, Serializable X>
+    X all_reduce(C& comm, X local) {
+        local = tree_reduce(comm, std::move(local));
+        const auto t = detail::ranks_of(comm, 0);
+        const int v = t.virtual_rank();
+        std::vector<std::byte> bytes;
+        if (v == 0) bytes = serialize(local);
+
+        int top = 1;
+        while (top < t.size) top *= 2;
+        for (int step = top / 2; step >= 1; step /= 2) {
+            if (v % (2 * step) == 0) {
+                if (v + step < t.size) comm.send(t.actual(v + step), std::span<const std::byte>(bytes));
+            } else if (v % (2 * step) == step) {
+                bytes = comm.recv(t.actual(v - step));
+            }
+        }
+        return v == 0 ? local : deserialize<X>(std::span<const std::byte>(bytes));
+    }
+}
+
+#endif // CORE_NUMERIC_DISTRIBUTED_H
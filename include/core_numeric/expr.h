@@ -0,0 +1,498 @@
+#ifndef CORE_NUMERIC_EXPR_H
+#define CORE_NUMERIC_EXPR_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Expresiones elemento a elemento perezosas: expr(x) - expr(y) no crea
+    // ningun vector, es un rango cuyo elemento i se calcula al leerlo.
+    //   expr(c)                       hoja sobre un rango de acceso aleatorio con tamano
+    //   a + b, a - b, a * b, a / b    con otra expresion, un rango o un escalar
+    //   a < b, ..., a == b            expresiones de bool (para masked)
+    //   -a, square(a), abs(a), map(a, f)
+    //   weighted(x, w)                x * w elemento a elemento
+    //   masked(x, m)                  solo los x[i] con m[i] verdadero
+    // sum, mean, variance, moments, max y transform_reduce evaluan la expresion
+    // por bloques de expr_block elementos en un buffer en la pila y pasan cada
+    // bloque a los kernels de rangos contiguos: una sola pasada por la memoria
+    // de las hojas y sin reservas. Los demas algoritmos la recorren como
+    // cualquier rango.
+    //
+    // expr() de un contenedor temporal se queda con el (la expresion pasa a
+    // ser solo movible); de un lvalue guarda una referencia, que tiene que
+    // seguir viva mientras se use la expresion.
+    template<typename N>
+    class expression;
+
+    template<typename X, typename M>
+    class masked_view;
+
+    namespace detail {
+        template<typename T>
+        struct is_expression : std::false_type {};
+        template<typename N>
+        struct is_expression<expression<N>> : std::true_type {};
+
+        template<typename T>
+        struct is_masked : std::false_type {};
+        template<typename X, typename M>
+        struct is_masked<masked_view<X, M>> : std::true_type {};
+
+        template<typename T>
+        concept Expression = is_expression<std::remove_cvref_t<T>>::value;
+
+        // Se evaluan por bloques en lugar de elemento a elemento.
+        template<typename T>
+        concept Fused = (is_expression<T>::value || is_masked<T>::value) && std::is_arithmetic_v<element_t<T>>;
+
+        template<typename C>
+        concept Indexable = std::ranges::random_access_range<const C> && std::ranges::sized_range<const C> &&
+                            std::ranges::viewable_range<C>;
+
+        // Elementos por bloque: 4 KiB de double, holgado en L1.
+        inline constexpr std::size_t expr_block = 512;
+
+        template<typename V>
+        class leaf {
+        public:
+            explicit leaf(V v) : v_(std::move(v)) {}
+
+            element_t<V> operator[](std::size_t i) const {
+                return std::ranges::begin(v_)[static_cast<std::ranges::range_difference_t<const V>>(i)];
+            }
+
+            std::size_t size() const { return static_cast<std::size_t>(std::ranges::size(v_)); }
+
+        private:
+            V v_;
+        };
+
+        // Escalar repetido; toma el tamano del otro operando.
+        template<typename Q>
+        struct scalar {
+            Q value;
+            Q operator[](std::size_t) const { return value; }
+        };
+
+        template<typename N>
+        constexpr bool sized_node = requires (const N& n) { n.size(); };
+
+        template<typename Op, typename L, typename R>
+        class binary {
+        public:
+            binary(L l, R r, std::size_t n) : l_(std::move(l)), r_(std::move(r)), n_(n) {}
+
+            auto operator[](std::size_t i) const { return Op{}(l_[i], r_[i]); }
+            std::size_t size() const { return n_; }
+
+        private:
+            L l_;
+            R r_;
+            std::size_t n_;
+        };
+
+        template<typename F, typename A>
+        class unary {
+        public:
+            unary(F f, A a) : f_(std::move(f)), a_(std::move(a)) {}
+
+            auto operator[](std::size_t i) const { return f_(a_[i]); }
+            std::size_t size() const { return a_.size(); }
+
+        private:
+            [[no_unique_address]] F f_;
+            A a_;
+        };
+
+        // Operando de una expresion: otra expresion, un rango indexable o un escalar.
+        template<typename T>
+        concept Operand = Expression<T> || std::is_arithmetic_v<std::remove_cvref_t<T>> ||
+                          Indexable<std::remove_cvref_t<T>>;
+
+        template<typename T>
+        auto lift(T&& x) {
+            if constexpr (Expression<T>) return std::forward<T>(x).node();
+            else if constexpr (std::is_arithmetic_v<std::remove_cvref_t<T>>) return scalar<std::remove_cvref_t<T>>{x};
+            else return leaf{std::views::all(std::forward<T>(x))};
+        }
+
+        template<typename Op, typename A, typename B>
+        auto make_binary(A&& a, B&& b) {
+            auto l = lift(std::forward<A>(a));
+            auto r = lift(std::forward<B>(b));
+            using L = decltype(l);
+            using R = decltype(r);
+            std::size_t n;
+            if constexpr (sized_node<L> && sized_node<R>) {
+                if (l.size() != r.size()) throw std::invalid_argument("expr: operands differ in size");
+                n = l.size();
+            } else if constexpr (sized_node<L>) {
+                n = l.size();
+            } else {
+                static_assert(sized_node<R>, "expr: at least one operand must be a range");
+                n = r.size();
+            }
+            return expression(binary<Op, L, R>(std::move(l), std::move(r), n));
+        }
+
+        template<typename F, typename A>
+        auto make_unary(F f, A&& a) {
+            auto x = lift(std::forward<A>(a));
+            static_assert(sized_node<decltype(x)>, "expr: operand must be a range");
+            return expression(unary<F, decltype(x)>(std::move(f), std::move(x)));
+        }
+
+        struct square_fn {
+            template<typename Q>
+            auto operator()(Q x) const { return x * x; }
+        };
+
+        struct abs_fn {
+            template<typename Q>
+            auto operator()(Q x) const {
+                if constexpr (std::is_unsigned_v<Q>) return x;
+                else return x < Q{} ? -x : x;
+            }
+        };
+    }
+
+    template<typename N>
+    class expression : public std::ranges::view_interface<expression<N>> {
+    public:
+        using value_type = std::remove_cvref_t<decltype(std::declval<const N&>()[0])>;
+
+        class iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = expression::value_type;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(const N* node, std::ptrdiff_t i) : node_(node), i_(i) {}
+
+            value_type operator*() const { return (*node_)[static_cast<std::size_t>(i_)]; }
+            value_type operator[](difference_type k) const { return (*node_)[static_cast<std::size_t>(i_ + k)]; }
+
+            iterator& operator++() { ++i_; return *this; }
+            iterator operator++(int) { auto t = *this; ++i_; return t; }
+            iterator& operator--() { --i_; return *this; }
+            iterator operator--(int) { auto t = *this; --i_; return t; }
+            iterator& operator+=(difference_type k) { i_ += k; return *this; }
+            iterator& operator-=(difference_type k) { i_ -= k; return *this; }
+
+            friend iterator operator+(iterator it, difference_type k) { return it += k; }
+            friend iterator operator+(difference_type k, iterator it) { return it += k; }
+            friend iterator operator-(iterator it, difference_type k) { return it -= k; }
+            friend difference_type operator-(const iterator& a, const iterator& b) { return a.i_ - b.i_; }
+
+            friend bool operator==(const iterator& a, const iterator& b) { return a.i_ == b.i_; }
+            friend auto operator<=>(const iterator& a, const iterator& b) { return a.i_ <=> b.i_; }
+
+        private:
+            const N* node_ = nullptr;
+            std::ptrdiff_t i_ = 0;
+        };
+
+        explicit expression(N node) : node_(std::move(node)) {}
+
+        iterator begin() const { return {&node_, 0}; }
+        iterator end() const { return {&node_, static_cast<std::ptrdiff_t>(node_.size())}; }
+        std::size_t size() const { return node_.size(); }
+        value_type operator[](std::size_t i) const { return node_[i]; }
+
+        const N& node() const& { return node_; }
+        N node() && { return std::move(node_); }
+
+    private:
+        N node_;
+    };
+
+    // Los x[i] con m[i] verdadero, en orden. Recorrerlo evalua x y m enteros.
+    template<typename X, typename M>
+    class masked_view : public std::ranges::view_interface<masked_view<X, M>> {
+    public:
+        using value_type = std::remove_cvref_t<decltype(std::declval<const X&>()[0])>;
+
+        class iterator {
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = masked_view::value_type;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(const masked_view* v, std::size_t i) : v_(v), i_(i) { skip(); }
+
+            value_type operator*() const { return v_->x_[i_]; }
+
+            iterator& operator++() { ++i_; skip(); return *this; }
+            iterator operator++(int) { auto t = *this; ++*this; return t; }
+
+            friend bool operator==(const iterator& a, const iterator& b) { return a.i_ == b.i_; }
+
+        private:
+            void skip() {
+                while (i_ < v_->n_ && !v_->m_[i_]) ++i_;
+            }
+
+            const masked_view* v_ = nullptr;
+            std::size_t i_ = 0;
+        };
+
+        masked_view(X x, M m, std::size_t n) : x_(std::move(x)), m_(std::move(m)), n_(n) {}
+
+        iterator begin() const { return {this, 0}; }
+        iterator end() const { return {this, n_}; }
+
+        // Posiciones evaluadas (no las seleccionadas).
+        std::size_t extent() const { return n_; }
+        const X& values() const { return x_; }
+        const M& mask() const { return m_; }
+
+    private:
+        X x_;
+        M m_;
+        std::size_t n_;
+    };
+
+    template<typename T>
+    requires detail::Expression<T> || detail::Indexable<std::remove_cvref_t<T>>
+    auto expr(T&& x) {
+        if constexpr (detail::Expression<T>) return std::remove_cvref_t<T>(std::forward<T>(x));
+        else return expression(detail::lift(std::forward<T>(x)));
+    }
+
+#define CORE_NUMERIC_EXPR_BINARY(op, fn)                                                               \
+    template<detail::Operand A, detail::Operand B>                                                     \
+    requires (detail::Expression<A> || detail::Expression<B>)                                          \
+    auto operator op(A&& a, B&& b) {                                                                   \
+        return detail::make_binary<fn>(std::forward<A>(a), std::forward<B>(b));                        \
+    }
+
+    CORE_NUMERIC_EXPR_BINARY(+, std::plus<>)
+    CORE_NUMERIC_EXPR_BINARY(-, std::minus<>)
+    CORE_NUMERIC_EXPR_BINARY(*, std::multiplies<>)
+    CORE_NUMERIC_EXPR_BINARY(/, std::divides<>)
+    CORE_NUMERIC_EXPR_BINARY(<, std::less<>)
+    CORE_NUMERIC_EXPR_BINARY(<=, std::less_equal<>)
+    CORE_NUMERIC_EXPR_BINARY(>, std::greater<>)
+    CORE_NUMERIC_EXPR_BINARY(>=, std::greater_equal<>)
+    CORE_NUMERIC_EXPR_BINARY(==, std::equal_to<>)
+    CORE_NUMERIC_EXPR_BINARY(!=, std::not_equal_to<>)
+
+#undef CORE_NUMERIC_EXPR_BINARY
+
+    template<detail::Expression A>
+    auto operator-(A&& a) {
+        return detail::make_unary(std::negate<>{}, std::forward<A>(a));
+    }
+
+    template<detail::Operand A>
+    requires (!std::is_arithmetic_v<std::remove_cvref_t<A>>)
+    auto square(A&& a) {
+        return detail::make_unary(detail::square_fn{}, std::forward<A>(a));
+    }
+
+    template<detail::Operand A>
+    requires (!std::is_arithmetic_v<std::remove_cvref_t<A>>)
+    auto abs(A&& a) {
+        return detail::make_unary(detail::abs_fn{}, std::forward<A>(a));
+    }
+
+    template<detail::Operand A, typename F>
+    requires (!std::is_arithmetic_v<std::remove_cvref_t<A>>)
+    auto map(A&& a, F f) {
+        return detail::make_unary(std::move(f), std::forward<A>(a));
+    }
+
+    // Producto elemento a elemento: sum(weighted(x, w)) es sum x_i * w_i.
+    template<detail::Operand X, detail::Operand W>
+    requires (!std::is_arithmetic_v<std::remove_cvref_t<X>>)
+    auto weighted(X&& x, W&& w) {
+        return detail::make_binary<std::multiplies<>>(std::forward<X>(x), std::forward<W>(w));
+    }
+
+    // m: rango o expresion de valores convertibles a bool, del tamano de x.
+    // Descartar NaN: masked(x, expr(x) == expr(x)).
+    template<detail::Operand X, detail::Operand M>
+    requires (!std::is_arithmetic_v<std::remove_cvref_t<X>> && !std::is_arithmetic_v<std::remove_cvref_t<M>>)
+    auto masked(X&& x, M&& m) {
+        auto v = detail::lift(std::forward<X>(x));
+        auto k = detail::lift(std::forward<M>(m));
+        if (v.size() != k.size()) throw std::invalid_argument("masked: values and mask differ in size");
+        const std::size_t n = v.size();
+        return masked_view<decltype(v), decltype(k)>(std::move(v), std::move(k), n);
+    }
+
+    namespace detail {
+        // Llama a f(std::span<const Q>) con bloques no vacios de la
+        // expresion evaluada y devuelve el numero total de elementos.
+        template<typename N, typename F>
+        std::size_t for_each_block(const expression<N>& e, F f) {
+            using Q = typename expression<N>::value_type;
+            const N& node = e.node();
+            const std::size_t n = node.size();
+            Q buf[expr_block];
+            for (std::size_t i = 0; i < n; i += expr_block) {
+                const std::size_t len = n - i < expr_block ? n - i : expr_block;
+                for (std::size_t j = 0; j < len; ++j) buf[j] = node[i + j];
+                f(std::span<const Q>(buf, len));
+            }
+            return n;
+        }
+
+        // Compacta sin saltos: se escribe siempre y solo avanza si m[i].
+        template<typename X, typename M, typename F>
+        std::size_t for_each_block(const masked_view<X, M>& v, F f) {
+            using Q = typename masked_view<X, M>::value_type;
+            const X& x = v.values();
+            const M& m = v.mask();
+            const std::size_t n = v.extent();
+            Q buf[expr_block];
+            std::size_t k = 0, total = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                buf[k] = x[i];
+                k += static_cast<bool>(m[i]);
+                if (k == expr_block) {
+                    f(std::span<const Q>(buf, k));
+                    total += k;
+                    k = 0;
+                }
+            }
+            if (k) f(std::span<const Q>(buf, k));
+            return total + k;
+        }
+    }
+
+    template<Iterable T>
+    requires Addable<element_t<T>> && detail::Fused<T>
+    auto sum(const T& e) {
+        CORE_NUMERIC_METRIC("sum", e, (simd::Lane<element_t<T>> || HalfFloat<element_t<T>>));
+        using Q = element_t<T>;
+        detail::wide_t<Q> total{};
+        detail::for_each_block(e, [&](std::span<const Q> b) { total += sum(b); });
+        return total;
+    }
+
+    // Con enteros lanza std::invalid_argument si no queda ningun elemento.
+    template<Iterable T>
+    requires Divisible<element_t<T>> && detail::Fused<T>
+    auto mean(const T& e) {
+        CORE_NUMERIC_METRIC("mean", e, (simd::Lane<element_t<T>> || HalfFloat<element_t<T>>));
+        using Q = element_t<T>;
+
+        if constexpr (std::is_integral_v<Q>) {
+            using W = detail::wide_t<Q>;
+            W s{};
+            const std::size_t n = detail::for_each_block(e, [&](std::span<const Q> b) { s += sum(b); });
+            if (n == 0) throw std::invalid_argument("mean: empty range");
+            return static_cast<Q>(s / static_cast<W>(n));
+        } else {
+            double s = 0.0;
+            const std::size_t n = detail::for_each_block(e, [&](std::span<const Q> b) { s += detail::floating_sum(b); });
+            return s / static_cast<double>(n);
+        }
+    }
+
+    template<int Order = 2, Iterable T>
+    requires Addable<element_t<T>> && detail::Fused<T>
+    auto moments(const T& e) {
+        CORE_NUMERIC_METRIC("moments", e, (Order == 2 && (simd::Lane<element_t<T>> || HalfFloat<element_t<T>>)));
+        using Q = element_t<T>;
+
+        if constexpr (Order == 2 && detail::exact_integer_moments<Q>) {
+            // Sumas enteras a traves de los bloques: el mismo resultado exacto que moments(c).
+            detail::wide_t<Q> s1 = 0;
+            simd::square_sum sq;
+            Q lo{}, hi{};
+            const std::size_t n = detail::for_each_block(e, [&, first = true](std::span<const Q> b) mutable {
+                s1 += sum(b);
+                if constexpr (std::is_same_v<Q, std::int32_t>) sq += simd::sum_sq(b.data(), b.size());
+                else sq += simd::scalar::sum_sq(b.data(), b.size());
+                const auto [bl, bh] = std::ranges::minmax(b);
+                if (first || bl < lo) lo = bl;
+                if (first || bh > hi) hi = bh;
+                first = false;
+            });
+            auto r = detail::exact_moments<Q>(n, s1, sq);
+            r.min = lo;
+            r.max = hi;
+            return r;
+        } else if constexpr (Order == 2 && (simd::Lane<Q> || HalfFloat<Q>)) {
+            // Tras el primer bloque los NaN iniciales no cuentan para min y max.
+            moments_state<Q> total;
+            detail::for_each_block(e, [&](std::span<const Q> b) {
+                total = merge(total, simd::moments(b.data(), b.size(), total.count > 0));
+            });
+            return total;
+        } else {
+            moments_state<Q> s;
+            detail::for_each_block(e, [&](std::span<const Q> b) {
+                for (const Q x : b) push<Order>(s, x);
+            });
+            return s;
+        }
+    }
+
+    template<Iterable T>
+    requires Comparable<element_t<T>> && detail::Fused<T>
+    auto max(const T& e) {
+        CORE_NUMERIC_METRIC("max", e, (simd::Lane<element_t<T>> || HalfFloat<element_t<T>>));
+        using Q = element_t<T>;
+        Q result{};
+        bool any = false;
+        detail::for_each_block(e, [&](std::span<const Q> b) {
+            // Como en max(c): solo un NaN en el primer elemento cuenta.
+            if (any) b = b.subspan(simd::skip_nan(b.data(), b.size()));
+            if (b.empty()) return;
+            const Q m = max(b);
+            if (!any || m > result) result = m;
+            any = true;
+        });
+        if (!any) throw std::invalid_argument("max: empty range");
+        return result;
+    }
+
+    template<Iterable T, typename R, typename Op, typename F>
+    requires std::invocable<F&, const element_t<T>&> && detail::Fused<T>
+    R transform_reduce(const T& e, R identity, Op combine, F func) {
+        CORE_NUMERIC_METRIC("transform_reduce", e, false);
+        using Q = element_t<T>;
+        R result = identity;
+        detail::for_each_block(e, [&](std::span<const Q> b) {
+            result = combine(result, transform_reduce(b, identity, combine, func));
+        });
+        return result;
+    }
+
+    template<Iterable T, typename F>
+    requires detail::Fused<T>
+    auto transform_reduce(const T& e, F func) {
+        CORE_NUMERIC_METRIC("transform_reduce", e, false);
+        using Q = element_t<T>;
+        using R = decltype(func(std::declval<const Q&>()));
+        R result{};
+        detail::for_each_block(e, [&](std::span<const Q> b) { result += transform_reduce(b, func); });
+        return result;
+    }
+}
+
+#endif // CORE_NUMERIC_EXPR_H
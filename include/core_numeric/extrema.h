@@ -0,0 +1,322 @@
+#ifndef CORE_NUMERIC_EXTREMA_H
+#define CORE_NUMERIC_EXTREMA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/memory.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/parallel.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Extremos con posicion, minimo y maximo juntos y los k mayores. Todas las
+    // funciones lanzan std::invalid_argument con un rango vacio (top_k no: con
+    // menos de k elementos devuelve los que haya).
+    template<typename Q>
+    using minmax_result = std::ranges::min_max_result<Q>;
+
+    namespace detail {
+        template<Iterable T>
+        void require_nonempty(const T& container, const char* what) {
+            if (std::ranges::empty(container)) throw std::invalid_argument(std::string(what) + ": empty range");
+        }
+
+        // Indice del primer extremo (Better: std::greater para max, std::less
+        // para min). En contiguo, el kernel SIMD elige el bloque de L1 con el
+        // extremo y solo ese bloque se vuelve a recorrer para ubicarlo, con la
+        // misma comparacion que el lazo escalar (con NaN, buscar el valor falla).
+        template<typename Better, Iterable T>
+        std::size_t arg_extreme(const T& container) {
+            using Q = element_t<T>;
+            constexpr bool is_max = std::is_same_v<Better, std::greater<>>;
+
+            if constexpr (simd::Contiguous<T>) {
+                const Q* p = std::ranges::data(container);
+                const std::size_t n = std::ranges::size(container);
+                constexpr std::size_t B = simd::moments_block;
+
+                std::size_t where = 0, end = n < B ? n : B;
+                Q best = is_max ? simd::max(p, end) : simd::min(p, end);
+                for (std::size_t i = B; i < n; i += B) {
+                    const std::size_t len = n - i < B ? n - i : B;
+                    const std::size_t k = simd::skip_nan(p + i, len);
+                    if (k == len) continue;
+                    const Q m = is_max ? simd::max(p + i + k, len - k) : simd::min(p + i + k, len - k);
+                    if (Better{}(m, best)) {
+                        best = m;
+                        where = i + k;
+                        end = i + len;
+                    }
+                }
+                std::size_t at = where;
+                for (std::size_t j = where + 1; j < end; ++j)
+                    if (Better{}(p[j], p[at])) at = j;
+                return at;
+            } else {
+                auto it = std::ranges::begin(container);
+                const auto last = std::ranges::end(container);
+                Q best = *it;
+                std::size_t where = 0;
+                for (std::size_t i = 1; ++it != last; ++i) {
+                    if (Better{}(*it, best)) {
+                        best = *it;
+                        where = i;
+                    }
+                }
+                return where;
+            }
+        }
+    }
+
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    std::size_t argmax(const T& container) {
+        CORE_NUMERIC_METRIC("argmax", container, simd::Contiguous<T>);
+        detail::require_nonempty(container, "argmax");
+        return detail::arg_extreme<std::greater<>>(container);
+    }
+
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    std::size_t argmin(const T& container) {
+        CORE_NUMERIC_METRIC("argmin", container, simd::Contiguous<T>);
+        detail::require_nonempty(container, "argmin");
+        return detail::arg_extreme<std::less<>>(container);
+    }
+
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    auto min(const T& container) {
+        CORE_NUMERIC_METRIC("min", container, simd::Contiguous<T>);
+        detail::require_nonempty(container, "min");
+        if constexpr (simd::Contiguous<T>) {
+            return simd::min(std::ranges::data(container), std::ranges::size(container));
+        } else {
+            element_t<T> result = *std::ranges::begin(container);
+            for (const auto& x : container)
+                if (x < result) result = x;
+            return result;
+        }
+    }
+
+    // Minimo y maximo en una pasada. En contiguo, los dos kernels SIMD sobre
+    // cada bloque de L1; en el camino generico, por pares: se comparan los dos
+    // elementos entre si y solo el menor contra min y el mayor contra max
+    // (~1.5n comparaciones en lugar de 2n).
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    minmax_result<element_t<T>> minmax(const T& container) {
+        CORE_NUMERIC_METRIC("minmax", container, simd::Contiguous<T>);
+        using Q = element_t<T>;
+        detail::require_nonempty(container, "minmax");
+
+        if constexpr (simd::Contiguous<T>) {
+            const Q* p = std::ranges::data(container);
+            const std::size_t n = std::ranges::size(container);
+            minmax_result<Q> r{p[0], p[0]};
+            for (std::size_t i = 0; i < n; i += simd::moments_block) {
+                const std::size_t len = n - i < simd::moments_block ? n - i : simd::moments_block;
+                const std::size_t k = i == 0 ? 0 : simd::skip_nan(p + i, len);
+                if (k == len) continue;
+                const Q lo = simd::min(p + i + k, len - k);
+                const Q hi = simd::max(p + i + k, len - k);
+                if (lo < r.min) r.min = lo;
+                if (hi > r.max) r.max = hi;
+            }
+            return r;
+        } else {
+            auto it = std::ranges::begin(container);
+            const auto last = std::ranges::end(container);
+            minmax_result<Q> r{*it, *it};
+            for (++it; it != last; ++it) {
+                const Q a = *it;
+                if (++it == last) {
+                    if (a < r.min) r.min = a;
+                    else if (a > r.max) r.max = a;
+                    break;
+                }
+                const Q b = *it;
+                if (a < b) {
+                    if (a < r.min) r.min = a;
+                    if (b > r.max) r.max = b;
+                } else if (b < a) {
+                    if (b < r.min) r.min = b;
+                    if (a > r.max) r.max = a;
+                } else {
+                    // Iguales o alguno NaN: los dos contra ambos extremos, como min()/max().
+                    if (a < r.min) r.min = a;
+                    if (b < r.min) r.min = b;
+                    if (a > r.max) r.max = a;
+                    if (b > r.max) r.max = b;
+                }
+            }
+            return r;
+        }
+    }
+
+    namespace detail {
+        // Filtro por umbral para top_k: los candidatos mayores que el k-esimo
+        // actual se acumulan hasta 2k y entonces se recortan con nth_element.
+        // En contiguo se descartan bloques enteros cuyo maximo (kernel SIMD) no
+        // supera el umbral, asi que tras los primeros bloques el coste es el de
+        // leer los datos.
+        inline constexpr std::size_t top_k_block = 128;
+
+        template<typename Q>
+        class top_k_filter {
+        public:
+            top_k_filter(std::size_t k, std::pmr::memory_resource* scratch)
+                : k_(k), cap_(2 * k > 256 ? 2 * k : 256), buf_(scratch) {}
+
+            bool full() const { return have_threshold_; }
+            const Q& threshold() const { return threshold_; }
+
+            void push(const Q& x) {
+                if (have_threshold_ && !(x > threshold_)) return;
+                buf_.push_back(x);
+                if (buf_.size() == cap_) shrink();
+            }
+
+            template<typename Out>
+            void result(Out& out) {
+                const std::size_t m = buf_.size() < k_ ? buf_.size() : k_;
+                std::partial_sort(buf_.begin(), buf_.begin() + static_cast<std::ptrdiff_t>(m), buf_.end(), std::greater<>{});
+                out.assign(buf_.begin(), buf_.begin() + static_cast<std::ptrdiff_t>(m));
+            }
+
+        private:
+            void shrink() {
+                const auto kth = buf_.begin() + static_cast<std::ptrdiff_t>(k_ - 1);
+                std::nth_element(buf_.begin(), kth, buf_.end(), std::greater<>{});
+                threshold_ = *kth;
+                have_threshold_ = true;
+                buf_.resize(k_);
+            }
+
+            std::size_t k_;
+            std::size_t cap_;
+            std::pmr::vector<Q> buf_;
+            Q threshold_{};
+            bool have_threshold_ = false;
+        };
+    }
+
+    // Los k mayores, de mayor a menor (con repetidos si los hay).
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    std::vector<element_t<T>> top_k(const T& container, std::size_t k) {
+        CORE_NUMERIC_METRIC("top_k", container, simd::Contiguous<T>);
+        using Q = element_t<T>;
+        std::vector<Q> out;
+        if (k == 0) return out;
+
+        detail::top_k_filter<Q> filter(k, scratch_resource());
+        if constexpr (simd::Contiguous<T>) {
+            const Q* p = std::ranges::data(container);
+            const std::size_t n = std::ranges::size(container);
+            constexpr std::size_t B = detail::top_k_block;
+            std::size_t i = 0;
+            for (; i + B <= n; i += B) {
+                if (filter.full() && !(simd::max(p + i, B) > filter.threshold())) continue;
+                for (std::size_t j = 0; j < B; ++j) filter.push(p[i + j]);
+            }
+            for (; i < n; ++i) filter.push(p[i]);
+        } else {
+            for (const auto& x : container) filter.push(x);
+        }
+        filter.result(out);
+        return out;
+    }
+
+    // Variantes paralelas: mismos bloques que el resto de reducciones y
+    // parciales combinados en orden (argmax/argmin conservan el primer indice).
+    template<ExecutionPolicy P, Iterable T>
+    requires Comparable<element_t<T>>
+    std::size_t argmax(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return argmax(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("argmax", container, simd::Contiguous<T>);
+            detail::require_nonempty(container, "argmax");
+            const auto first = std::ranges::begin(container);
+            return detail::parallel_reduce(policy, container,
+                [&](const auto& part) {
+                    const std::size_t i = detail::arg_extreme<std::greater<>>(part);
+                    return std::pair<std::size_t, element_t<T>>(static_cast<std::size_t>(part.first - first) + i, part[i]);
+                },
+                [](const auto& a, const auto& b) { return b.second > a.second ? b : a; }).first;
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Comparable<element_t<T>>
+    std::size_t argmin(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return argmin(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("argmin", container, simd::Contiguous<T>);
+            detail::require_nonempty(container, "argmin");
+            const auto first = std::ranges::begin(container);
+            return detail::parallel_reduce(policy, container,
+                [&](const auto& part) {
+                    const std::size_t i = detail::arg_extreme<std::less<>>(part);
+                    return std::pair<std::size_t, element_t<T>>(static_cast<std::size_t>(part.first - first) + i, part[i]);
+                },
+                [](const auto& a, const auto& b) { return b.second < a.second ? b : a; }).first;
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Comparable<element_t<T>>
+    minmax_result<element_t<T>> minmax(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return minmax(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("minmax", container, simd::Contiguous<T>);
+            detail::require_nonempty(container, "minmax");
+            return detail::parallel_reduce(policy, container,
+                [](const auto& part) { return minmax(part); },
+                [](auto a, const auto& b) {
+                    if (b.min < a.min) a.min = b.min;
+                    if (b.max > a.max) a.max = b.max;
+                    return a;
+                });
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Comparable<element_t<T>>
+    std::vector<element_t<T>> top_k(P&& policy, const T& container, std::size_t k) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return top_k(container, k);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("top_k", container, simd::Contiguous<T>);
+            return detail::parallel_reduce(policy, container,
+                [k](const auto& part) { return top_k(part, k); },
+                [k](const auto& a, const auto& b) {
+                    std::vector<element_t<T>> r(a.size() + b.size());
+                    std::merge(a.begin(), a.end(), b.begin(), b.end(), r.begin(), std::greater<>{});
+                    if (r.size() > k) r.resize(k);
+                    return r;
+                });
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_EXTREMA_H
@@ -0,0 +1,174 @@
+#ifndef CORE_NUMERIC_GPU_H
+#define CORE_NUMERIC_GPU_H
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Backend CUDA para datos que ya estan en la memoria del dispositivo: con
+// execution::device las reducciones corren en la GPU y solo vuelven al host
+// los parciales de cada bloque (unos KB), nunca los datos.
+//
+//     cn::device_span<const double> x(d_ptr, n);   // d_ptr de cudaMalloc
+//     double s = cn::sum(cn::execution::device, x);
+//     auto m = cn::moments(cn::execution::device.on(stream), x);
+//
+// Solo se incluye desde core_numeric.h con CORE_NUMERIC_CUDA definido
+// (opcion CMake CORE_NUMERIC_CUDA, que compila src/gpu.cu con nvcc y enlaza
+// CUDA::cudart). Esta cabecera no incluye la runtime de CUDA, asi que se
+// puede usar desde TUs de C++ normales; transform_reduce con lambdas de
+// dispositivo esta en gpu_reduce.cuh y necesita nvcc --extended-lambda.
+//
+// Cada hilo reduce en double (tambien con float) su tramo de la rejilla, el
+// bloque combina con __shfl_down_sync y un segundo lanzamiento de un solo
+// bloque combina los parciales. El arbol solo depende de n y del numero de
+// bloques, asi que en un mismo dispositivo el resultado es reproducible.
+// Tolerancia frente a la CPU (eps del tipo de la suma, double):
+//   sum, mean  : |gpu - cpu| <= 2 * n * eps * sum|x|; en la practica del
+//                orden de (n / (bloques * 256) + 64) * eps * sum|x|
+//   variance   : Welford por hilo y Chan en el arbol, mismo orden relativo
+//                que moments() en la CPU
+//   max, min, argmax, argmin : exactos (mismo elemento, el primer indice en
+//                empates); sin NaN en la entrada, como en la CPU
+// Los errores de CUDA se devuelven como std::runtime_error.
+struct CUstream_st;
+
+namespace core_numeric {
+
+    template<typename Q>
+    struct moments_state;
+
+    namespace execution {
+        struct device_policy {
+            CUstream_st* stream = nullptr; // nullptr: stream por defecto
+            unsigned blocks = 0;           // 0: 4 por SM
+
+            constexpr device_policy on(CUstream_st* s) const { return {s, blocks}; }
+            constexpr device_policy grid(unsigned b) const { return {stream, b}; }
+        };
+
+        inline constexpr device_policy device{};
+    }
+
+    // Rango en memoria del dispositivo; en el host no se desreferencia.
+    template<typename Q>
+    class device_span {
+    public:
+        using element_type = Q;
+
+        constexpr device_span() = default;
+        constexpr device_span(Q* data, std::size_t size) : data_(data), size_(size) {}
+
+        template<typename U>
+        requires std::is_convertible_v<U (*)[], Q (*)[]>
+        constexpr device_span(device_span<U> other) : data_(other.data()), size_(other.size()) {}
+
+        constexpr Q* data() const { return data_; }
+        constexpr std::size_t size() const { return size_; }
+        constexpr bool empty() const { return size_ == 0; }
+
+    private:
+        Q* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    namespace detail::gpu {
+        // Estado de moments() en el dispositivo, sin dependencias de moments.h.
+        struct moments2 {
+            std::size_t count;
+            double mean;
+            double m2;
+            double min;
+            double max;
+        };
+
+        double sum(const execution::device_policy& policy, const double* x, std::size_t n);
+        double sum(const execution::device_policy& policy, const float* x, std::size_t n);
+        moments2 moments(const execution::device_policy& policy, const double* x, std::size_t n);
+        moments2 moments(const execution::device_policy& policy, const float* x, std::size_t n);
+        std::size_t argmax(const execution::device_policy& policy, const double* x, std::size_t n);
+        std::size_t argmax(const execution::device_policy& policy, const float* x, std::size_t n);
+        std::size_t argmin(const execution::device_policy& policy, const double* x, std::size_t n);
+        std::size_t argmin(const execution::device_policy& policy, const float* x, std::size_t n);
+        // Copia un elemento al host (para max/min a partir del indice).
+        void load(const execution::device_policy& policy, void* out, const void* at, std::size_t bytes);
+
+        // double o float, con o sin const.
+        template<typename Q>
+        concept DeviceElement = std::is_same_v<std::remove_const_t<Q>, double> ||
+                                std::is_same_v<std::remove_const_t<Q>, float>;
+
+        template<typename Q>
+        void require_nonempty(device_span<Q> x, const char* what) {
+            if (x.empty()) throw std::invalid_argument(std::string(what) + ": empty range");
+        }
+
+        template<typename Q>
+        std::remove_const_t<Q> element(const execution::device_policy& policy, device_span<Q> x, std::size_t i) {
+            std::remove_const_t<Q> v;
+            load(policy, &v, x.data() + i, sizeof(v));
+            return v;
+        }
+    }
+
+    template<detail::gpu::DeviceElement Q>
+    std::remove_const_t<Q> sum(const execution::device_policy& policy, device_span<Q> x) {
+        return static_cast<std::remove_const_t<Q>>(detail::gpu::sum(policy, x.data(), x.size()));
+    }
+
+    // Vacio: NaN, como la media de flotantes en la CPU.
+    template<detail::gpu::DeviceElement Q>
+    double mean(const execution::device_policy& policy, device_span<Q> x) {
+        return detail::gpu::sum(policy, x.data(), x.size()) / static_cast<double>(x.size());
+    }
+
+    template<detail::gpu::DeviceElement Q>
+    double variance(const execution::device_policy& policy, device_span<Q> x, std::size_t ddof = 0) {
+        const auto m = detail::gpu::moments(policy, x.data(), x.size());
+        if (m.count <= ddof) return std::numeric_limits<double>::quiet_NaN();
+        return m.m2 / static_cast<double>(m.count - ddof);
+    }
+
+    // Orden 2: count, mean, m2, min y max (m3 y m4 quedan en cero).
+    template<detail::gpu::DeviceElement Q>
+    moments_state<std::remove_const_t<Q>> moments(const execution::device_policy& policy, device_span<Q> x) {
+        using V = std::remove_const_t<Q>;
+        const auto m = detail::gpu::moments(policy, x.data(), x.size());
+        moments_state<V> s;
+        s.count = m.count;
+        if (m.count == 0) return s;
+        s.mean = m.mean;
+        s.m2 = m.m2;
+        s.min = static_cast<V>(m.min); // exacto: vino de Q
+        s.max = static_cast<V>(m.max);
+        return s;
+    }
+
+    template<detail::gpu::DeviceElement Q>
+    std::size_t argmax(const execution::device_policy& policy, device_span<Q> x) {
+        detail::gpu::require_nonempty(x, "argmax");
+        return detail::gpu::argmax(policy, x.data(), x.size());
+    }
+
+    template<detail::gpu::DeviceElement Q>
+    std::size_t argmin(const execution::device_policy& policy, device_span<Q> x) {
+        detail::gpu::require_nonempty(x, "argmin");
+        return detail::gpu::argmin(policy, x.data(), x.size());
+    }
+
+    template<detail::gpu::DeviceElement Q>
+    std::remove_const_t<Q> max(const execution::device_policy& policy, device_span<Q> x) {
+        detail::gpu::require_nonempty(x, "max");
+        return detail::gpu::element(policy, x, detail::gpu::argmax(policy, x.data(), x.size()));
+    }
+
+    template<detail::gpu::DeviceElement Q>
+    std::remove_const_t<Q> min(const execution::device_policy& policy, device_span<Q> x) {
+        detail::gpu::require_nonempty(x, "min");
+        return detail::gpu::element(policy, x, detail::gpu::argmin(policy, x.data(), x.size()));
+    }
+}
+
+#endif // CORE_NUMERIC_GPU_H
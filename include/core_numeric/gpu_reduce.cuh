@@ -0,0 +1,158 @@
+#ifndef CORE_NUMERIC_GPU_REDUCE_CUH
+#define CORE_NUMERIC_GPU_REDUCE_CUH
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <cuda_runtime.h>
+
+#include "core_numeric/gpu.h"
+
+// Reduccion generica en el dispositivo (ver gpu.h). Solo para TUs que compila
+// nvcc; las lambdas de dispositivo necesitan --extended-lambda:
+//
+//     double sq = cn::transform_reduce(cn::execution::device, x, 0.0,
+//         [] __device__ (double a, double b) { return a + b; },
+//         [] __device__ (double v) { return v * v; });
+namespace core_numeric {
+
+    namespace detail::gpu {
+        inline constexpr unsigned block_threads = 256;
+        inline constexpr unsigned warp_threads = 32;
+        inline constexpr unsigned warps_per_block = block_threads / warp_threads;
+        inline constexpr unsigned blocks_per_sm = 4;
+
+        inline void check(cudaError_t rc, const char* what) {
+            if (rc != cudaSuccess)
+                throw std::runtime_error(std::string("core_numeric gpu: ") + what + ": " + cudaGetErrorString(rc));
+        }
+
+        inline cudaStream_t stream_of(const execution::device_policy& policy) {
+            return policy.stream; // cudaStream_t es CUstream_st*
+        }
+
+        // Bloques de la rejilla: policy.blocks o blocks_per_sm por SM, sin
+        // pasar de uno por cada block_threads elementos.
+        inline unsigned grid_size(const execution::device_policy& policy, std::size_t n) {
+            unsigned blocks = policy.blocks;
+            if (blocks == 0) {
+                int device = 0, sms = 0;
+                check(cudaGetDevice(&device), "cudaGetDevice");
+                check(cudaDeviceGetAttribute(&sms, cudaDevAttrMultiProcessorCount, device), "cudaDeviceGetAttribute");
+                blocks = blocks_per_sm * static_cast<unsigned>(sms);
+            }
+            const std::size_t needed = (n + block_threads - 1) / block_threads;
+            if (needed < blocks) blocks = static_cast<unsigned>(needed);
+            return blocks < 1 ? 1 : blocks;
+        }
+
+        // __shfl_down_sync por palabras de 32 bits, para cualquier R trivial.
+        template<typename R>
+        __device__ R shfl_down(const R& v, unsigned delta) {
+            static_assert(std::is_trivially_copyable_v<R>, "transform_reduce: result must be trivially copyable");
+            constexpr unsigned words = (sizeof(R) + 3) / 4;
+            int buf[words];
+            std::memcpy(buf, &v, sizeof(R));
+            for (unsigned i = 0; i < words; ++i) buf[i] = __shfl_down_sync(0xffffffffu, buf[i], delta);
+            R r;
+            std::memcpy(&r, buf, sizeof(R));
+            return r;
+        }
+
+        template<typename R, typename Op>
+        __device__ R warp_reduce(R v, Op combine) {
+            for (unsigned offset = warp_threads / 2; offset > 0; offset /= 2) v = combine(v, shfl_down(v, offset));
+            return v;
+        }
+
+        // Resultado valido solo en el hilo 0. blockDim.x == block_threads.
+        template<typename R, typename Op>
+        __device__ R block_reduce(R v, const R& identity, Op combine) {
+            // Memoria sin constructor: __shared__ no admite inicializadores.
+            struct alignas(R) storage {
+                unsigned char bytes[warps_per_block * sizeof(R)];
+            };
+            __shared__ storage raw;
+            R* parts = reinterpret_cast<R*>(raw.bytes);
+            const unsigned lane = threadIdx.x % warp_threads;
+            const unsigned warp = threadIdx.x / warp_threads;
+
+            v = warp_reduce(v, combine);
+            if (lane == 0) std::memcpy(&parts[warp], &v, sizeof(R));
+            __syncthreads();
+            if (warp == 0) {
+                v = identity;
+                if (lane < warps_per_block) std::memcpy(&v, &parts[lane], sizeof(R));
+                v = warp_reduce(v, combine);
+            }
+            return v;
+        }
+
+        // at(i) da el valor ya transformado del elemento i; cada hilo recorre
+        // la rejilla con paso fijo, asi las lecturas de un warp son contiguas.
+        template<typename R, typename Op, typename At>
+        __global__ void reduce_blocks(std::size_t n, R identity, Op combine, At at, R* partials) {
+            R acc = identity;
+            const std::size_t stride = static_cast<std::size_t>(gridDim.x) * blockDim.x;
+            for (std::size_t i = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < n; i += stride)
+                acc = combine(acc, at(i));
+            acc = block_reduce(acc, identity, combine);
+            if (threadIdx.x == 0) partials[blockIdx.x] = acc;
+        }
+
+        template<typename R, typename Op>
+        __global__ void reduce_partials(unsigned blocks, R identity, Op combine, const R* partials, R* out) {
+            R acc = identity;
+            for (unsigned i = threadIdx.x; i < blocks; i += blockDim.x) acc = combine(acc, partials[i]);
+            acc = block_reduce(acc, identity, combine);
+            if (threadIdx.x == 0) *out = acc;
+        }
+
+        // Dos lanzamientos en policy.stream y una sola copia de sizeof(R) al host.
+        template<typename R, typename Op, typename At>
+        R reduce_indices(const execution::device_policy& policy, std::size_t n, R identity, Op combine, At at) {
+            if (n == 0) return identity;
+            const cudaStream_t stream = stream_of(policy);
+            const unsigned blocks = grid_size(policy, n);
+
+            R* scratch = nullptr;
+            check(cudaMallocAsync(reinterpret_cast<void**>(&scratch), (blocks + 1) * sizeof(R), stream), "cudaMallocAsync");
+            reduce_blocks<<<blocks, block_threads, 0, stream>>>(n, identity, combine, at, scratch);
+            cudaError_t rc = cudaGetLastError();
+            if (rc == cudaSuccess) {
+                reduce_partials<<<1, block_threads, 0, stream>>>(blocks, identity, combine, scratch, scratch + blocks);
+                rc = cudaGetLastError();
+            }
+            R result = identity;
+            if (rc == cudaSuccess) rc = cudaMemcpyAsync(&result, scratch + blocks, sizeof(R), cudaMemcpyDeviceToHost, stream);
+            const cudaError_t freed = cudaFreeAsync(scratch, stream);
+            if (rc == cudaSuccess) rc = freed;
+            if (rc == cudaSuccess) rc = cudaStreamSynchronize(stream);
+            check(rc, "reduce");
+            return result;
+        }
+
+        template<typename T, typename F>
+        struct transformed {
+            const T* x;
+            F func;
+
+            __device__ auto operator()(std::size_t i) const { return func(x[i]); }
+        };
+    }
+
+    // Como transform_reduce(c, identity, combine, func) en la CPU: combine
+    // asociativa y conmutativa, identity su neutro. combine y func se llaman
+    // en el dispositivo.
+    template<typename T, typename R, typename Op, typename F>
+    R transform_reduce(const execution::device_policy& policy, device_span<T> x, R identity, Op combine, F func) {
+        using E = std::remove_const_t<T>;
+        return detail::gpu::reduce_indices(policy, x.size(), identity, combine,
+                                           detail::gpu::transformed<E, F>{x.data(), func});
+    }
+}
+
+#endif // CORE_NUMERIC_GPU_REDUCE_CUH
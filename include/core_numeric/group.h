@@ -0,0 +1,424 @@
+#ifndef CORE_NUMERIC_GROUP_H
+#define CORE_NUMERIC_GROUP_H
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/accumulator.h"
+#include "core_numeric/concepts.h"
+#include "core_numeric/memory.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/parallel.h"
+
+namespace core_numeric {
+
+    // Claves de group_reduce: enteros y enums, o cualquier tipo con std::hash.
+    template<typename K>
+    concept GroupKey =
+        std::equality_comparable<K> && std::default_initializable<K> && std::copyable<K> &&
+        (std::is_integral_v<K> || std::is_enum_v<K> ||
+         requires (const K& k) { {std::hash<K>{}(k)} -> std::convertible_to<std::size_t>; });
+
+    namespace detail {
+        // fmix64 de MurmurHash3: los bits bajos indexan la tabla y los altos
+        // eligen particion, asi que tienen que depender de toda la clave.
+        template<typename K>
+        std::uint64_t group_hash(const K& key) {
+            std::uint64_t h;
+            if constexpr (std::is_integral_v<K> || std::is_enum_v<K>) h = static_cast<std::uint64_t>(key);
+            else h = static_cast<std::uint64_t>(std::hash<K>{}(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // Filas por lote: primero se resuelve el grupo de todas y luego se
+        // actualiza cada columna en un lazo propio.
+        inline constexpr std::size_t group_block = 256;
+
+        // Particiones de la agregacion paralela (bits altos del hash).
+        inline constexpr unsigned group_partition_bits = 6;
+
+        template<typename Table, typename KIt, typename VIt>
+        Table partitioned_group_reduce(const execution::parallel_policy& policy, KIt keys, VIt values, std::size_t n);
+    }
+
+    // Tabla GROUP BY clave -> estadisticos S. Direccionamiento abierto con
+    // sondeo lineal sobre indices de 32 bits (carga <= 1/2); el estado de los
+    // grupos va en columnas densas (SoA) en orden de primera aparicion, asi
+    // cada estadistico es un vector recorrido solo por su propio lazo.
+    //
+    // La varianza se lleva desplazada por el primer valor de cada grupo
+    // (sum (x - x0) y sum (x - x0)^2): sin divisiones por fila y sin la
+    // cancelacion de sum x^2 - (sum x)^2 / n mientras x0 este cerca de la
+    // media del grupo. table[g] y at(key) devuelven el accumulator<Q, S> del
+    // grupo, con la misma interfaz que describe().
+    template<GroupKey K, typename Q, stats S>
+    class group_table {
+        static_assert(!has(S, stats::quantiles), "group_table: stats::quantiles is not supported per group");
+
+        static constexpr bool needs_moments = has(S, stats::variance);
+        using sum_t = detail::wide_t<Q>;
+        using mean_sum_t = std::conditional_t<std::is_integral_v<Q>, sum_t, double>;
+
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        group_table() = default;
+
+        explicit group_table(std::size_t expected_groups) { reserve(expected_groups); }
+
+        void reserve(std::size_t groups) {
+            keys_.reserve(groups);
+            hashes_.reserve(groups);
+            count_.reserve(groups);
+            if (2 * groups > slots_.size()) rehash(std::bit_ceil(2 * groups));
+        }
+
+        std::size_t size() const { return keys_.size(); }
+        bool empty() const { return keys_.empty(); }
+
+        // Claves en el orden de sus grupos (primera aparicion).
+        std::span<const K> keys() const { return keys_; }
+
+        std::size_t find(const K& key) const {
+            if (slots_.empty()) return npos;
+            const std::uint64_t h = detail::group_hash(key);
+            for (std::size_t i = h & mask_;; i = (i + 1) & mask_) {
+                const std::uint32_t s = slots_[i];
+                if (s == 0) return npos;
+                if (hashes_[s - 1] == h && keys_[s - 1] == key) return s - 1;
+            }
+        }
+
+        void push(const K& key, Q x) {
+            const std::uint32_t g = group_of(key, detail::group_hash(key), x);
+            update(&g, &x, 1);
+        }
+
+        // Lanza std::invalid_argument si keys y xs no tienen el mismo tamano.
+        void push(std::span<const K> keys, std::span<const Q> xs) {
+            if (keys.size() != xs.size()) throw std::invalid_argument("group_table::push: keys and values differ in size");
+            std::uint64_t h[detail::group_block];
+            for (std::size_t i = 0; i < keys.size(); i += detail::group_block) {
+                const std::size_t len = std::min(detail::group_block, keys.size() - i);
+                for (std::size_t j = 0; j < len; ++j) h[j] = detail::group_hash(keys[i + j]);
+                push_hashed(keys.data() + i, h, xs.data() + i, len);
+            }
+        }
+
+        // Combina otra tabla; las claves nuevas se anaden al final en su orden.
+        void merge(const group_table& other) {
+            for (std::size_t b = 0; b < other.size(); ++b) {
+                const std::size_t before = size();
+                const std::size_t a = insert(other.keys_[b], other.hashes_[b]);
+                if (a == before) {
+                    copy_group(other, b);
+                } else {
+                    merge_group(a, other, b);
+                }
+            }
+        }
+
+        std::size_t count(std::size_t g) const { return count_[g]; }
+
+        accumulator<Q, S> operator[](std::size_t g) const {
+            return accumulator<Q, S>::from_state(count_[g], sum_of(g), mean_sum_of(g), state_of(g));
+        }
+
+        // Lanza std::out_of_range si la clave no tiene grupo.
+        accumulator<Q, S> at(const K& key) const {
+            const std::size_t g = find(key);
+            if (g == npos) throw std::out_of_range("group_table::at: unknown key");
+            return (*this)[g];
+        }
+
+    private:
+        template<typename Table, typename KIt, typename VIt>
+        friend Table detail::partitioned_group_reduce(const execution::parallel_policy&, KIt, VIt, std::size_t);
+
+        // Indice del grupo de key; si no existe lo crea con columnas a cero.
+        std::size_t insert(const K& key, std::uint64_t h) {
+            if (2 * (size() + 1) > slots_.size()) rehash(slots_.empty() ? 16 : 2 * slots_.size());
+            std::size_t i = h & mask_;
+            for (;; i = (i + 1) & mask_) {
+                const std::uint32_t s = slots_[i];
+                if (s == 0) break;
+                if (hashes_[s - 1] == h && keys_[s - 1] == key) return s - 1;
+            }
+            const std::size_t g = size();
+            slots_[i] = static_cast<std::uint32_t>(g + 1);
+            keys_.push_back(key);
+            hashes_.push_back(h);
+            count_.push_back(0);
+            if constexpr (has(S, stats::sum)) sum_.push_back(sum_t{});
+            if constexpr (has(S, stats::mean)) mean_sum_.push_back(mean_sum_t{});
+            if constexpr (needs_moments) {
+                shift_.push_back(0.0);
+                s1_.push_back(0.0);
+                s2_.push_back(0.0);
+            }
+            if constexpr (has(S, stats::min)) min_.push_back(Q{});
+            if constexpr (has(S, stats::max)) max_.push_back(Q{});
+            return g;
+        }
+
+        // Como insert, pero un grupo nuevo arranca con x como min, max y desplazamiento.
+        std::uint32_t group_of(const K& key, std::uint64_t h, Q x) {
+            const std::size_t before = size();
+            const std::size_t g = insert(key, h);
+            if (g == before) {
+                if constexpr (needs_moments) shift_[g] = static_cast<double>(x);
+                if constexpr (has(S, stats::min)) min_[g] = x;
+                if constexpr (has(S, stats::max)) max_[g] = x;
+            }
+            return static_cast<std::uint32_t>(g);
+        }
+
+        void push_hashed(const K* keys, const std::uint64_t* h, const Q* xs, std::size_t n) {
+            std::uint32_t ids[detail::group_block];
+            for (std::size_t i = 0; i < n; i += detail::group_block) {
+                const std::size_t len = std::min(detail::group_block, n - i);
+                for (std::size_t j = 0; j < len; ++j) ids[j] = group_of(keys[i + j], h[i + j], xs[i + j]);
+                update(ids, xs + i, len);
+            }
+        }
+
+        // Una columna por lazo; cada grupo ve sus filas en el orden de entrada.
+        void update(const std::uint32_t* ids, const Q* x, std::size_t len) {
+            for (std::size_t j = 0; j < len; ++j) ++count_[ids[j]];
+            if constexpr (has(S, stats::sum))
+                for (std::size_t j = 0; j < len; ++j) sum_[ids[j]] += x[j];
+            if constexpr (has(S, stats::mean))
+                for (std::size_t j = 0; j < len; ++j) mean_sum_[ids[j]] += static_cast<mean_sum_t>(x[j]);
+            if constexpr (needs_moments)
+                for (std::size_t j = 0; j < len; ++j) {
+                    const std::uint32_t g = ids[j];
+                    const double d = static_cast<double>(x[j]) - shift_[g];
+                    s1_[g] += d;
+                    s2_[g] += d * d;
+                }
+            if constexpr (has(S, stats::min))
+                for (std::size_t j = 0; j < len; ++j) if (x[j] < min_[ids[j]]) min_[ids[j]] = x[j];
+            if constexpr (has(S, stats::max))
+                for (std::size_t j = 0; j < len; ++j) if (x[j] > max_[ids[j]]) max_[ids[j]] = x[j];
+        }
+
+        void copy_group(const group_table& other, std::size_t b) {
+            const std::size_t a = size() - 1;
+            count_[a] = other.count_[b];
+            if constexpr (has(S, stats::sum)) sum_[a] = other.sum_[b];
+            if constexpr (has(S, stats::mean)) mean_sum_[a] = other.mean_sum_[b];
+            if constexpr (needs_moments) {
+                shift_[a] = other.shift_[b];
+                s1_[a] = other.s1_[b];
+                s2_[a] = other.s2_[b];
+            }
+            if constexpr (has(S, stats::min)) min_[a] = other.min_[b];
+            if constexpr (has(S, stats::max)) max_[a] = other.max_[b];
+        }
+
+        void merge_group(std::size_t a, const group_table& other, std::size_t b) {
+            if constexpr (needs_moments) {
+                // Chan sobre (n, media, M2) y vuelta a la forma desplazada por la media.
+                const auto m = core_numeric::merge(state_of(a), other.state_of(b));
+                shift_[a] = m.mean;
+                s1_[a] = 0.0;
+                s2_[a] = m.m2;
+            }
+            count_[a] += other.count_[b];
+            if constexpr (has(S, stats::sum)) sum_[a] += other.sum_[b];
+            if constexpr (has(S, stats::mean)) mean_sum_[a] += other.mean_sum_[b];
+            if constexpr (has(S, stats::min)) if (other.min_[b] < min_[a]) min_[a] = other.min_[b];
+            if constexpr (has(S, stats::max)) if (other.max_[b] > max_[a]) max_[a] = other.max_[b];
+        }
+
+        sum_t sum_of(std::size_t g) const {
+            if constexpr (has(S, stats::sum)) return sum_[g];
+            else return sum_t{};
+        }
+
+        mean_sum_t mean_sum_of(std::size_t g) const {
+            if constexpr (has(S, stats::mean)) return mean_sum_[g];
+            else return mean_sum_t{};
+        }
+
+        moments_state<Q> state_of(std::size_t g) const {
+            moments_state<Q> m;
+            m.count = count_[g];
+            if constexpr (needs_moments) {
+                const double n = static_cast<double>(count_[g]);
+                m.mean = shift_[g] + s1_[g] / n;
+                m.m2 = std::max(0.0, s2_[g] - s1_[g] * s1_[g] / n);
+            }
+            if constexpr (has(S, stats::min)) m.min = min_[g];
+            if constexpr (has(S, stats::max)) m.max = max_[g];
+            return m;
+        }
+
+        void rehash(std::size_t capacity) {
+            slots_.assign(capacity, 0);
+            mask_ = capacity - 1;
+            for (std::size_t g = 0; g < size(); ++g) {
+                std::size_t i = hashes_[g] & mask_;
+                while (slots_[i] != 0) i = (i + 1) & mask_;
+                slots_[i] = static_cast<std::uint32_t>(g + 1);
+            }
+        }
+
+        std::vector<std::uint32_t> slots_; // 0: libre; g + 1: grupo g
+        std::size_t mask_ = 0;
+
+        std::vector<K> keys_;
+        std::vector<std::uint64_t> hashes_;
+        std::vector<std::size_t> count_;
+        std::vector<sum_t> sum_;
+        std::vector<mean_sum_t> mean_sum_;
+        std::vector<double> shift_;
+        std::vector<double> s1_;
+        std::vector<double> s2_;
+        std::vector<Q> min_;
+        std::vector<Q> max_;
+    };
+
+    namespace detail {
+        template<typename C>
+        concept Rows = std::ranges::contiguous_range<const C> && std::ranges::sized_range<const C>;
+
+        template<typename K, typename V>
+        void require_same_rows(const K& keys, const V& values) {
+            if constexpr (std::ranges::sized_range<const K> && std::ranges::sized_range<const V>)
+                if (std::ranges::size(keys) != std::ranges::size(values))
+                    throw std::invalid_argument("group_reduce: keys and values differ in size");
+        }
+
+        // Agregacion particionada: (1) cada bloque cuenta sus filas por
+        // particion, (2) se reparten en buffers contiguos por particion
+        // conservando el orden de entrada, (3) cada particion se agrega en su
+        // propia tabla y (4) las tablas, con claves disjuntas, se concatenan.
+        // Cada grupo ve sus filas en el mismo orden que en serie, asi que los
+        // resultados coinciden bit a bit; solo cambia el orden de keys().
+        template<typename Table, typename KIt, typename VIt>
+        Table partitioned_group_reduce(const execution::parallel_policy& policy, KIt keys, VIt values, std::size_t n) {
+            using K = std::iter_value_t<KIt>;
+            using Q = std::iter_value_t<VIt>;
+            constexpr std::size_t parts = std::size_t{1} << group_partition_bits;
+            const auto part_of = [](std::uint64_t h) { return static_cast<std::size_t>(h >> (64 - group_partition_bits)); };
+
+            auto& pool = pool_of(policy);
+            const std::size_t chunks = chunk_count(policy, n);
+            const auto bound = [&](std::size_t c) { return n * c / chunks; };
+            CORE_NUMERIC_METRIC_THREADS(chunks < pool.size() ? chunks : pool.size());
+
+            std::pmr::vector<std::uint64_t> hash(n, scratch_resource());
+            std::pmr::vector<std::size_t> offset(chunks * parts, 0, scratch_resource());
+            pool.parallel_for(chunks, [&](std::size_t c) {
+                CORE_NUMERIC_METRIC_QUIET();
+                std::size_t* count = offset.data() + c * parts;
+                for (std::size_t i = bound(c); i < bound(c + 1); ++i) {
+                    hash[i] = group_hash(keys[static_cast<std::ptrdiff_t>(i)]);
+                    ++count[part_of(hash[i])];
+                }
+            });
+
+            // Particion por particion y, dentro, bloque por bloque.
+            std::pmr::vector<std::size_t> start(parts + 1, 0, scratch_resource());
+            std::size_t total = 0;
+            for (std::size_t p = 0; p < parts; ++p) {
+                start[p] = total;
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    const std::size_t k = offset[c * parts + p];
+                    offset[c * parts + p] = total;
+                    total += k;
+                }
+            }
+            start[parts] = total;
+
+            std::pmr::vector<K> pk(n, scratch_resource());
+            std::pmr::vector<std::uint64_t> ph(n, scratch_resource());
+            std::pmr::vector<Q> pv(n, scratch_resource());
+            pool.parallel_for(chunks, [&](std::size_t c) {
+                CORE_NUMERIC_METRIC_QUIET();
+                std::size_t* next = offset.data() + c * parts;
+                for (std::size_t i = bound(c); i < bound(c + 1); ++i) {
+                    const std::size_t o = next[part_of(hash[i])]++;
+                    pk[o] = keys[static_cast<std::ptrdiff_t>(i)];
+                    ph[o] = hash[i];
+                    pv[o] = values[static_cast<std::ptrdiff_t>(i)];
+                }
+            });
+
+            std::vector<Table> tables(parts);
+            pool.parallel_for(parts, [&](std::size_t p) {
+                CORE_NUMERIC_METRIC_QUIET();
+                tables[p].push_hashed(pk.data() + start[p], ph.data() + start[p], pv.data() + start[p], start[p + 1] - start[p]);
+            });
+
+            std::size_t groups = 0;
+            for (const auto& t : tables) groups += t.size();
+            Table result(groups);
+            for (const auto& t : tables) result.merge(t);
+            return result;
+        }
+    }
+
+    // group_reduce<stats::mean, stats::variance>(keys, values): un grupo por
+    // clave distinta. Lanza std::invalid_argument si keys y values no tienen
+    // el mismo numero de elementos.
+    template<stats... S, Iterable K, Iterable V>
+    requires (sizeof...(S) > 0) && GroupKey<element_t<K>> && Addable<element_t<V>>
+    auto group_reduce(const K& keys, const V& values) {
+        CORE_NUMERIC_METRIC("group_reduce", values, false);
+        using Key = element_t<K>;
+        using Q = element_t<V>;
+        detail::require_same_rows(keys, values);
+        group_table<Key, Q, (stats::none | ... | S)> table;
+
+        if constexpr (detail::Rows<K> && detail::Rows<V>) {
+            table.push(std::span<const Key>(std::ranges::data(keys), std::ranges::size(keys)),
+                       std::span<const Q>(std::ranges::data(values), std::ranges::size(values)));
+        } else {
+            auto k = std::ranges::begin(keys);
+            auto v = std::ranges::begin(values);
+            const auto k_end = std::ranges::end(keys);
+            const auto v_end = std::ranges::end(values);
+            for (; k != k_end && v != v_end; ++k, ++v) table.push(*k, *v);
+            if (k != k_end || v != v_end) throw std::invalid_argument("group_reduce: keys and values differ in size");
+        }
+        return table;
+    }
+
+    template<stats... S, ExecutionPolicy P, Iterable K, Iterable V>
+    requires (sizeof...(S) > 0) && GroupKey<element_t<K>> && Addable<element_t<V>>
+    auto group_reduce(P&& policy, const K& keys, const V& values) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<K> || !detail::Splittable<V>) {
+            return group_reduce<S...>(keys, values);
+        } else {
+            const std::size_t n = std::ranges::size(values);
+            detail::require_same_rows(keys, values);
+            if (detail::chunk_count(policy, n) == 1) return group_reduce<S...>(keys, values);
+            CORE_NUMERIC_METRIC_PAR("group_reduce", values, false);
+            using Table = group_table<element_t<K>, element_t<V>, (stats::none | ... | S)>;
+            return detail::partitioned_group_reduce<Table>(policy, std::ranges::begin(keys), std::ranges::begin(values), n);
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_GROUP_H
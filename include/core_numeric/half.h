@@ -0,0 +1,116 @@
+#ifndef CORE_NUMERIC_HALF_H
+#define CORE_NUMERIC_HALF_H
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+
+// Flotantes de 16 bits para datos de aprendizaje automatico y sensores:
+// float16 (IEEE 754 binary16) y bfloat16 (los 16 bits altos de un float).
+// Son solo almacenamiento: se leen ensanchando a float sin perdida y las
+// reducciones acumulan en float / double, nunca en 16 bits. Con <stdfloat>
+// (C++23) tambien se aceptan std::float16_t y std::bfloat16_t, que tienen la
+// misma representacion.
+namespace core_numeric {
+
+    namespace detail {
+        constexpr float half_to_float(std::uint16_t h) {
+            constexpr std::uint32_t shifted_exp = 0x7c00u << 13;
+            std::uint32_t u = (h & 0x7fffu) << 13;
+            const std::uint32_t exp = u & shifted_exp;
+            u += (127 - 15) << 23;
+            if (exp == shifted_exp) {
+                u += (128 - 16) << 23; // inf / NaN
+            } else if (exp == 0) {
+                // Subnormal: se normaliza restando 2^-14 en coma flotante.
+                u += 1 << 23;
+                u = std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) - std::bit_cast<float>(113u << 23));
+            }
+            return std::bit_cast<float>(u | (static_cast<std::uint32_t>(h & 0x8000u) << 16));
+        }
+
+        // Redondeo al par mas cercano; NaN sigue siendo NaN (silencioso).
+        constexpr std::uint16_t float_to_half(float f) {
+            std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+            const std::uint32_t sign = u & 0x80000000u;
+            u ^= sign;
+            std::uint32_t h;
+            if (u >= (127u + 16) << 23) {
+                h = u > 0x7f800000u ? 0x7e00u : 0x7c00u;
+            } else if (u < 113u << 23) {
+                constexpr std::uint32_t magic = ((127u - 15) + (23 - 10) + 1) << 23;
+                h = std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) + std::bit_cast<float>(magic)) - magic;
+            } else {
+                const std::uint32_t odd = (u >> 13) & 1u;
+                u += ((15u - 127u) << 23) + 0xfffu + odd;
+                h = u >> 13;
+            }
+            return static_cast<std::uint16_t>(h | (sign >> 16));
+        }
+
+        constexpr float bfloat16_to_float(std::uint16_t b) {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(b) << 16);
+        }
+
+        constexpr std::uint16_t float_to_bfloat16(float f) {
+            const std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+            if ((u & 0x7fffffffu) > 0x7f800000u) return static_cast<std::uint16_t>((u >> 16) | 0x40u);
+            return static_cast<std::uint16_t>((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+        }
+    }
+
+    // La conversion desde float es explicita (redondea); hacia float es
+    // implicita y exacta, asi que comparar o sumar dos valores se hace en float.
+    struct float16 {
+        std::uint16_t bits = 0;
+
+        float16() = default;
+        constexpr explicit float16(float x) : bits(detail::float_to_half(x)) {}
+        constexpr operator float() const { return detail::half_to_float(bits); }
+
+        static constexpr float16 from_bits(std::uint16_t b) {
+            float16 h;
+            h.bits = b;
+            return h;
+        }
+    };
+
+    struct bfloat16 {
+        std::uint16_t bits = 0;
+
+        bfloat16() = default;
+        constexpr explicit bfloat16(float x) : bits(detail::float_to_bfloat16(x)) {}
+        constexpr operator float() const { return detail::bfloat16_to_float(bits); }
+
+        static constexpr bfloat16 from_bits(std::uint16_t b) {
+            bfloat16 h;
+            h.bits = b;
+            return h;
+        }
+    };
+
+    namespace detail {
+        template<typename T> struct half_storage {};
+        template<> struct half_storage<float16> { using type = float16; };
+        template<> struct half_storage<bfloat16> { using type = bfloat16; };
+#if defined(__STDCPP_FLOAT16_T__)
+        template<> struct half_storage<std::float16_t> { using type = float16; };
+#endif
+#if defined(__STDCPP_BFLOAT16_T__)
+        template<> struct half_storage<std::bfloat16_t> { using type = bfloat16; };
+#endif
+    }
+
+    template<typename T>
+    concept HalfFloat = requires { typename detail::half_storage<T>::type; };
+
+    // float16 o bfloat16 con la representacion de T: lo que leen los kernels.
+    template<HalfFloat T>
+    using half_storage_t = typename detail::half_storage<T>::type;
+}
+
+#endif // CORE_NUMERIC_HALF_H
@@ -0,0 +1,133 @@
+#ifndef CORE_NUMERIC_HISTOGRAM_H
+#define CORE_NUMERIC_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/memory.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/parallel.h"
+
+namespace core_numeric {
+
+    // Histograma de bins de igual anchura sobre [lo, hi): el bin i cubre
+    // [lower(i), lower(i) + width()). Lo que cae fuera va a underflow() /
+    // overflow() y NaN se ignora, como en ddsketch. Dos histogramas con los
+    // mismos limites se combinan sumando cuentas (merge exacto y asociativo).
+    class histogram {
+    public:
+        // Un solo bin sobre [0, 1); existe para los parciales de parallel_reduce.
+        histogram() : histogram(0.0, 1.0, 1) {}
+
+        histogram(double lo, double hi, std::size_t bins)
+            : lo_(lo), hi_(hi), scale_(static_cast<double>(bins) / (hi - lo)), counts_(bins + 2, 0) {
+            if (bins == 0) throw std::invalid_argument("histogram: bins must be positive");
+            if (!(lo < hi)) throw std::invalid_argument("histogram: need lo < hi");
+        }
+
+        template<typename Q>
+        void push(Q x) {
+            const double v = static_cast<double>(x);
+            if (v == v) ++counts_[slot(v)];
+        }
+
+        // Con muchos elementos se cuenta en cuatro copias intercaladas de la
+        // tabla: valores seguidos en el mismo bin no esperan al incremento
+        // anterior.
+        template<typename Q>
+        void push(std::span<const Q> xs) {
+            const std::size_t width = counts_.size();
+            if (xs.size() < 4 * width || width > max_split_width) {
+                for (const auto& x : xs) push(x);
+                return;
+            }
+            std::pmr::vector<std::uint64_t> split(4 * width, 0, scratch_resource());
+            std::size_t i = 0;
+            for (; i + 4 <= xs.size(); i += 4)
+                for (std::size_t j = 0; j < 4; ++j) {
+                    const double v = static_cast<double>(xs[i + j]);
+                    if (v == v) ++split[j * width + slot(v)];
+                }
+            for (; i < xs.size(); ++i) push(xs[i]);
+            for (std::size_t k = 0; k < width; ++k)
+                counts_[k] += split[k] + split[width + k] + split[2 * width + k] + split[3 * width + k];
+        }
+
+        // Requiere los mismos lo, hi y bins; lanza std::invalid_argument si no.
+        void merge(const histogram& other) {
+            if (other.lo_ != lo_ || other.hi_ != hi_ || other.counts_.size() != counts_.size())
+                throw std::invalid_argument("histogram::merge: different bins");
+            for (std::size_t k = 0; k < counts_.size(); ++k) counts_[k] += other.counts_[k];
+        }
+
+        std::size_t bins() const { return counts_.size() - 2; }
+        double width() const { return (hi_ - lo_) / static_cast<double>(bins()); }
+        double lower(std::size_t i) const { return lo_ + static_cast<double>(i) * width(); }
+
+        std::span<const std::uint64_t> counts() const { return {counts_.data() + 1, bins()}; }
+        std::uint64_t operator[](std::size_t i) const { return counts_[i + 1]; }
+        std::uint64_t underflow() const { return counts_.front(); }
+        std::uint64_t overflow() const { return counts_.back(); }
+
+        // Elementos contados, incluidos los de fuera de rango.
+        std::uint64_t count() const {
+            std::uint64_t n = 0;
+            for (auto c : counts_) n += c;
+            return n;
+        }
+
+    private:
+        // Por encima, las cuatro copias ya no caben en L2 y no compensan.
+        static constexpr std::size_t max_split_width = 1 << 14;
+
+        // 0: underflow, 1..bins: bins, bins + 1: overflow.
+        std::size_t slot(double v) const {
+            if (v < lo_) return 0;
+            if (v >= hi_) return counts_.size() - 1;
+            const auto i = static_cast<std::size_t>((v - lo_) * scale_);
+            return 1 + (i < bins() ? i : bins() - 1); // redondeo justo por debajo de hi
+        }
+
+        double lo_;
+        double hi_;
+        double scale_;
+        std::vector<std::uint64_t> counts_;
+    };
+
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    histogram histogram_of(const T& container, double lo, double hi, std::size_t bins) {
+        CORE_NUMERIC_METRIC("histogram", container, false);
+        using Q = element_t<T>;
+        histogram h(lo, hi, bins);
+        if constexpr (std::ranges::contiguous_range<const T> && std::ranges::sized_range<const T>)
+            h.push(std::span<const Q>(std::ranges::data(container), std::ranges::size(container)));
+        else
+            for (const auto& x : container) h.push(x);
+        return h;
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Comparable<element_t<T>>
+    histogram histogram_of(P&& policy, const T& container, double lo, double hi, std::size_t bins) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return histogram_of(container, lo, hi, bins);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("histogram", container, false);
+            (void)histogram(lo, hi, bins); // valida antes de repartir
+            return detail::parallel_reduce(policy, container,
+                [&](const auto& part) { return histogram_of(part, lo, hi, bins); },
+                [](histogram a, const histogram& b) { a.merge(b); return a; });
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_HISTOGRAM_H
@@ -0,0 +1,36 @@
+#ifndef CORE_NUMERIC_INSTANTIATIONS_H
+#define CORE_NUMERIC_INSTANTIATIONS_H
+
+#include <cstdint>
+#include <vector>
+
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+
+// Instanciaciones explicitas para los contenedores mas comunes. Se emiten una
+// sola vez en src/instantiations.cpp; el resto de TUs ven "extern template" y
+// no vuelven a generar codigo para ellas. Definir CORE_NUMERIC_NO_EXTERN_TEMPLATES
+// para desactivarlo.
+
+#define CORE_NUMERIC_FOR_EACH_COMMON_CONTAINER(X) \
+    X(std::vector<int>)                           \
+    X(std::vector<std::int64_t>)                  \
+    X(std::vector<float>)                         \
+    X(std::vector<double>)
+
+#define CORE_NUMERIC_INSTANTIATE(PREFIX, C)                                \
+    PREFIX template auto sum<C>(const C&);                                 \
+    PREFIX template auto mean<C>(const C&);                                \
+    PREFIX template auto variance<C>(const C&);                            \
+    PREFIX template auto max<C>(const C&);                                 \
+    PREFIX template auto moments<2, C>(const C&);
+
+#if !defined(CORE_NUMERIC_NO_EXTERN_TEMPLATES) && !defined(CORE_NUMERIC_BUILDING_INSTANTIATIONS)
+namespace core_numeric {
+#define CORE_NUMERIC_EXTERN_(C) CORE_NUMERIC_INSTANTIATE(extern, C)
+    CORE_NUMERIC_FOR_EACH_COMMON_CONTAINER(CORE_NUMERIC_EXTERN_)
+#undef CORE_NUMERIC_EXTERN_
+}
+#endif
+
+#endif // CORE_NUMERIC_INSTANTIATIONS_H
@@ -0,0 +1,161 @@
+#ifndef CORE_NUMERIC_INTEGER_H
+#define CORE_NUMERIC_INTEGER_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/parallel.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Politicas de desbordamiento para sum de enteros, elegidas en tiempo de
+    // compilacion como las de summation.h: sum<integer::checked>(v).
+    //   wrap     : aritmetica modular en el tipo del elemento
+    //   widen    : acumulador de 64 bits (el sum por defecto, detail::wide_t)
+    //   saturate : suma exacta recortada al rango del tipo del elemento
+    //   checked  : suma exacta; std::overflow_error si no cabe en el tipo del elemento
+    // saturate y checked solo miran el resultado final, no los parciales, asi
+    // que no dependen del orden de suma ni del numero de hilos. Con elementos
+    // de hasta 32 bits la suma exacta es la de 64 bits (kernel SIMD con
+    // ensanchamiento); con 64 bits se acumula en 128 bits.
+    namespace integer {
+        struct wrap {};
+        struct widen {};
+        struct saturate {};
+        struct checked {};
+    }
+
+    template<typename O>
+    concept IntegerPolicy =
+        std::is_same_v<O, integer::wrap> || std::is_same_v<O, integer::widen> ||
+        std::is_same_v<O, integer::saturate> || std::is_same_v<O, integer::checked>;
+
+    namespace detail {
+        // Entero de 128 bits con signo (hi * 2^64 + lo) que solo sabe sumar;
+        // evita depender de __int128.
+        struct int128_sum {
+            std::uint64_t lo = 0;
+            std::int64_t hi = 0;
+
+            template<std::integral Q>
+            void add(Q x) {
+                const auto u = static_cast<std::uint64_t>(x);
+                lo += u;
+                if (lo < u) ++hi;
+                if constexpr (std::is_signed_v<Q>) if (x < 0) --hi;
+            }
+
+            int128_sum& operator+=(const int128_sum& o) {
+                lo += o.lo;
+                hi += o.hi + (lo < o.lo ? 1 : 0);
+                return *this;
+            }
+
+            friend int128_sum operator+(int128_sum a, const int128_sum& b) { return a += b; }
+        };
+
+        template<Iterable T>
+        auto exact_sum(const T& container) {
+            using Q = element_t<T>;
+            if constexpr (sizeof(Q) <= 4) {
+                return sum(container);
+            } else {
+                int128_sum s;
+                for (const auto& x : container) s.add(x);
+                return s;
+            }
+        }
+
+        // -1 si queda por debajo del rango de Q, 1 si por encima, 0 si cabe.
+        template<typename Q, typename S>
+        int out_of_range(const S& s) {
+            if constexpr (std::is_same_v<S, int128_sum>) {
+                if constexpr (std::is_signed_v<Q>) {
+                    constexpr std::uint64_t sign = std::uint64_t{1} << 63;
+                    if ((s.hi == 0 && s.lo < sign) || (s.hi == -1 && s.lo >= sign)) return 0;
+                }
+                else if (s.hi == 0) return 0;
+                return s.hi < 0 ? -1 : 1;
+            } else {
+                if (std::cmp_less(s, std::numeric_limits<Q>::min())) return -1;
+                if (std::cmp_greater(s, std::numeric_limits<Q>::max())) return 1;
+                return 0;
+            }
+        }
+
+        template<typename Q, typename O, typename S>
+        Q finish_sum(const S& s) {
+            const int r = out_of_range<Q>(s);
+            if constexpr (std::is_same_v<O, integer::checked>) {
+                if (r != 0) throw std::overflow_error("sum: result does not fit in the element type");
+            } else {
+                if (r < 0) return std::numeric_limits<Q>::min();
+                if (r > 0) return std::numeric_limits<Q>::max();
+            }
+            if constexpr (std::is_same_v<S, int128_sum>) return static_cast<Q>(s.lo);
+            else return static_cast<Q>(s);
+        }
+
+        template<typename Q>
+        Q wrapping_add(Q a, Q b) {
+            using U = std::make_unsigned_t<Q>;
+            return static_cast<Q>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+        }
+    }
+
+    template<IntegerPolicy O, Iterable T>
+    requires std::integral<element_t<T>> && Addable<element_t<T>>
+    auto sum(const T& container) {
+        using Q = element_t<T>;
+        CORE_NUMERIC_METRIC("sum", container, (simd::Contiguous<T> && (std::is_same_v<O, integer::widen> ||
+            std::is_same_v<O, integer::wrap> || sizeof(Q) <= 4)));
+
+        if constexpr (std::is_same_v<O, integer::widen>) {
+            return sum(container);
+        } else if constexpr (std::is_same_v<O, integer::wrap>) {
+            if constexpr (simd::Contiguous<T>) {
+                return simd::sum(std::ranges::data(container), std::ranges::size(container));
+            } else {
+                Q result{};
+                for (const auto& x : container) result = detail::wrapping_add<Q>(result, x);
+                return result;
+            }
+        } else {
+            return detail::finish_sum<Q, O>(detail::exact_sum(container));
+        }
+    }
+
+    template<IntegerPolicy O, ExecutionPolicy P, Iterable T>
+    requires std::integral<element_t<T>> && Addable<element_t<T>>
+    auto sum(P&& policy, const T& container) {
+        using Q = element_t<T>;
+
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return sum<O>(container);
+        } else if constexpr (std::is_same_v<O, integer::widen>) {
+            return sum(policy, container);
+        } else if constexpr (std::is_same_v<O, integer::wrap>) {
+            CORE_NUMERIC_METRIC_PAR("sum", container, simd::Contiguous<T>);
+            return detail::parallel_reduce(policy, container,
+                [](const auto& part) { return sum<integer::wrap>(part); },
+                [](Q a, Q b) { return detail::wrapping_add(a, b); });
+        } else {
+            CORE_NUMERIC_METRIC_PAR("sum", container, (simd::Contiguous<T> && sizeof(Q) <= 4));
+            return detail::finish_sum<Q, O>(detail::parallel_reduce(policy, container,
+                [](const auto& part) { return detail::exact_sum(part); },
+                [](const auto& a, const auto& b) { return a + b; }));
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_INTEGER_H
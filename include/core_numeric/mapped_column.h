@@ -0,0 +1,91 @@
+#ifndef CORE_NUMERIC_MAPPED_COLUMN_H
+#define CORE_NUMERIC_MAPPED_COLUMN_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace core_numeric {
+
+    // Archivo proyectado en memoria de solo lectura. Las paginas se leen bajo
+    // demanda, asi que se pueden recorrer archivos mas grandes que la RAM sin
+    // copiarlos a un std::vector. Los errores del sistema se lanzan como
+    // std::system_error.
+    class mapped_file {
+    public:
+        enum class access { sequential, random, normal };
+
+        struct options {
+            access pattern = access::sequential; // madvise(MADV_SEQUENTIAL) por defecto
+            bool huge_pages = true;              // MADV_HUGEPAGE cuando el sistema lo soporta
+            bool populate = false;               // precargar todas las paginas al abrir
+        };
+
+        mapped_file() = default;
+        explicit mapped_file(const std::string& path) : mapped_file(path, options{}) {}
+        mapped_file(const std::string& path, options opts);
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        mapped_file(mapped_file&& other) noexcept { swap(other); }
+        mapped_file& operator=(mapped_file&& other) noexcept {
+            mapped_file tmp(std::move(other));
+            swap(tmp);
+            return *this;
+        }
+
+        ~mapped_file();
+
+        const std::byte* data() const { return data_; }
+        std::size_t size() const { return size_; }
+
+        void swap(mapped_file& other) noexcept {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(handle_, other.handle_);
+        }
+
+    private:
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        void* handle_ = nullptr; // solo Windows: objeto de proyeccion
+    };
+
+    // Columna binaria de T sobre un archivo proyectado, sin copias. Cumple
+    // Iterable y es un rango contiguo, asi que todas las reducciones (SIMD y
+    // paralelas) la reciben directamente: core_numeric::sum(mapped_column<double>(path)).
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    class mapped_column {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_iterator = const T*;
+        using iterator = const_iterator;
+
+        mapped_column() = default;
+        explicit mapped_column(const std::string& path, mapped_file::options opts = {})
+            : file_(path, opts) {
+            if (file_.size() % sizeof(T) != 0)
+                throw std::runtime_error("mapped_column: size of '" + path +
+                                         "' is not a multiple of the element size");
+        }
+
+        const T* data() const { return reinterpret_cast<const T*>(file_.data()); }
+        std::size_t size() const { return file_.size() / sizeof(T); }
+        bool empty() const { return size() == 0; }
+
+        const T* begin() const { return data(); }
+        const T* end() const { return data() + size(); }
+
+        const T& operator[](std::size_t i) const { return data()[i]; }
+
+    private:
+        mapped_file file_;
+    };
+}
+
+#endif // CORE_NUMERIC_MAPPED_COLUMN_H
@@ -0,0 +1,186 @@
+#ifndef CORE_NUMERIC_MATRIX_H
+#define CORE_NUMERIC_MATRIX_H
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/parallel.h"
+#include "core_numeric/simd.h"
+#include "core_numeric/views.h"
+
+namespace core_numeric {
+
+    // Vista de una matriz densa por filas. stride es la distancia en elementos
+    // entre filas consecutivas (0: cols), para submatrices o filas con relleno.
+    template<typename T>
+    struct matrix_view {
+        const T* data = nullptr;
+        std::size_t rows = 0;
+        std::size_t cols = 0;
+        std::size_t stride = 0;
+
+        constexpr matrix_view() = default;
+        constexpr matrix_view(const T* data, std::size_t rows, std::size_t cols, std::size_t stride = 0)
+            : data(data), rows(rows), cols(cols), stride(stride ? stride : cols) {}
+
+        constexpr std::span<const T> row(std::size_t i) const { return {data + i * stride, cols}; }
+        strided_view<const T> column(std::size_t j) const {
+            return {data + j, rows, static_cast<std::ptrdiff_t>(stride)};
+        }
+        constexpr const T& operator()(std::size_t i, std::size_t j) const { return data[i * stride + j]; }
+    };
+
+    namespace detail {
+        // Mosaico de column_moments: matrix_tile_cols acumuladores por estadistico
+        // caben en L1 y matrix_block_rows filas del mosaico caben en L2, de modo
+        // que la segunda pasada (desviaciones) vuelve a leer desde cache.
+        inline constexpr std::size_t matrix_tile_cols = 512;
+        inline constexpr std::size_t matrix_block_rows = 128;
+
+        template<simd::Lane T>
+        void column_tile(const matrix_view<T>& m, std::size_t r0, std::size_t nr,
+                         std::size_t c0, std::size_t nc, moments_state<T>* out) {
+            double sum[matrix_tile_cols];
+            double dev[matrix_tile_cols];
+            T lo[matrix_tile_cols];
+            T hi[matrix_tile_cols];
+
+            // Tras el primer bloque de filas los NaN no cuentan, como en
+            // simd::moments con continued: min y max parten de +-inf.
+            const T* first = m.data + r0 * m.stride + c0;
+            for (std::size_t j = 0; j < nc; ++j) {
+                sum[j] = static_cast<double>(first[j]);
+                lo[j] = hi[j] = first[j];
+                if constexpr (!std::is_integral_v<T>) {
+                    if (r0 > 0) {
+                        const T inf = simd::infinity<T>();
+                        lo[j] = first[j] < inf ? first[j] : inf;
+                        hi[j] = first[j] > -inf ? first[j] : -inf;
+                    }
+                }
+                dev[j] = 0.0;
+            }
+
+            // Lazos internos sobre columnas contiguas: cada carril SIMD es una columna.
+            for (std::size_t r = 1; r < nr; ++r) {
+                const T* x = first + r * m.stride;
+                for (std::size_t j = 0; j < nc; ++j) {
+                    sum[j] += static_cast<double>(x[j]);
+                    lo[j] = x[j] < lo[j] ? x[j] : lo[j];
+                    hi[j] = x[j] > hi[j] ? x[j] : hi[j];
+                }
+            }
+
+            const double inv = 1.0 / static_cast<double>(nr);
+            for (std::size_t j = 0; j < nc; ++j) sum[j] *= inv;
+
+            for (std::size_t r = 0; r < nr; ++r) {
+                const T* x = first + r * m.stride;
+                for (std::size_t j = 0; j < nc; ++j) {
+                    const double d = static_cast<double>(x[j]) - sum[j];
+                    dev[j] += d * d;
+                }
+            }
+
+            for (std::size_t j = 0; j < nc; ++j) {
+                moments_state<T> b;
+                b.count = nr;
+                b.mean = sum[j];
+                b.m2 = dev[j];
+                b.min = lo[j];
+                b.max = hi[j];
+                out[j] = merge(out[j], b);
+            }
+        }
+    }
+
+    // Momentos de cada columna recorriendo la matriz por filas, una sola vez
+    // desde memoria. Equivale a moments() sobre cada columna por separado.
+    template<simd::Lane T>
+    std::vector<moments_state<T>> column_moments(const matrix_view<T>& m) {
+        CORE_NUMERIC_METRIC_ELEMENTS("column_moments", "seq", T, false, m.rows * m.cols);
+        std::vector<moments_state<T>> out(m.cols);
+        for (std::size_t r0 = 0; r0 < m.rows; r0 += detail::matrix_block_rows) {
+            const std::size_t nr = m.rows - r0 < detail::matrix_block_rows ? m.rows - r0 : detail::matrix_block_rows;
+            for (std::size_t c0 = 0; c0 < m.cols; c0 += detail::matrix_tile_cols) {
+                const std::size_t nc = m.cols - c0 < detail::matrix_tile_cols ? m.cols - c0 : detail::matrix_tile_cols;
+                detail::column_tile(m, r0, nr, c0, nc, out.data() + c0);
+            }
+        }
+        return out;
+    }
+
+    // En paralelo cada tarea toma un grupo de columnas completo, asi cada
+    // columna se acumula en el mismo orden que en serie y el resultado es identico.
+    template<ExecutionPolicy P, simd::Lane T>
+    std::vector<moments_state<T>> column_moments(P&& policy, const matrix_view<T>& m) {
+        constexpr std::size_t W = detail::matrix_tile_cols;
+        const std::size_t tiles = (m.cols + W - 1) / W;
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy>) {
+            return column_moments(m);
+        } else {
+            if (tiles <= 1 || m.rows * m.cols < policy.cutoff) return column_moments(m);
+            CORE_NUMERIC_METRIC_ELEMENTS("column_moments", "par", T, false, m.rows * m.cols);
+            CORE_NUMERIC_METRIC_THREADS(tiles < detail::pool_of(policy).size() ? tiles : detail::pool_of(policy).size());
+
+            std::vector<moments_state<T>> out(m.cols);
+            detail::pool_of(policy).parallel_for(tiles, [&](std::size_t t) {
+                const std::size_t c0 = t * W;
+                const std::size_t nc = m.cols - c0 < W ? m.cols - c0 : W;
+                for (std::size_t r0 = 0; r0 < m.rows; r0 += detail::matrix_block_rows) {
+                    const std::size_t nr = m.rows - r0 < detail::matrix_block_rows ? m.rows - r0 : detail::matrix_block_rows;
+                    detail::column_tile(m, r0, nr, c0, nc, out.data() + c0);
+                }
+            });
+            return out;
+        }
+    }
+
+    template<simd::Lane T>
+    std::vector<moments_state<T>> column_moments(const T* data, std::size_t rows, std::size_t cols) {
+        return column_moments(matrix_view<T>(data, rows, cols));
+    }
+
+    // Caso traspuesto: cada fila es contigua y usa los kernels de moments().
+    template<simd::Lane T>
+    std::vector<moments_state<T>> row_moments(const matrix_view<T>& m) {
+        CORE_NUMERIC_METRIC_ELEMENTS("row_moments", "seq", T, true, m.rows * m.cols);
+        std::vector<moments_state<T>> out(m.rows);
+        for (std::size_t i = 0; i < m.rows; ++i)
+            out[i] = simd::moments(m.data + i * m.stride, m.cols);
+        return out;
+    }
+
+    template<ExecutionPolicy P, simd::Lane T>
+    std::vector<moments_state<T>> row_moments(P&& policy, const matrix_view<T>& m) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy>) {
+            return row_moments(m);
+        } else {
+            if (m.rows <= 1 || m.rows * m.cols < policy.cutoff) return row_moments(m);
+
+            // Grupos de filas de al menos grain elementos.
+            const std::size_t per = policy.grain / (m.cols ? m.cols : 1) + 1;
+            const std::size_t groups = (m.rows + per - 1) / per;
+            CORE_NUMERIC_METRIC_ELEMENTS("row_moments", "par", T, true, m.rows * m.cols);
+            CORE_NUMERIC_METRIC_THREADS(groups < detail::pool_of(policy).size() ? groups : detail::pool_of(policy).size());
+            std::vector<moments_state<T>> out(m.rows);
+            detail::pool_of(policy).parallel_for(groups, [&](std::size_t g) {
+                const std::size_t last = (g + 1) * per < m.rows ? (g + 1) * per : m.rows;
+                for (std::size_t i = g * per; i < last; ++i)
+                    out[i] = simd::moments(m.data + i * m.stride, m.cols);
+            });
+            return out;
+        }
+    }
+
+    template<simd::Lane T>
+    std::vector<moments_state<T>> row_moments(const T* data, std::size_t rows, std::size_t cols) {
+        return row_moments(matrix_view<T>(data, rows, cols));
+    }
+}
+
+#endif // CORE_NUMERIC_MATRIX_H
@@ -0,0 +1,35 @@
+#ifndef CORE_NUMERIC_MEMORY_H
+#define CORE_NUMERIC_MEMORY_H
+
+#include <memory_resource>
+
+namespace core_numeric {
+
+    // Memoria temporal interna (parciales de los hilos, buffers de bloques,
+    // tablas auxiliares). Toda pasa por scratch_resource(), que por defecto es
+    // un std::pmr::unsynchronized_pool_resource propio de cada hilo: tras la
+    // primera llamada los bloques se reutilizan y las llamadas en regimen
+    // estable no tocan el operator new global.
+    std::pmr::memory_resource* scratch_resource() noexcept;
+
+    // Sustituye el recurso del hilo actual y devuelve el anterior; nullptr
+    // restaura el pool por defecto. El recurso debe vivir mientras se use.
+    std::pmr::memory_resource* set_scratch_resource(std::pmr::memory_resource* resource) noexcept;
+
+    // Cambio de recurso con alcance: scoped_scratch_resource arena(&mi_arena);
+    class scoped_scratch_resource {
+    public:
+        explicit scoped_scratch_resource(std::pmr::memory_resource* resource) noexcept
+            : previous_(set_scratch_resource(resource)) {}
+
+        scoped_scratch_resource(const scoped_scratch_resource&) = delete;
+        scoped_scratch_resource& operator=(const scoped_scratch_resource&) = delete;
+
+        ~scoped_scratch_resource() { set_scratch_resource(previous_); }
+
+    private:
+        std::pmr::memory_resource* previous_;
+    };
+}
+
+#endif // CORE_NUMERIC_MEMORY_H
@@ -0,0 +1,229 @@
+#ifndef CORE_NUMERIC_METRICS_H
+#define CORE_NUMERIC_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/simd.h"
+
+// Instrumentacion opcional de las funciones publicas. Se activa con
+// -DCORE_NUMERIC_METRICS=ON en CMake, que define CORE_NUMERIC_METRICS=1 para
+// la biblioteca y sus usuarios (tiene que ser igual en todas las TUs). Sin
+// ella las macros CORE_NUMERIC_METRIC* no generan codigo.
+//
+// Cada serie se identifica por funcion, tipo de elemento, kernel ("generic"
+// o la ISA activa del despacho SIMD en esa llamada) y politica ("seq" / "par").
+// Cada punto de llamada pasa en vectorized si la rama que toma usa los
+// kernels de simd:: (no basta con que el rango sea contiguo). Solo cuenta la
+// llamada mas externa de cada hilo: variance no cuenta tambien el moments
+// que usa por dentro, ni una llamada paralela los bloques de sus hilos.
+#ifndef CORE_NUMERIC_METRICS
+#define CORE_NUMERIC_METRICS 0
+#endif
+
+namespace core_numeric::metrics {
+
+    inline constexpr bool enabled = CORE_NUMERIC_METRICS != 0;
+
+    // Cubo i: duracion < 2^(i + 6) ns (64 ns .. ~0.27 s); el ultimo, el resto.
+    inline constexpr std::size_t latency_buckets = 23;
+
+    struct sample {
+        std::string function;
+        std::string type;
+        std::string kernel;
+        std::string policy;
+        std::uint64_t calls = 0;
+        std::uint64_t elements = 0;   // 0 en rangos sin tamano conocido
+        std::uint64_t bytes = 0;
+        std::uint64_t threads = 0;    // suma de los hilos usados en cada llamada
+        std::uint64_t latency_ns = 0; // suma de las duraciones
+        std::array<std::uint64_t, latency_buckets> latency{}; // no acumulado
+    };
+
+    // Copia de todas las series registradas (vacia si la instrumentacion esta desactivada).
+    std::vector<sample> snapshot();
+
+    // Pone a cero los contadores; las series siguen registradas.
+    void reset();
+
+    // snapshot() en formato de texto de Prometheus (contadores *_total e
+    // histograma core_numeric_call_duration_seconds).
+    std::string prometheus();
+
+    namespace detail {
+        struct site {
+            std::atomic<std::uint64_t> calls{0};
+            std::atomic<std::uint64_t> elements{0};
+            std::atomic<std::uint64_t> bytes{0};
+            std::atomic<std::uint64_t> threads{0};
+            std::atomic<std::uint64_t> latency_ns{0};
+            std::array<std::atomic<std::uint64_t>, latency_buckets> latency{};
+        };
+
+        // Devuelve la serie de esa clave, creandola la primera vez (src/metrics.cpp).
+        site& register_site(const char* function, const char* type, const char* kernel, const char* policy);
+
+        template<typename Q>
+        constexpr const char* type_name() {
+            if constexpr (std::is_same_v<Q, double>) return "double";
+            else if constexpr (std::is_same_v<Q, float>) return "float";
+            else if constexpr (std::is_same_v<Q, long double>) return "long_double";
+            else if constexpr (HalfFloat<Q>) return std::is_same_v<half_storage_t<Q>, float16> ? "float16" : "bfloat16";
+            else if constexpr (std::is_integral_v<Q> && std::is_signed_v<Q>) {
+                if constexpr (sizeof(Q) == 1) return "int8";
+                else if constexpr (sizeof(Q) == 2) return "int16";
+                else if constexpr (sizeof(Q) == 4) return "int32";
+                else return "int64";
+            } else if constexpr (std::is_integral_v<Q>) {
+                if constexpr (sizeof(Q) == 1) return "uint8";
+                else if constexpr (sizeof(Q) == 2) return "uint16";
+                else if constexpr (sizeof(Q) == 4) return "uint32";
+                else return "uint64";
+            } else {
+                return "other";
+            }
+        }
+
+        // Series de un punto de llamada. Con kernel SIMD hay una por ISA y se
+        // elige en cada llamada, porque simd::use() cambia la variante en
+        // marcha; cada una se registra la primera vez que se usa.
+        template<bool Vectorized>
+        class call_site;
+
+        template<>
+        class call_site<false> {
+        public:
+            call_site(const char* function, const char* type, const char* policy)
+                : site_(register_site(function, type, "generic", policy)) {}
+
+            site& get() { return site_; }
+
+        private:
+            site& site_;
+        };
+
+        template<>
+        class call_site<true> {
+        public:
+            call_site(const char* function, const char* type, const char* policy)
+                : function_(function), type_(type), policy_(policy) {}
+
+            site& get() {
+                const simd::isa level = simd::active();
+                auto& slot = by_isa_[static_cast<std::size_t>(level)];
+                site* s = slot.load(std::memory_order_acquire);
+                if (!s) {
+                    s = &register_site(function_, type_, simd::name(level), policy_); // misma serie si hay carrera
+                    slot.store(s, std::memory_order_release);
+                }
+                return *s;
+            }
+
+        private:
+            const char* function_;
+            const char* type_;
+            const char* policy_;
+            std::array<std::atomic<site*>, 4> by_isa_{}; // uno por valor de simd::isa
+        };
+
+        template<typename T>
+        std::size_t size_of(const T& container) {
+            if constexpr (std::ranges::sized_range<const T>) return static_cast<std::size_t>(std::ranges::size(container));
+            else return 0;
+        }
+
+        class scope;
+
+        // Anidamiento por hilo y medicion en curso (para CORE_NUMERIC_METRIC_THREADS).
+        inline thread_local int depth = 0;
+        inline thread_local scope* active = nullptr;
+
+        class scope {
+        public:
+            scope(site& s, std::size_t n, std::size_t elem_size) : site_(&s), n_(n), elem_size_(elem_size) {
+                if (depth++ != 0) {
+                    site_ = nullptr;
+                    return;
+                }
+                active = this;
+                start_ = std::chrono::steady_clock::now();
+            }
+
+            ~scope() {
+                --depth;
+                if (!site_) return;
+                active = nullptr;
+                const auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start_).count());
+                const std::size_t b = static_cast<std::size_t>(std::bit_width(ns >> 6));
+                site_->calls.fetch_add(1, std::memory_order_relaxed);
+                site_->elements.fetch_add(n_, std::memory_order_relaxed);
+                site_->bytes.fetch_add(n_ * elem_size_, std::memory_order_relaxed);
+                site_->threads.fetch_add(threads_, std::memory_order_relaxed);
+                site_->latency_ns.fetch_add(ns, std::memory_order_relaxed);
+                site_->latency[b < latency_buckets ? b : latency_buckets - 1].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            scope(const scope&) = delete;
+            scope& operator=(const scope&) = delete;
+
+            void threads(std::size_t k) { threads_ = k; }
+
+        private:
+            site* site_;
+            std::size_t n_;
+            std::size_t elem_size_;
+            std::size_t threads_ = 1;
+            std::chrono::steady_clock::time_point start_{};
+        };
+
+        inline void set_threads(std::size_t k) {
+            if (active) active->threads(k);
+        }
+
+        // Silencia las mediciones en el hilo actual (trabajo de un bloque paralelo).
+        struct quiet {
+            quiet() { ++depth; }
+            ~quiet() { --depth; }
+            quiet(const quiet&) = delete;
+            quiet& operator=(const quiet&) = delete;
+        };
+    }
+}
+
+#if CORE_NUMERIC_METRICS
+#define CORE_NUMERIC_METRIC_SCOPE_(name, policy, Q, vectorized, n)                                  \
+    static ::core_numeric::metrics::detail::call_site<(vectorized)> core_numeric_metric_site_(       \
+        name, ::core_numeric::metrics::detail::type_name<Q>(), policy);                              \
+    const ::core_numeric::metrics::detail::scope core_numeric_metric_scope_(                         \
+        core_numeric_metric_site_.get(), n, sizeof(Q))
+#define CORE_NUMERIC_METRIC_RANGE_(name, policy, container, vectorized)                             \
+    CORE_NUMERIC_METRIC_SCOPE_(name, policy, element_t<std::remove_cvref_t<decltype(container)>>,   \
+        vectorized, ::core_numeric::metrics::detail::size_of(container))
+#define CORE_NUMERIC_METRIC(name, container, vectorized)                                            \
+    CORE_NUMERIC_METRIC_RANGE_(name, "seq", container, vectorized)
+#define CORE_NUMERIC_METRIC_PAR(name, container, vectorized)                                        \
+    CORE_NUMERIC_METRIC_RANGE_(name, "par", container, vectorized)
+#define CORE_NUMERIC_METRIC_ELEMENTS(name, policy, Q, vectorized, n)                                \
+    CORE_NUMERIC_METRIC_SCOPE_(name, policy, Q, vectorized, n)
+#define CORE_NUMERIC_METRIC_THREADS(k) ::core_numeric::metrics::detail::set_threads(k)
+#define CORE_NUMERIC_METRIC_QUIET() const ::core_numeric::metrics::detail::quiet core_numeric_metric_quiet_
+#else
+#define CORE_NUMERIC_METRIC(name, container, vectorized) ((void)0)
+#define CORE_NUMERIC_METRIC_PAR(name, container, vectorized) ((void)0)
+#define CORE_NUMERIC_METRIC_ELEMENTS(name, policy, Q, vectorized, n) ((void)0)
+#define CORE_NUMERIC_METRIC_THREADS(k) ((void)0)
+#define CORE_NUMERIC_METRIC_QUIET() ((void)0)
+#endif
+
+#endif // CORE_NUMERIC_METRICS_H
@@ -0,0 +1,253 @@
+#ifndef CORE_NUMERIC_MOMENTS_H
+#define CORE_NUMERIC_MOMENTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Momentos centrales en una sola pasada: count, mean, M2 (y M3/M4 si Order == 4),
+    // min y max. Welford para elemento a elemento y Chan/Pebay para combinar.
+    template<typename Q>
+    struct moments_state {
+        std::size_t count = 0;
+        double mean = 0.0;
+        double m2 = 0.0;
+        double m3 = 0.0;
+        double m4 = 0.0;
+        Q min{};
+        Q max{};
+    };
+
+    template<int Order = 2, typename Q>
+    constexpr void push(moments_state<Q>& s, Q x) {
+        const double n1 = static_cast<double>(s.count);
+        ++s.count;
+        const double n = static_cast<double>(s.count);
+        const double delta = static_cast<double>(x) - s.mean;
+        const double delta_n = delta / n;
+        const double term1 = delta * delta_n * n1;
+
+        if constexpr (Order >= 4) {
+            const double delta_n2 = delta_n * delta_n;
+            s.m4 += term1 * delta_n2 * (n * n - 3 * n + 3) + 6 * delta_n2 * s.m2 - 4 * delta_n * s.m3;
+            s.m3 += term1 * delta_n * (n - 2) - 3 * delta_n * s.m2;
+        }
+        s.mean += delta_n;
+        s.m2 += term1;
+
+        if (s.count == 1) {
+            s.min = x;
+            s.max = x;
+        } else {
+            if (x < s.min) s.min = x;
+            if (x > s.max) s.max = x;
+        }
+    }
+
+    template<int Order = 2, typename Q>
+    constexpr moments_state<Q> merge(const moments_state<Q>& a, const moments_state<Q>& b) {
+        if (a.count == 0) return b;
+        if (b.count == 0) return a;
+
+        const double na = static_cast<double>(a.count);
+        const double nb = static_cast<double>(b.count);
+        const double n = na + nb;
+        const double delta = b.mean - a.mean;
+        const double delta_n = delta / n;
+
+        moments_state<Q> r;
+        r.count = a.count + b.count;
+        r.mean = a.mean + delta_n * nb;
+        r.m2 = a.m2 + b.m2 + delta * delta_n * na * nb;
+        if constexpr (Order >= 4) {
+            const double d2 = delta * delta, d3 = d2 * delta, d4 = d2 * d2;
+            r.m3 = a.m3 + b.m3 + d3 * na * nb * (na - nb) / (n * n) +
+                   3.0 * delta * (na * b.m2 - nb * a.m2) / n;
+            r.m4 = a.m4 + b.m4 + d4 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n) +
+                   6.0 * d2 * (na * na * b.m2 + nb * nb * a.m2) / (n * n) +
+                   4.0 * delta * (na * b.m3 - nb * a.m3) / n;
+        }
+        r.min = b.min < a.min ? b.min : a.min;
+        r.max = b.max > a.max ? b.max : a.max;
+        return r;
+    }
+
+    namespace detail {
+        // Enteros de hasta 32 bits: la varianza sale exacta de sum x y sum x^2
+        // enteros, M2 = (n * sum x^2 - (sum x)^2) / n, con un unico redondeo al
+        // pasar a double. Sin __int128 (MSVC) el numerador se calcula en long double.
+        template<typename Q>
+        constexpr bool exact_integer_moments = std::is_integral_v<Q> && sizeof(Q) <= 4;
+
+        template<typename Q, typename S1>
+        moments_state<Q> exact_moments(std::size_t n, S1 s1, const simd::square_sum& sq) {
+            moments_state<Q> r;
+            r.count = n;
+            if (n == 0) return r;
+            std::uint64_t a = static_cast<std::uint64_t>(s1);
+            if constexpr (std::is_signed_v<S1>) if (s1 < 0) a = 0 - a;
+#if defined(__SIZEOF_INT128__)
+            using u128 = unsigned __int128;
+            const u128 s2 = (static_cast<u128>(sq.hi) << 32) + sq.lo;
+            const u128 num = static_cast<u128>(n) * s2 - static_cast<u128>(a) * a;
+            r.m2 = static_cast<double>(num) / static_cast<double>(n);
+#else
+            const long double s2 = static_cast<long double>(sq.hi) * 4294967296.0L + static_cast<long double>(sq.lo);
+            const long double la = static_cast<long double>(a);
+            r.m2 = static_cast<double>((static_cast<long double>(n) * s2 - la * la) / static_cast<long double>(n));
+#endif
+            r.mean = static_cast<double>(s1) / static_cast<double>(n);
+            return r;
+        }
+
+        template<Iterable T>
+        auto integer_moments(const T& container) {
+            using Q = element_t<T>;
+            std::conditional_t<std::is_signed_v<Q>, std::int64_t, std::uint64_t> s1 = 0;
+            simd::square_sum sq;
+            std::size_t n = 0;
+            Q lo{}, hi{};
+            for (const auto& x : container) {
+                if (n++ == 0) lo = hi = x;
+                else if (x < lo) lo = x;
+                else if (x > hi) hi = x;
+                s1 += x;
+                const Q v = x;
+                sq += simd::scalar::sum_sq(&v, 1);
+            }
+            auto r = exact_moments<Q>(n, s1, sq);
+            r.min = lo;
+            r.max = hi;
+            return r;
+        }
+    }
+
+    namespace simd {
+        // Bloque que cabe en L1: se recorre dos veces desde cache, una sola desde memoria.
+        inline constexpr std::size_t moments_block = 2048;
+
+        // Desplazamiento del primer elemento que no es NaN (n si no hay). En
+        // max/min solo cuenta un NaN en el primer elemento de la serie, asi que
+        // los bloques que siguen a otros se reducen desde aqui.
+        template<typename T>
+        constexpr std::size_t skip_nan(const T* p, std::size_t n) {
+            std::size_t i = 0;
+            if constexpr (!std::is_integral_v<T>) while (i < n && !(p[i] == p[i])) ++i;
+            return i;
+        }
+
+        // +inf o -inf en T, tambien en float16 / bfloat16.
+        template<typename T>
+        T infinity(bool negative = false) {
+            constexpr float inf = std::numeric_limits<float>::infinity();
+            return T(negative ? -inf : inf);
+        }
+
+        template<typename T>
+        requires Lane<T> || HalfFloat<T>
+        double block_sum(const T* p, std::size_t n) {
+            if constexpr (std::is_same_v<T, double>) return sum(p, n);
+            else if constexpr (std::is_same_v<T, float> || HalfFloat<T>) return sum_wide(p, n);
+            else if constexpr (std::is_same_v<T, std::int32_t>)
+                return static_cast<double>(sum_wide(p, n));
+            else return scalar::sum<std::int64_t, double>(p, n);
+        }
+
+        // continued: p sigue a elementos ya vistos (accumulator::push), asi que
+        // un NaN en p[0] tampoco cuenta para min y max.
+        template<typename T, bool Extrema = true>
+        requires Lane<T> || HalfFloat<T>
+        moments_state<T> moments(const T* p, std::size_t n, bool continued = false) {
+            if constexpr (std::is_same_v<T, std::int32_t>) {
+                std::int64_t s1 = 0;
+                square_sum sq;
+                T lo{}, hi{};
+                for (std::size_t i = 0; i < n; i += moments_block) {
+                    const std::size_t len = n - i < moments_block ? n - i : moments_block;
+                    s1 += sum_wide(p + i, len);
+                    sq += sum_sq(p + i, len);
+                    if constexpr (Extrema) {
+                        const T bl = min(p + i, len), bh = max(p + i, len);
+                        if (i == 0 || bl < lo) lo = bl;
+                        if (i == 0 || bh > hi) hi = bh;
+                    }
+                }
+                auto r = detail::exact_moments<T>(n, s1, sq);
+                r.min = lo;
+                r.max = hi;
+                return r;
+            } else {
+                moments_state<T> total;
+                for (std::size_t i = 0; i < n; i += moments_block) {
+                    const std::size_t len = n - i < moments_block ? n - i : moments_block;
+                    moments_state<T> b;
+                    b.count = len;
+                    b.mean = block_sum(p + i, len) / static_cast<double>(len);
+                    b.m2 = sq_dev(p + i, len, b.mean);
+                    if constexpr (Extrema) {
+                        const std::size_t k = i == 0 && !continued ? 0 : skip_nan(p + i, len);
+                        if (k < len) {
+                            b.min = min(p + i + k, len - k);
+                            b.max = max(p + i + k, len - k);
+                        } else if constexpr (!std::is_integral_v<T>) {
+                            // Todo NaN: neutros para que merge conserve los demas bloques.
+                            b.min = infinity<T>();
+                            b.max = infinity<T>(true);
+                        }
+                    }
+                    total = merge(total, b);
+                }
+                return total;
+            }
+        }
+    }
+
+    template<int Order = 2, Iterable T>
+    requires Addable<element_t<T>>
+    auto moments(const T& container) {
+        CORE_NUMERIC_METRIC("moments", container, (Order == 2 && (simd::Contiguous<T> || simd::HalfContiguous<T>)));
+        using Q = element_t<T>;
+
+        if constexpr (Order == 2 && (simd::Contiguous<T> || simd::HalfContiguous<T>)) {
+            return simd::moments(std::ranges::data(container), std::ranges::size(container));
+        } else if constexpr (Order == 2 && detail::exact_integer_moments<Q>) {
+            return detail::integer_moments(container);
+        } else {
+            moments_state<Q> s;
+            for (const auto& x : container) push<Order>(s, x);
+            return s;
+        }
+    }
+
+    template<typename Q>
+    constexpr double mean(const moments_state<Q>& s) {
+        return s.mean;
+    }
+
+    template<typename Q>
+    constexpr double variance(const moments_state<Q>& s) {
+        return s.m2 / static_cast<double>(s.count);
+    }
+
+    // Grados de libertad restados a n: ddof = 1 es la varianza muestral.
+    template<typename Q>
+    constexpr double variance(const moments_state<Q>& s, std::size_t ddof) {
+        if (s.count <= ddof) return std::numeric_limits<double>::quiet_NaN();
+        return s.m2 / static_cast<double>(s.count - ddof);
+    }
+
+    template<typename Q>
+    constexpr Q max(const moments_state<Q>& s) {
+        return s.max;
+    }
+}
+
+#endif // CORE_NUMERIC_MOMENTS_H
@@ -0,0 +1,66 @@
+#ifndef CORE_NUMERIC_MPI_H
+#define CORE_NUMERIC_MPI_H
+
+#include <climits>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include "core_numeric/distributed.h"
+
+// Adaptador MPI para tree_reduce / all_reduce (distributed.h). Solo se
+// incluye desde core_numeric.h con CORE_NUMERIC_MPI definido (opcion CMake
+// CORE_NUMERIC_MPI, que enlaza MPI::MPI_CXX); el resto de la biblioteca no
+// depende de MPI. MPI_Init y MPI_Finalize quedan a cargo de la aplicacion.
+namespace core_numeric {
+
+    // Mensajes MPI_BYTE con una etiqueta propia, para no mezclarse con el
+    // trafico de la aplicacion en el mismo comunicador. Los errores de MPI
+    // se devuelven como std::runtime_error si el manejador del comunicador
+    // no aborta antes (MPI_ERRORS_RETURN).
+    class mpi_communicator {
+    public:
+        static constexpr int default_tag = 0x434e; // "CN"
+
+        explicit mpi_communicator(MPI_Comm comm = MPI_COMM_WORLD, int tag = default_tag)
+            : comm_(comm), tag_(tag) {
+            check(MPI_Comm_rank(comm_, &rank_), "MPI_Comm_rank");
+            check(MPI_Comm_size(comm_, &size_), "MPI_Comm_size");
+        }
+
+        int rank() const { return rank_; }
+        int size() const { return size_; }
+
+        void send(int peer, std::span<const std::byte> msg) {
+            if (msg.size() > static_cast<std::size_t>(INT_MAX)) throw std::length_error("mpi_communicator: message too large");
+            check(MPI_Send(msg.data(), static_cast<int>(msg.size()), MPI_BYTE, peer, tag_, comm_), "MPI_Send");
+        }
+
+        // El tamano llega con MPI_Probe, asi que basta un mensaje por estado.
+        std::vector<std::byte> recv(int peer) {
+            MPI_Status status;
+            check(MPI_Probe(peer, tag_, comm_, &status), "MPI_Probe");
+            int n = 0;
+            check(MPI_Get_count(&status, MPI_BYTE, &n), "MPI_Get_count");
+            std::vector<std::byte> msg(static_cast<std::size_t>(n));
+            check(MPI_Recv(msg.data(), n, MPI_BYTE, peer, tag_, comm_, MPI_STATUS_IGNORE), "MPI_Recv");
+            return msg;
+        }
+
+    private:
+        static void check(int rc, const char* what) {
+            if (rc != MPI_SUCCESS) throw std::runtime_error(std::string("mpi_communicator: ") + what + " failed");
+        }
+
+        MPI_Comm comm_;
+        int tag_;
+        int rank_ = 0;
+        int size_ = 1;
+    };
+}
+
+#endif // CORE_NUMERIC_MPI_H
@@ -0,0 +1,194 @@
+#ifndef CORE_NUMERIC_NAN_H
+#define CORE_NUMERIC_NAN_H
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/extrema.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Versiones con resultado opcional y politica de NaN en tiempo de
+    // compilacion: mean<nan_policy::skip>(x), variance<nan_policy::propagate>(x, 1),
+    // max<nan_policy::skip>(x). Devuelven std::nullopt si no queda ningun
+    // elemento (o, en variance, no mas de ddof) en lugar de lanzar o dividir
+    // por cero. La comprobacion se hace una vez por llamada; los kernels no
+    // tienen ramas por elemento.
+    //   propagate : un NaN en la entrada da NaN (tambien en max y min)
+    //   skip      : los NaN no cuentan, ni en la suma ni en n
+    // Con enteros no hay NaN y las dos politicas coinciden.
+    namespace nan_policy {
+        struct propagate {};
+        struct skip {};
+    }
+
+    template<typename P>
+    concept NanPolicy = std::is_same_v<P, nan_policy::propagate> || std::is_same_v<P, nan_policy::skip>;
+
+    namespace detail {
+        template<typename Q>
+        constexpr bool has_nan = std::is_floating_point_v<Q> || HalfFloat<Q>;
+
+        template<typename T>
+        concept NanKernel = simd::Contiguous<T> &&
+            (std::is_same_v<element_t<T>, double> || std::is_same_v<element_t<T>, float>);
+
+        template<typename Q>
+        Q quiet_nan() {
+            if constexpr (HalfFloat<Q>) return static_cast<Q>(std::numeric_limits<float>::quiet_NaN());
+            else return std::numeric_limits<Q>::quiet_NaN();
+        }
+
+        // Para las metricas: con Skips la rama que salta NaN, sin el la de siempre.
+        template<bool Skips, typename T>
+        constexpr bool nan_path_vectorized =
+            Skips ? NanKernel<T> : (simd::Contiguous<T> || simd::HalfContiguous<T>);
+
+        template<typename Q>
+        Q narrow(double v) {
+            if constexpr (HalfFloat<Q>) return static_cast<Q>(static_cast<float>(v)); // exacto: v vino de Q
+            else return static_cast<Q>(v);
+        }
+
+        template<Iterable T>
+        simd::nan_skipped skip_nan_sum(const T& container) {
+            if constexpr (NanKernel<T>) {
+                return simd::nan_sum(std::ranges::data(container), std::ranges::size(container));
+            } else {
+                simd::nan_skipped r;
+                for (const auto& x : container) {
+                    const double v = static_cast<double>(x);
+                    const bool ok = v == v;
+                    r.value += ok ? v : 0.0;
+                    r.count += ok;
+                }
+                return r;
+            }
+        }
+
+        template<bool Max, Iterable T>
+        simd::nan_skipped skip_nan_extremum(const T& container) {
+            if constexpr (NanKernel<T>) {
+                const auto* p = std::ranges::data(container);
+                const std::size_t n = std::ranges::size(container);
+                return Max ? simd::nan_max(p, n) : simd::nan_min(p, n);
+            } else {
+                simd::nan_skipped r{Max ? -std::numeric_limits<double>::infinity()
+                                        : std::numeric_limits<double>::infinity(), 0};
+                for (const auto& x : container) {
+                    const double v = static_cast<double>(x);
+                    r.count += v == v;
+                    if (Max ? v > r.value : v < r.value) r.value = v;
+                }
+                return r;
+            }
+        }
+
+        // Como simd::moments: por bloques de L1, media y desviaciones del
+        // bloque sin los NaN y Chan para combinar.
+        template<Iterable T>
+        moments_state<double> skip_nan_moments(const T& container) {
+            moments_state<double> total;
+            if constexpr (NanKernel<T>) {
+                const auto* p = std::ranges::data(container);
+                const std::size_t n = std::ranges::size(container);
+                for (std::size_t i = 0; i < n; i += simd::moments_block) {
+                    const std::size_t len = n - i < simd::moments_block ? n - i : simd::moments_block;
+                    const auto s = simd::nan_sum(p + i, len);
+                    if (s.count == 0) continue;
+                    moments_state<double> b;
+                    b.count = s.count;
+                    b.mean = s.value / static_cast<double>(s.count);
+                    b.m2 = simd::nan_sq_dev(p + i, len, b.mean);
+                    total = merge(total, b);
+                }
+            } else {
+                for (const auto& x : container) {
+                    const double v = static_cast<double>(x);
+                    if (v == v) push(total, v);
+                }
+            }
+            return total;
+        }
+
+        inline std::optional<double> variance_of(std::size_t count, double m2, std::size_t ddof) {
+            if (count <= ddof) return std::nullopt;
+            return m2 / static_cast<double>(count - ddof);
+        }
+    }
+
+    template<NanPolicy N, Iterable T>
+    requires Divisible<element_t<T>>
+    auto mean(const T& container) -> std::optional<decltype(mean(container))> {
+        CORE_NUMERIC_METRIC("mean", container, (detail::nan_path_vectorized<
+            std::is_same_v<N, nan_policy::skip> && detail::has_nan<element_t<T>>, T>));
+        using Q = element_t<T>;
+        if constexpr (std::is_same_v<N, nan_policy::skip> && detail::has_nan<Q>) {
+            const auto s = detail::skip_nan_sum(container);
+            if (s.count == 0) return std::nullopt;
+            return s.value / static_cast<double>(s.count);
+        } else {
+            if (std::ranges::empty(container)) return std::nullopt;
+            return mean(container); // la suma ya propaga NaN
+        }
+    }
+
+    // ddof = 0: varianza de la poblacion (M2 / n); ddof = 1: muestral (M2 / (n - 1)).
+    template<NanPolicy N, Iterable T>
+    requires Addable<element_t<T>>
+    std::optional<double> variance(const T& container, std::size_t ddof = 0) {
+        CORE_NUMERIC_METRIC("variance", container, (detail::nan_path_vectorized<
+            std::is_same_v<N, nan_policy::skip> && detail::has_nan<element_t<T>>, T>));
+        if constexpr (std::is_same_v<N, nan_policy::skip> && detail::has_nan<element_t<T>>) {
+            const auto m = detail::skip_nan_moments(container);
+            return detail::variance_of(m.count, m.m2, ddof);
+        } else {
+            const auto m = moments(container);
+            return detail::variance_of(m.count, m.m2, ddof);
+        }
+    }
+
+    template<NanPolicy N, Iterable T>
+    requires Comparable<element_t<T>>
+    std::optional<element_t<T>> max(const T& container) {
+        CORE_NUMERIC_METRIC("max", container, (detail::nan_path_vectorized<detail::has_nan<element_t<T>>, T>));
+        using Q = element_t<T>;
+        if (std::ranges::empty(container)) return std::nullopt;
+        if constexpr (detail::has_nan<Q>) {
+            const auto r = detail::skip_nan_extremum<true>(container);
+            if constexpr (std::is_same_v<N, nan_policy::propagate>)
+                if (r.count < detail::count(container)) return detail::quiet_nan<Q>();
+            if (r.count == 0) return std::nullopt;
+            return detail::narrow<Q>(r.value);
+        } else {
+            return max(container);
+        }
+    }
+
+    template<NanPolicy N, Iterable T>
+    requires Comparable<element_t<T>>
+    std::optional<element_t<T>> min(const T& container) {
+        CORE_NUMERIC_METRIC("min", container, (detail::nan_path_vectorized<detail::has_nan<element_t<T>>, T>));
+        using Q = element_t<T>;
+        if (std::ranges::empty(container)) return std::nullopt;
+        if constexpr (detail::has_nan<Q>) {
+            const auto r = detail::skip_nan_extremum<false>(container);
+            if constexpr (std::is_same_v<N, nan_policy::propagate>)
+                if (r.count < detail::count(container)) return detail::quiet_nan<Q>();
+            if (r.count == 0) return std::nullopt;
+            return detail::narrow<Q>(r.value);
+        } else {
+            return min(container);
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_NAN_H
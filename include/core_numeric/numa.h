@@ -0,0 +1,76 @@
+#ifndef CORE_NUMERIC_NUMA_H
+#define CORE_NUMERIC_NUMA_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace core_numeric::numa {
+
+    // Topologia y colocacion de memoria. En Linux usa las llamadas al sistema
+    // mbind/get_mempolicy directamente (no hace falta libnuma); en otros
+    // sistemas hay un solo nodo y la colocacion se ignora.
+
+    // Nodos con CPUs segun /sys (1 si no hay datos).
+    int node_count() noexcept;
+
+    // Nodo que aloja la pagina de p; -1 si no se puede saber. Una pagina aun
+    // no tocada se asigna al consultarla.
+    int node_of(const void* p) noexcept;
+
+    enum class placement {
+        first_touch, // la pagina va al nodo del hilo que la escribe primero
+        interleaved, // paginas repartidas en turno entre todos los nodos
+        bind         // todas las paginas en un nodo concreto
+    };
+
+    // Reserva por paginas con la politica indicada; la memoria llega sin tocar.
+    void* allocate(std::size_t bytes, placement where = placement::first_touch, int node = 0);
+    void deallocate(void* p, std::size_t bytes) noexcept;
+
+    // Arreglo contiguo de T con colocacion NUMA explicita. Es un rango
+    // contiguo, asi que las reducciones (SIMD, paralelas) lo aceptan tal cual.
+    // Los elementos no se inicializan: con first_touch conviene llenarlo con
+    // core_numeric::first_touch(par, buf) para que cada hilo toque sus paginas.
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    class buffer {
+    public:
+        using value_type = T;
+
+        buffer() = default;
+        explicit buffer(std::size_t n, placement where = placement::first_touch, int node = 0)
+            : data_(static_cast<T*>(allocate(n * sizeof(T), where, node))), size_(n) {}
+
+        buffer(const buffer&) = delete;
+        buffer& operator=(const buffer&) = delete;
+        buffer(buffer&& other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+        buffer& operator=(buffer&& other) noexcept {
+            buffer tmp(std::move(other));
+            std::swap(data_, tmp.data_);
+            std::swap(size_, tmp.size_);
+            return *this;
+        }
+
+        ~buffer() { if (data_) deallocate(data_, size_ * sizeof(T)); }
+
+        T* data() { return data_; }
+        const T* data() const { return data_; }
+        std::size_t size() const { return size_; }
+
+        T* begin() { return data_; }
+        T* end() { return data_ + size_; }
+        const T* begin() const { return data_; }
+        const T* end() const { return data_ + size_; }
+
+        T& operator[](std::size_t i) { return data_[i]; }
+        const T& operator[](std::size_t i) const { return data_[i]; }
+
+    private:
+        T* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}
+
+#endif // CORE_NUMERIC_NUMA_H
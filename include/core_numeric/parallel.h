@@ -0,0 +1,271 @@
+#ifndef CORE_NUMERIC_PARALLEL_H
+#define CORE_NUMERIC_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/accumulator.h"
+#include "core_numeric/concepts.h"
+#include "core_numeric/memory.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/numa.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/thread_pool.h"
+
+namespace core_numeric {
+
+    // Politicas de ejecucion propias: par reparte el rango en bloques contiguos,
+    // los reduce en el pool de hilos (default_pool() salvo que se indique otro)
+    // y combina los parciales en orden, asi el resultado es determinista para
+    // un numero fijo de hilos aunque el robo de trabajo cambie quien ejecuta
+    // cada bloque. Por debajo de cutoff elementos se ejecuta en serie.
+    namespace execution {
+        struct sequenced_policy {};
+
+        struct parallel_policy {
+            std::size_t threads = 0;    // 0: tamano del pool
+            std::size_t grain = 32768;  // minimo de elementos por bloque
+            std::size_t cutoff = 65536; // por debajo, en serie
+            thread_pool* pool = nullptr;
+            bool by_node = false;       // enviar cada bloque al nodo NUMA de sus paginas
+
+            constexpr parallel_policy on(std::size_t n) const { return {n, grain, cutoff, pool, by_node}; }
+            constexpr parallel_policy with(thread_pool& p) const { return {threads, grain, cutoff, &p, by_node}; }
+            constexpr parallel_policy numa() const { return {threads, grain, cutoff, pool, true}; }
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+    }
+
+    template<typename P>
+    concept ExecutionPolicy =
+        std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+        std::is_same_v<std::remove_cvref_t<P>, execution::parallel_policy>;
+
+    namespace detail {
+        // Subrango con value_type para poder reutilizar las funciones seriales.
+        template<std::random_access_iterator It>
+        struct slice {
+            using value_type = std::iter_value_t<It>;
+            using iterator = It;
+
+            It first;
+            It last;
+
+            It begin() const { return first; }
+            It end() const { return last; }
+            std::size_t size() const { return static_cast<std::size_t>(last - first); }
+            decltype(auto) operator[](std::size_t i) const { return first[i]; }
+        };
+
+        inline thread_pool& pool_of(const execution::parallel_policy& policy) {
+            return policy.pool ? *policy.pool : default_pool();
+        }
+
+        // Bloques por llamada: hasta parallel_oversubscribe por hilo para que el
+        // robo equilibre la carga, sin bajar de grain elementos por bloque.
+        inline constexpr std::size_t parallel_oversubscribe = 4;
+
+        inline std::size_t chunk_count(const execution::parallel_policy& policy, std::size_t n) {
+            if (n < policy.cutoff) return 1;
+            const std::size_t threads = policy.threads ? policy.threads : pool_of(policy).size();
+            if (threads <= 1) return 1;
+            const std::size_t grain = policy.grain ? policy.grain : 1;
+            return std::clamp<std::size_t>(n / grain, 1, threads * parallel_oversubscribe);
+        }
+
+        // Aplica reduce_chunk a cada bloque en el pool y pliega los parciales
+        // de izquierda a derecha con combine.
+        template<std::ranges::random_access_range T, typename Reduce, typename Combine>
+        auto parallel_reduce(const execution::parallel_policy& policy, const T& container,
+                             Reduce reduce_chunk, Combine combine) {
+            using It = std::ranges::iterator_t<const T>;
+            using R = decltype(reduce_chunk(std::declval<slice<It>>()));
+
+            const std::size_t n = std::ranges::size(container);
+            const std::size_t chunks = chunk_count(policy, n);
+            const It first = std::ranges::begin(container);
+            const auto part = [&](std::size_t c) {
+                return slice<It>{first + static_cast<std::ptrdiff_t>(n * c / chunks),
+                                 first + static_cast<std::ptrdiff_t>(n * (c + 1) / chunks)};
+            };
+
+            CORE_NUMERIC_METRIC_THREADS(chunks < pool_of(policy).size() ? chunks : pool_of(policy).size());
+            if (chunks == 1) return reduce_chunk(part(0));
+
+            std::pmr::vector<R> partial(chunks, scratch_resource());
+            const auto body = [&](std::size_t c) {
+                CORE_NUMERIC_METRIC_QUIET();
+                partial[c] = reduce_chunk(part(c));
+            };
+            if constexpr (std::ranges::contiguous_range<const T>) {
+                // Mismos bloques que sin by_node: solo cambia quien los ejecuta.
+                if (policy.by_node) {
+                    const auto* base = std::ranges::data(container);
+                    pool_of(policy).parallel_for_nodes(chunks,
+                        [&](std::size_t c) { return numa::node_of(base + n * (2 * c + 1) / (2 * chunks)); }, body);
+                } else {
+                    pool_of(policy).parallel_for(chunks, body);
+                }
+            } else {
+                pool_of(policy).parallel_for(chunks, body);
+            }
+
+            R result = partial[0];
+            for (std::size_t c = 1; c < chunks; ++c)
+                result = combine(result, partial[c]);
+            return result;
+        }
+
+        template<typename T>
+        concept Splittable = std::ranges::random_access_range<const T> && std::ranges::sized_range<const T>;
+    }
+
+    // Inicializacion por primer contacto: cada bloque se escribe desde el hilo
+    // que lo ejecuta, asi con un pool fijado a CPUs (thread_pool({0, true}))
+    // las paginas quedan repartidas por nodo en lugar de acabar todas en el
+    // del hilo que reservo. Usa los mismos bloques que las reducciones.
+    template<typename T>
+    void first_touch(const execution::parallel_policy& policy, std::span<T> data, const T& value = T{}) {
+        const std::size_t n = data.size();
+        const std::size_t chunks = detail::chunk_count(policy, n);
+        detail::pool_of(policy).parallel_for(chunks, [&](std::size_t c) {
+            std::fill(data.begin() + n * c / chunks, data.begin() + n * (c + 1) / chunks, value);
+        });
+    }
+
+    template<typename T>
+    void first_touch(const execution::parallel_policy& policy, numa::buffer<T>& data, const T& value = T{}) {
+        first_touch(policy, std::span<T>(data.data(), data.size()), value);
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Addable<element_t<T>>
+    auto sum(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return sum(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("sum", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+            return detail::parallel_reduce(policy, container,
+                [](const auto& part) { return sum(part); },
+                [](auto a, auto b) { return a + b; });
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Divisible<element_t<T>>
+    auto mean(P&& policy, const T& container) {
+        using Q = element_t<T>;
+
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return mean(container);
+        } else if constexpr (std::is_integral_v<Q>) {
+            CORE_NUMERIC_METRIC_PAR("mean", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+            using W = detail::wide_t<Q>;
+            const std::size_t n = detail::count(container);
+            if (n == 0) throw std::invalid_argument("mean: empty range");
+            return static_cast<Q>(sum(policy, container) / static_cast<W>(n));
+        } else {
+            CORE_NUMERIC_METRIC_PAR("mean", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+            double s = detail::parallel_reduce(policy, container,
+                [](const auto& part) { return mean(part) * static_cast<double>(detail::count(part)); },
+                [](double a, double b) { return a + b; });
+            return s / static_cast<double>(detail::count(container));
+        }
+    }
+
+    template<int Order = 2, ExecutionPolicy P, Iterable T>
+    requires Addable<element_t<T>>
+    auto moments(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return moments<Order>(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("moments", container, (Order == 2 && (simd::Contiguous<T> || simd::HalfContiguous<T>)));
+            return detail::parallel_reduce(policy, container,
+                [](const auto& part) { return moments<Order>(part); },
+                [](const auto& a, const auto& b) { return merge<Order>(a, b); });
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Addable<element_t<T>>
+    auto variance(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return variance(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("variance", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+            return variance(moments(policy, container));
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T>
+    requires Comparable<element_t<T>>
+    auto max(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return max(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("max", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+            return detail::parallel_reduce(policy, container,
+                [](const auto& part) { return max(part); },
+                [](auto a, auto b) { return b > a ? b : a; });
+        }
+    }
+
+    template<ExecutionPolicy P, Iterable T, typename F>
+    auto transform_reduce(P&& policy, const T& container, F func) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return transform_reduce(container, func);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("transform_reduce", container, false);
+            return detail::parallel_reduce(policy, container,
+                [&func](const auto& part) { return transform_reduce(part, func); },
+                [](auto a, auto b) { a += b; return a; });
+        }
+    }
+
+    // Cada bloque parte de identity y los parciales se combinan en orden.
+    template<ExecutionPolicy P, Iterable T, typename R, typename Op, typename F>
+    R transform_reduce(P&& policy, const T& container, R identity, Op combine, F func) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return transform_reduce(container, identity, combine, func);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("transform_reduce", container, false);
+            return detail::parallel_reduce(policy, container,
+                [&](const auto& part) { return transform_reduce(part, identity, combine, func); },
+                combine);
+        }
+    }
+
+    template<stats... S, ExecutionPolicy P, Iterable T>
+    requires (sizeof...(S) > 0)
+    auto describe(P&& policy, const T& container) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy> ||
+                      !detail::Splittable<T>) {
+            return describe<S...>(container);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("describe", container, simd::Contiguous<T>);
+            return detail::parallel_reduce(policy, container,
+                [](const auto& part) { return describe<S...>(part); },
+                [](auto a, const auto& b) { a.merge(b); return a; });
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_PARALLEL_H
@@ -0,0 +1,192 @@
+#ifndef CORE_NUMERIC_REDUCTIONS_H
+#define CORE_NUMERIC_REDUCTIONS_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    namespace detail {
+        // Numero de elementos; O(1) en rangos con tamano conocido.
+        template<Iterable T>
+        std::size_t count(const T& container) {
+            return static_cast<std::size_t>(std::ranges::distance(container));
+        }
+
+        // Acumulador de sum: los enteros suman en 64 bits con su signo (exacto
+        // para menos de 2^32 elementos de hasta 32 bits), los flotantes de 16
+        // bits en float y el resto, en su tipo.
+        template<typename Q>
+        using wide_t = typename std::conditional_t<std::is_integral_v<Q>,
+            std::conditional<std::is_signed_v<Q>, std::int64_t, std::uint64_t>,
+            std::conditional<HalfFloat<Q>, float, Q>>::type;
+    }
+
+    // Con enteros devuelve detail::wide_t<Q> (int64_t / uint64_t). Para los
+    // modos con saturacion o comprobacion de desbordamiento ver integer.h.
+    template<Iterable T>
+    requires Addable<element_t<T>>
+    auto sum(const T& container) {
+        CORE_NUMERIC_METRIC("sum", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+        using Q = element_t<T>;
+
+        if constexpr (simd::Contiguous<T> && std::is_same_v<Q, std::int32_t>) {
+            return simd::sum_wide(std::ranges::data(container), std::ranges::size(container));
+        } else if constexpr (simd::HalfContiguous<T>) {
+            return static_cast<float>(simd::sum_wide(std::ranges::data(container), std::ranges::size(container)));
+        } else if constexpr (simd::Contiguous<T>) {
+            return simd::sum(std::ranges::data(container), std::ranges::size(container));
+        } else {
+            detail::wide_t<Q> result{};
+
+            for (const auto &elem : container)
+                result += elem;
+
+            return result;
+        }
+    }
+
+    namespace detail {
+        // Suma en double de la rama flotante de mean; la comparten los acumuladores.
+        template<Iterable T>
+        double floating_sum(const T& container) {
+            using Q = element_t<T>;
+
+            if constexpr (simd::Contiguous<T> && std::is_same_v<Q, double>) {
+                return sum(container);
+            } else if constexpr ((simd::Contiguous<T> && std::is_same_v<Q, float>) || simd::HalfContiguous<T>) {
+                return simd::sum_wide(std::ranges::data(container), std::ranges::size(container));
+            } else {
+                double s = 0.0;
+                for (const auto& x : container) s += static_cast<double>(x);
+                return s;
+            }
+        }
+    }
+
+    // Sin elementos, la media de flotantes es NaN (0 / 0) y la de enteros
+    // lanza std::invalid_argument. Para no tener que elegir, ver nan.h:
+    // mean<nan_policy::propagate>(x) devuelve std::nullopt.
+    template<Iterable T>
+    requires Divisible<element_t<T>>
+    auto mean(const T& container) {
+        CORE_NUMERIC_METRIC("mean", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+        using Q = element_t<T>;
+
+        if constexpr (std::is_integral_v<Q>) {
+            using W = detail::wide_t<Q>;
+            const std::size_t n = detail::count(container);
+            if (n == 0) throw std::invalid_argument("mean: empty range");
+            return static_cast<Q>(sum(container) / static_cast<W>(n));
+        } else {
+            return detail::floating_sum(container) / static_cast<double>(detail::count(container));
+        }
+    }
+
+    // Varianza de la poblacion; NaN sin elementos.
+    template<Iterable T>
+    requires Addable<element_t<T>>
+    auto variance(const T& container) {
+        CORE_NUMERIC_METRIC("variance", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+        return variance(moments(container));
+    }
+
+    // M2 / (n - ddof): ddof = 1 da la varianza muestral. NaN si n <= ddof.
+    template<Iterable T>
+    requires Addable<element_t<T>>
+    double variance(const T& container, std::size_t ddof) {
+        CORE_NUMERIC_METRIC("variance", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+        return variance(moments(container), ddof);
+    }
+
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    auto max(const T& container) {
+        CORE_NUMERIC_METRIC("max", container, (simd::Contiguous<T> || simd::HalfContiguous<T>));
+        using Q = element_t<T>;
+        if (std::ranges::empty(container)) throw std::invalid_argument("max: empty range");
+        if constexpr (simd::Contiguous<T> || simd::HalfContiguous<T>)
+            return simd::max(std::ranges::data(container), std::ranges::size(container));
+
+        auto it = std::ranges::begin(container);
+        const auto last = std::ranges::end(container);
+        Q result = *it;
+
+        for (++it; it != last; ++it) {
+            if (*it > result)
+                result = *it;
+        }
+
+        return result;
+    }
+
+    namespace detail {
+        // Acumuladores independientes de transform_reduce: rompen la cadena de
+        // dependencias para que el compilador vectorice func y combine.
+        inline constexpr std::size_t reduce_lanes = 8;
+    }
+
+    // transform_reduce(c, identity, combine, func): combine debe ser asociativa
+    // y conmutativa, e identity su neutro, como en std::reduce. En rangos
+    // contiguos con resultado aritmetico se reparte en reduce_lanes carriles.
+    template<Iterable T, typename R, typename Op, typename F>
+    requires std::invocable<F&, const element_t<T>&>
+    R transform_reduce(const T& container, R identity, Op combine, F func) {
+        CORE_NUMERIC_METRIC("transform_reduce", container, false);
+        if constexpr (std::ranges::contiguous_range<const T> && std::ranges::sized_range<const T> &&
+                      std::is_arithmetic_v<R>) {
+            constexpr std::size_t L = detail::reduce_lanes;
+            const auto* p = std::ranges::data(container);
+            const std::size_t n = std::ranges::size(container);
+
+            R lane[L];
+            for (std::size_t j = 0; j < L; ++j) lane[j] = identity;
+
+            std::size_t i = 0;
+            for (; i + L <= n; i += L)
+                for (std::size_t j = 0; j < L; ++j)
+                    lane[j] = combine(lane[j], func(p[i + j]));
+
+            R result = identity;
+            for (std::size_t j = 0; j < L; ++j) result = combine(result, lane[j]);
+            for (; i < n; ++i) result = combine(result, func(p[i]));
+            return result;
+        } else {
+            R result = identity;
+
+            for (const auto& x : container)
+                result = combine(result, func(x));
+
+            return result;
+        }
+    }
+
+    template <Iterable T, typename F>
+    auto transform_reduce(const T& container, F func) {
+        CORE_NUMERIC_METRIC("transform_reduce", container, false);
+        using R = decltype(func(*std::ranges::begin(container)));
+
+        if constexpr (std::is_arithmetic_v<R>) {
+            return transform_reduce(container, R{}, std::plus<>{}, func);
+        } else {
+            R result{};
+
+            for (const auto& x : container)
+                result += func(x);
+
+            return result;
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_REDUCTIONS_H
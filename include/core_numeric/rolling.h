@@ -0,0 +1,382 @@
+#ifndef CORE_NUMERIC_ROLLING_H
+#define CORE_NUMERIC_ROLLING_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/accumulator.h"
+#include "core_numeric/concepts.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Estadisticos sobre ventanas deslizantes con coste O(1) por elemento:
+    //   count_window<Q, S>(w)            los ultimos w elementos
+    //   time_window<Q, S, Time>(span)    los elementos con marca en (t - span, t]
+    // S admite stats::count, mean, variance, min y max. mean/variance se
+    // actualizan anadiendo y quitando momentos (Welford); con enteros de hasta
+    // 32 bits se llevan sum x y sum x^2 exactos, asi que coinciden bit a bit
+    // con mean() / variance() sobre la ventana. En punto flotante los momentos
+    // se recalculan desde la ventana cada vez que se han quitado tantos
+    // elementos como tiene, lo que acota la deriva y sigue siendo O(1)
+    // amortizado. min/max usan una cola monotona (O(1) amortizado) y, como
+    // max()/min(), no ven los NaN salvo que la ventana no tenga otra cosa.
+    namespace detail {
+        // Cola circular con capacidad potencia de dos que crece al doble.
+        template<typename T>
+        class ring {
+        public:
+            void reserve(std::size_t n) {
+                if (n > buf_.size()) grow(std::bit_ceil(n));
+            }
+
+            std::size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+
+            const T& front() const { return buf_[head_]; }
+            const T& back() const { return buf_[(head_ + size_ - 1) & mask_]; }
+            const T& operator[](std::size_t i) const { return buf_[(head_ + i) & mask_]; }
+
+            void push_back(const T& x) {
+                if (size_ == buf_.size()) grow(buf_.empty() ? 16 : 2 * buf_.size());
+                buf_[(head_ + size_) & mask_] = x;
+                ++size_;
+            }
+
+            void pop_front() {
+                head_ = (head_ + 1) & mask_;
+                --size_;
+            }
+
+            void pop_back() { --size_; }
+
+            // El contenido en orden, como (a lo sumo) dos tramos contiguos.
+            std::pair<std::span<const T>, std::span<const T>> segments() const {
+                const std::size_t first = size_ < buf_.size() - head_ ? size_ : buf_.size() - head_;
+                return {std::span<const T>(buf_.data() + head_, first),
+                        std::span<const T>(buf_.data(), size_ - first)};
+            }
+
+        private:
+            void grow(std::size_t cap) {
+                std::vector<T> b(cap);
+                for (std::size_t i = 0; i < size_; ++i) b[i] = (*this)[i];
+                buf_.swap(b);
+                head_ = 0;
+                mask_ = cap - 1;
+            }
+
+            std::vector<T> buf_;
+            std::size_t head_ = 0;
+            std::size_t size_ = 0;
+            std::size_t mask_ = 0;
+        };
+
+        // Extremo de la ventana: los candidatos quedan en orden de llegada y
+        // estrictamente peores hacia el final (Better: std::greater para max).
+        // Los NaN no entran en la cola: el ultimo no NaN siempre esta en ella,
+        // asi que la cola vacia con la ventana llena de NaN da NaN.
+        template<typename Q, typename Better>
+        class monotonic_queue {
+        public:
+            void reserve(std::size_t n) { q_.reserve(n); }
+
+            void push(std::uint64_t seq, const Q& x) {
+                if (!(x == x)) {
+                    nan_ = x;
+                    return;
+                }
+                while (!q_.empty() && !Better{}(q_.back().second, x)) q_.pop_back();
+                q_.push_back({seq, x});
+            }
+
+            // Descarta los candidatos anteriores a first (primer numero de secuencia vivo).
+            void evict(std::uint64_t first) {
+                while (!q_.empty() && q_.front().first < first) q_.pop_front();
+            }
+
+            // Con la ventana no vacia.
+            const Q& top() const { return q_.empty() ? nan_ : q_.front().second; }
+
+        private:
+            ring<std::pair<std::uint64_t, Q>> q_;
+            Q nan_{};
+        };
+
+        struct no_window_moments {};
+
+        // Momentos deslizantes en double (Welford con altas y bajas).
+        template<typename Q, bool Exact = exact_integer_moments<Q>>
+        class window_moments {
+        public:
+            void add(const Q& x) {
+                ++n_;
+                if constexpr (std::is_integral_v<Q>) s1_ += x;
+                const double v = static_cast<double>(x);
+                const double d = v - mean_;
+                mean_ += d / static_cast<double>(n_);
+                m2_ += d * (v - mean_);
+            }
+
+            void remove(const Q& x, const ring<Q>& live) {
+                if constexpr (std::is_integral_v<Q>) s1_ -= x;
+                if (--n_ == 0) {
+                    mean_ = m2_ = 0.0;
+                    removed_ = 0;
+                    return;
+                }
+                const double v = static_cast<double>(x);
+                const double d = v - mean_;
+                mean_ -= d / static_cast<double>(n_);
+                m2_ -= d * (v - mean_);
+                if (++removed_ >= n_) rebuild(live);
+            }
+
+            wide_t<Q> sum() const requires std::is_integral_v<Q> { return s1_; }
+            double mean() const { return mean_; }
+            double m2() const { return m2_ < 0.0 ? 0.0 : m2_; }
+
+        private:
+            // Mismo camino que moments() sobre la ventana: kernels SIMD por tramo.
+            void rebuild(const ring<Q>& live) {
+                const auto [a, b] = live.segments();
+                moments_state<Q> s;
+                for (const auto seg : {a, b}) {
+                    if (seg.empty()) continue;
+                    if constexpr (simd::Lane<Q>) s = merge(s, simd::moments<Q, false>(seg.data(), seg.size()));
+                    else for (const auto& x : seg) core_numeric::push(s, x);
+                }
+                mean_ = s.mean;
+                m2_ = s.m2;
+                removed_ = 0;
+            }
+
+            std::size_t n_ = 0;
+            double mean_ = 0.0;
+            double m2_ = 0.0;
+            std::size_t removed_ = 0;
+            [[no_unique_address]] std::conditional_t<std::is_integral_v<Q>, wide_t<Q>, no_window_moments> s1_{};
+        };
+
+        // Enteros de hasta 32 bits: sumas exactas, sin deriva.
+        template<typename Q>
+        class window_moments<Q, true> {
+        public:
+            void add(const Q& x) {
+                ++n_;
+                s1_ += x;
+                sq_ += simd::scalar::sum_sq(&x, 1);
+            }
+
+            void remove(const Q& x, const ring<Q>&) {
+                --n_;
+                s1_ -= x;
+                sq_ -= simd::scalar::sum_sq(&x, 1);
+            }
+
+            wide_t<Q> sum() const { return s1_; }
+            double mean() const { return exact_moments<Q>(n_, s1_, sq_).mean; }
+            double m2() const { return exact_moments<Q>(n_, s1_, sq_).m2; }
+
+        private:
+            std::size_t n_ = 0;
+            wide_t<Q> s1_ = 0;
+            simd::square_sum sq_;
+        };
+
+        template<typename Q>
+        struct no_queue {};
+
+        template<typename Q, stats S>
+        class window_core {
+            static constexpr bool needs_moments = has(S, stats::mean) || has(S, stats::variance);
+            using moments_t = std::conditional_t<needs_moments, window_moments<Q>, no_window_moments>;
+            using max_t = std::conditional_t<has(S, stats::max), monotonic_queue<Q, std::greater<>>, no_queue<Q>>;
+            using min_t = std::conditional_t<has(S, stats::min), monotonic_queue<Q, std::less<>>, no_queue<Q>>;
+
+        public:
+            std::size_t count() const { return values_.size(); }
+            bool empty() const { return values_.empty(); }
+
+            // Como accumulator::mean: con enteros, en el tipo del elemento, y
+            // con la ventana vacia lanza std::invalid_argument (NaN en flotantes).
+            auto mean() const requires (has(S, stats::mean)) {
+                if constexpr (std::is_integral_v<Q>) {
+                    require_nonempty("mean");
+                    return static_cast<Q>(m_.sum() / static_cast<wide_t<Q>>(values_.size()));
+                } else {
+                    return values_.empty() ? std::numeric_limits<double>::quiet_NaN() : m_.mean();
+                }
+            }
+
+            double variance() const requires (has(S, stats::variance)) {
+                return m_.m2() / static_cast<double>(values_.size());
+            }
+
+            // Lanzan std::invalid_argument con la ventana vacia.
+            Q max() const requires (has(S, stats::max)) {
+                require_nonempty("max");
+                return max_.top();
+            }
+
+            Q min() const requires (has(S, stats::min)) {
+                require_nonempty("min");
+                return min_.top();
+            }
+
+        protected:
+            void reserve(std::size_t n) {
+                values_.reserve(n);
+                if constexpr (has(S, stats::max)) max_.reserve(n);
+                if constexpr (has(S, stats::min)) min_.reserve(n);
+            }
+
+            void add(const Q& x) {
+                values_.push_back(x);
+                if constexpr (needs_moments) m_.add(x);
+                if constexpr (has(S, stats::max)) max_.push(next_, x);
+                if constexpr (has(S, stats::min)) min_.push(next_, x);
+                ++next_;
+            }
+
+            void evict_oldest() {
+                const Q x = values_.front();
+                values_.pop_front();
+                if constexpr (needs_moments) m_.remove(x, values_);
+                const std::uint64_t first = next_ - values_.size();
+                if constexpr (has(S, stats::max)) max_.evict(first);
+                if constexpr (has(S, stats::min)) min_.evict(first);
+            }
+
+        private:
+            void require_nonempty(const char* what) const {
+                if (values_.empty()) throw std::invalid_argument(std::string(what) + ": empty window");
+            }
+
+            ring<Q> values_;
+            [[no_unique_address]] moments_t m_;
+            [[no_unique_address]] max_t max_;
+            [[no_unique_address]] min_t min_;
+            std::uint64_t next_ = 0; // numero de secuencia del proximo elemento
+        };
+    }
+
+    // Ventana de los ultimos w elementos. La memoria se reserva al construir.
+    template<typename Q, stats S = stats::mean | stats::variance | stats::max>
+    class count_window : public detail::window_core<Q, S> {
+    public:
+        explicit count_window(std::size_t w) : w_(w) {
+            if (w == 0) throw std::invalid_argument("count_window: window must be positive");
+            this->reserve(w);
+        }
+
+        void push(const Q& x) {
+            if (this->count() == w_) this->evict_oldest();
+            this->add(x);
+        }
+
+        void push(std::span<const Q> xs) {
+            for (const auto& x : xs) push(x);
+        }
+
+        std::size_t window() const { return w_; }
+        bool full() const { return this->count() == w_; }
+
+    private:
+        std::size_t w_;
+    };
+
+    // Ventana temporal: tras push(t, x) contiene los elementos con marca en
+    // (t - span, t]. Las marcas no pueden retroceder (std::invalid_argument).
+    template<typename Q, stats S = stats::mean | stats::variance | stats::max, typename Time = std::int64_t>
+    class time_window : public detail::window_core<Q, S> {
+    public:
+        using duration = decltype(std::declval<Time>() - std::declval<Time>());
+
+        explicit time_window(duration span) : span_(span) {
+            if (!(duration{} < span)) throw std::invalid_argument("time_window: span must be positive");
+        }
+
+        void push(const Time& t, const Q& x) {
+            advance(t);
+            this->add(x);
+            times_.push_back(t);
+        }
+
+        void push(std::span<const Time> ts, std::span<const Q> xs) {
+            if (ts.size() != xs.size()) throw std::invalid_argument("time_window: timestamps and values differ in size");
+            for (std::size_t i = 0; i < ts.size(); ++i) push(ts[i], xs[i]);
+        }
+
+        // Mueve el final de la ventana a t sin anadir nada.
+        void advance(const Time& t) {
+            if (started_ && t < now_) throw std::invalid_argument("time_window: timestamps must not decrease");
+            started_ = true;
+            now_ = t;
+            while (!times_.empty() && !(t - times_.front() < span_)) {
+                times_.pop_front();
+                this->evict_oldest();
+            }
+        }
+
+        duration span() const { return span_; }
+
+    private:
+        duration span_;
+        detail::ring<Time> times_;
+        Time now_{};
+        bool started_ = false;
+    };
+
+    // Un resultado por cada ventana completa de w elementos (n - w + 1 en total);
+    // el i-esimo es el estadistico de los elementos [i, i + w).
+    template<Iterable T>
+    requires Divisible<element_t<T>>
+    auto rolling_mean(const T& container, std::size_t w) {
+        using Q = element_t<T>;
+        count_window<Q, stats::mean> win(w);
+        std::vector<decltype(win.mean())> out;
+        for (const auto& x : container) {
+            win.push(x);
+            if (win.full()) out.push_back(win.mean());
+        }
+        return out;
+    }
+
+    template<Iterable T>
+    requires Addable<element_t<T>>
+    std::vector<double> rolling_variance(const T& container, std::size_t w) {
+        count_window<element_t<T>, stats::variance> win(w);
+        std::vector<double> out;
+        for (const auto& x : container) {
+            win.push(x);
+            if (win.full()) out.push_back(win.variance());
+        }
+        return out;
+    }
+
+    template<Iterable T>
+    requires Comparable<element_t<T>>
+    std::vector<element_t<T>> rolling_max(const T& container, std::size_t w) {
+        count_window<element_t<T>, stats::max> win(w);
+        std::vector<element_t<T>> out;
+        for (const auto& x : container) {
+            win.push(x);
+            if (win.full()) out.push_back(win.max());
+        }
+        return out;
+    }
+}
+
+#endif // CORE_NUMERIC_ROLLING_H
@@ -0,0 +1,352 @@
+#ifndef CORE_NUMERIC_SERIALIZE_H
+#define CORE_NUMERIC_SERIALIZE_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core_numeric/accumulator.h"
+#include "core_numeric/half.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/sketch.h"
+
+// Estados parciales en binario para combinarlos en otro proceso o nodo:
+// moments_state<Q>, accumulator<Q, S> y ddsketch. El tamano no depende de
+// cuantos datos se acumularon (el sketch esta acotado por max_bins), asi que
+// enviar un parcial cuesta O(1) en el tamano de los datos.
+//
+// Formato (little endian, sin relleno):
+//   'C' 'N' version tipo valor stats | campos
+// version es wire_version; tipo, 1 = moments_state, 2 = accumulator,
+// 3 = ddsketch; valor identifica Q (ver detail::wire::type_tag) y stats es la
+// mascara del acumulador. Los campos son los del estado, y en un acumulador
+// solo los de los estadisticos pedidos. Una version nueva solo puede anadir
+// campos al final; deserialize() rechaza versiones que no conoce.
+//
+// deserialize() lee los campos directamente del buffer, sin copia intermedia,
+// y merge_serialized() combina un parcial recibido con uno local sin
+// construir el objeto (los cubos del sketch se suman desde el buffer). Un
+// buffer truncado, de otro tipo o con estadisticos distintos lanza
+// std::invalid_argument.
+namespace core_numeric {
+
+    inline constexpr std::uint8_t wire_version = 1;
+
+    namespace detail::wire {
+        inline constexpr std::size_t header_size = 6;
+
+        template<typename T>
+        concept Field = std::is_arithmetic_v<T> || HalfFloat<T>;
+
+        // Clase en el nibble alto y log2 del tamano en el bajo.
+        template<Field T>
+        constexpr std::uint8_t type_tag() {
+            constexpr std::uint8_t size_bits = std::bit_width(sizeof(T)) - 1;
+            if constexpr (HalfFloat<T>) return std::is_same_v<half_storage_t<T>, float16> ? 0x41 : 0x51;
+            else if constexpr (std::is_floating_point_v<T>) {
+                static_assert(sizeof(T) <= 8, "serialize: long double has no portable representation");
+                return 0x30 | size_bits;
+            } else if constexpr (std::is_signed_v<T>) return 0x10 | size_bits;
+            else return 0x20 | size_bits;
+        }
+
+        template<Field T>
+        void put(std::byte*& p, T v) {
+            auto b = std::bit_cast<std::array<std::byte, sizeof(T)>>(v);
+            if constexpr (std::endian::native == std::endian::big)
+                for (std::size_t i = 0; i < sizeof(T) / 2; ++i) std::swap(b[i], b[sizeof(T) - 1 - i]);
+            std::memcpy(p, b.data(), sizeof(T));
+            p += sizeof(T);
+        }
+
+        template<Field T>
+        T load(const std::byte* p) {
+            std::array<std::byte, sizeof(T)> b;
+            std::memcpy(b.data(), p, sizeof(T));
+            if constexpr (std::endian::native == std::endian::big)
+                for (std::size_t i = 0; i < sizeof(T) / 2; ++i) std::swap(b[i], b[sizeof(T) - 1 - i]);
+            return std::bit_cast<T>(b);
+        }
+
+        struct reader {
+            const std::byte* p;
+            const std::byte* end;
+
+            void need(std::size_t n) const {
+                if (static_cast<std::size_t>(end - p) < n) throw std::invalid_argument("deserialize: truncated buffer");
+            }
+
+            template<Field T>
+            T get() {
+                need(sizeof(T));
+                const T v = load<T>(p);
+                p += sizeof(T);
+                return v;
+            }
+
+            // Reserva n valores de 64 bits y devuelve donde empiezan.
+            const std::byte* take_words(std::uint64_t n) {
+                if (n > static_cast<std::size_t>(end - p) / 8) throw std::invalid_argument("deserialize: truncated buffer");
+                const std::byte* start = p;
+                p += n * 8;
+                return start;
+            }
+        };
+    }
+
+    namespace detail {
+        template<typename X> struct wire_kind {};
+
+        template<typename Q>
+        struct wire_kind<moments_state<Q>> {
+            static constexpr std::uint8_t kind = 1, value = wire::type_tag<Q>(), mask = 0;
+        };
+
+        template<typename Q, stats S>
+        struct wire_kind<accumulator<Q, S>> {
+            static constexpr std::uint8_t kind = 2, value = wire::type_tag<Q>();
+            static constexpr std::uint8_t mask = static_cast<std::uint8_t>(S);
+        };
+
+        template<>
+        struct wire_kind<ddsketch> {
+            static constexpr std::uint8_t kind = 3, value = wire::type_tag<double>(), mask = 0;
+        };
+
+        // Lee y escribe los campos privados; amigo de accumulator y ddsketch.
+        struct state_codec {
+            // moments_state: count, mean, m2, m3, m4, min, max.
+            template<typename Q>
+            static std::size_t size(const moments_state<Q>&) { return 5 * 8 + 2 * sizeof(Q); }
+
+            template<typename Q>
+            static void write(std::byte*& p, const moments_state<Q>& m) {
+                wire::put(p, static_cast<std::uint64_t>(m.count));
+                wire::put(p, m.mean);
+                wire::put(p, m.m2);
+                wire::put(p, m.m3);
+                wire::put(p, m.m4);
+                wire::put(p, m.min);
+                wire::put(p, m.max);
+            }
+
+            template<typename Q>
+            static void read(wire::reader& r, moments_state<Q>& m) {
+                m.count = static_cast<std::size_t>(r.get<std::uint64_t>());
+                m.mean = r.get<double>();
+                m.m2 = r.get<double>();
+                m.m3 = r.get<double>();
+                m.m4 = r.get<double>();
+                m.min = r.get<Q>();
+                m.max = r.get<Q>();
+            }
+
+            template<typename Q>
+            static void merge(wire::reader& r, moments_state<Q>& into) {
+                moments_state<Q> m;
+                read(r, m);
+                into = core_numeric::merge<4>(into, m);
+            }
+
+            // ddsketch: accuracy, max_bins, count, zeros, min, max y los dos
+            // stores (offset, numero de cubos, cubos).
+            static std::size_t size(const ddsketch& s) {
+                return 6 * 8 + 2 * 8 * 2 + 8 * (s.negative_.bins.size() + s.positive_.bins.size());
+            }
+
+            static void write(std::byte*& p, const ddsketch& s) {
+                wire::put(p, s.accuracy_);
+                wire::put(p, static_cast<std::uint64_t>(s.max_bins_));
+                wire::put(p, static_cast<std::uint64_t>(s.count_));
+                wire::put(p, s.zeros_);
+                wire::put(p, s.min_);
+                wire::put(p, s.max_);
+                for (const auto* st : {&s.negative_, &s.positive_}) {
+                    wire::put(p, st->offset);
+                    wire::put(p, static_cast<std::uint64_t>(st->bins.size()));
+                    for (auto c : st->bins) wire::put(p, c);
+                }
+            }
+
+            static void read(wire::reader& r, ddsketch& s) {
+                const double accuracy = r.get<double>();
+                const auto max_bins = r.get<std::uint64_t>();
+                s = ddsketch(accuracy, static_cast<std::size_t>(max_bins)); // valida
+                s.count_ = static_cast<std::size_t>(r.get<std::uint64_t>());
+                s.zeros_ = r.get<std::uint64_t>();
+                s.min_ = r.get<double>();
+                s.max_ = r.get<double>();
+                for (auto* st : {&s.negative_, &s.positive_}) {
+                    st->offset = r.get<std::int64_t>();
+                    const auto n = r.get<std::uint64_t>();
+                    const std::byte* bins = r.take_words(n);
+                    st->bins.resize(static_cast<std::size_t>(n));
+                    for (std::size_t k = 0; k < st->bins.size(); ++k) st->bins[k] = wire::load<std::uint64_t>(bins + 8 * k);
+                }
+            }
+
+            // Igual que ddsketch::merge, con los cubos leidos del buffer.
+            static void merge(wire::reader& r, ddsketch& into) {
+                const double accuracy = r.get<double>();
+                (void)r.get<std::uint64_t>(); // max_bins: manda el de into
+                const auto count = static_cast<std::size_t>(r.get<std::uint64_t>());
+                const auto zeros = r.get<std::uint64_t>();
+                const double lo = r.get<double>();
+                const double hi = r.get<double>();
+                if (accuracy != into.accuracy_)
+                    throw std::invalid_argument("ddsketch: merging sketches with different accuracy");
+                for (auto* st : {&into.negative_, &into.positive_}) {
+                    const auto offset = r.get<std::int64_t>();
+                    const auto n = r.get<std::uint64_t>();
+                    const std::byte* bins = r.take_words(n);
+                    // De mayor a menor, como store::merge.
+                    for (std::size_t k = static_cast<std::size_t>(n); k-- > 0;)
+                        if (const auto c = wire::load<std::uint64_t>(bins + 8 * k))
+                            st->add(offset + static_cast<std::int64_t>(k), c, into.max_bins_);
+                }
+                if (count == 0) return;
+                into.count_ += count;
+                into.zeros_ += zeros;
+                if (lo < into.min_) into.min_ = lo;
+                if (hi > into.max_) into.max_ = hi;
+            }
+
+            // accumulator: count y los campos de los estadisticos de S.
+            template<typename Q, stats S>
+            static std::size_t size(const accumulator<Q, S>& a) {
+                using A = accumulator<Q, S>;
+                std::size_t n = 8;
+                if constexpr (has(S, stats::sum)) n += sizeof(typename A::sum_t);
+                if constexpr (has(S, stats::mean)) n += sizeof(typename A::mean_sum_t);
+                if constexpr (A::needs_moments) n += 2 * 8;
+                if constexpr (A::needs_moments || A::needs_extrema) n += 2 * sizeof(Q);
+                if constexpr (A::needs_sketch) n += size(a.sketch_);
+                return n;
+            }
+
+            template<typename Q, stats S>
+            static void write(std::byte*& p, const accumulator<Q, S>& a) {
+                using A = accumulator<Q, S>;
+                wire::put(p, static_cast<std::uint64_t>(a.count_));
+                if constexpr (has(S, stats::sum)) wire::put(p, a.sum_);
+                if constexpr (has(S, stats::mean)) wire::put(p, a.mean_sum_);
+                if constexpr (A::needs_moments) {
+                    wire::put(p, a.m_.mean);
+                    wire::put(p, a.m_.m2);
+                }
+                if constexpr (A::needs_moments || A::needs_extrema) {
+                    wire::put(p, a.m_.min);
+                    wire::put(p, a.m_.max);
+                }
+                if constexpr (A::needs_sketch) write(p, a.sketch_);
+            }
+
+            // Todo menos el sketch, que read y merge tratan aparte.
+            template<typename Q, stats S>
+            static void read_fields(wire::reader& r, accumulator<Q, S>& a) {
+                using A = accumulator<Q, S>;
+                a.count_ = static_cast<std::size_t>(r.get<std::uint64_t>());
+                if constexpr (has(S, stats::sum)) a.sum_ = r.get<typename A::sum_t>();
+                if constexpr (has(S, stats::mean)) a.mean_sum_ = r.get<typename A::mean_sum_t>();
+                if constexpr (A::needs_moments) {
+                    a.m_.count = a.count_;
+                    a.m_.mean = r.get<double>();
+                    a.m_.m2 = r.get<double>();
+                }
+                if constexpr (A::needs_moments || A::needs_extrema) {
+                    a.m_.min = r.get<Q>();
+                    a.m_.max = r.get<Q>();
+                }
+            }
+
+            template<typename Q, stats S>
+            static void read(wire::reader& r, accumulator<Q, S>& a) {
+                read_fields(r, a);
+                if constexpr (accumulator<Q, S>::needs_sketch) read(r, a.sketch_);
+            }
+
+            template<typename Q, stats S>
+            static void merge(wire::reader& r, accumulator<Q, S>& into) {
+                accumulator<Q, S> other;
+                if constexpr (accumulator<Q, S>::needs_sketch)
+                    other.sketch_ = ddsketch(into.sketch_.relative_accuracy(), into.sketch_.max_bins());
+                read_fields(r, other);
+                into.merge(other); // el sketch de other esta vacio
+                if constexpr (accumulator<Q, S>::needs_sketch) merge(r, into.sketch_);
+            }
+        };
+
+        template<typename X>
+        wire::reader open(std::span<const std::byte> bytes) {
+            using K = wire_kind<X>;
+            wire::reader r{bytes.data(), bytes.data() + bytes.size()};
+            r.need(wire::header_size);
+            const auto* h = bytes.data();
+            if (h[0] != std::byte{'C'} || h[1] != std::byte{'N'}) throw std::invalid_argument("deserialize: not a core_numeric state");
+            if (static_cast<std::uint8_t>(h[2]) > wire_version) throw std::invalid_argument("deserialize: unknown version");
+            if (static_cast<std::uint8_t>(h[3]) != K::kind || static_cast<std::uint8_t>(h[4]) != K::value)
+                throw std::invalid_argument("deserialize: state of a different type");
+            if (static_cast<std::uint8_t>(h[5]) != K::mask) throw std::invalid_argument("deserialize: accumulator stats do not match");
+            r.p += wire::header_size;
+            return r;
+        }
+
+        inline void close(const wire::reader& r) {
+            if (r.p != r.end) throw std::invalid_argument("deserialize: trailing bytes");
+        }
+    }
+
+    template<typename X>
+    concept Serializable = requires { detail::wire_kind<X>::kind; };
+
+    template<Serializable X>
+    std::size_t serialized_size(const X& x) {
+        return detail::wire::header_size + detail::state_codec::size(x);
+    }
+
+    // Escribe en out y devuelve los bytes usados; lanza std::invalid_argument
+    // si out es mas corto que serialized_size(x).
+    template<Serializable X>
+    std::size_t serialize(const X& x, std::span<std::byte> out) {
+        using K = detail::wire_kind<X>;
+        const std::size_t n = serialized_size(x);
+        if (out.size() < n) throw std::invalid_argument("serialize: buffer too small");
+        std::byte* p = out.data();
+        for (std::uint8_t b : {std::uint8_t{'C'}, std::uint8_t{'N'}, wire_version, K::kind, K::value, K::mask})
+            *p++ = static_cast<std::byte>(b);
+        detail::state_codec::write(p, x);
+        return n;
+    }
+
+    template<Serializable X>
+    std::vector<std::byte> serialize(const X& x) {
+        std::vector<std::byte> out(serialized_size(x));
+        serialize(x, std::span<std::byte>(out));
+        return out;
+    }
+
+    template<Serializable X>
+    X deserialize(std::span<const std::byte> bytes) {
+        auto r = detail::open<X>(bytes);
+        X x;
+        detail::state_codec::read(r, x);
+        detail::close(r);
+        return x;
+    }
+
+    // into.merge(deserialize<X>(bytes)) sin construir el parcial.
+    template<Serializable X>
+    void merge_serialized(X& into, std::span<const std::byte> bytes) {
+        auto r = detail::open<X>(bytes);
+        detail::state_codec::merge(r, into);
+        detail::close(r);
+    }
+}
+
+#endif // CORE_NUMERIC_SERIALIZE_H
@@ -0,0 +1,338 @@
+#ifndef CORE_NUMERIC_SIMD_H
+#define CORE_NUMERIC_SIMD_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+#include "core_numeric/half.h"
+
+namespace core_numeric {
+
+    // Kernels SIMD para rangos contiguos de tipos aritmeticos.
+    // Se elige AVX-512 / AVX2 / NEON en tiempo de ejecucion; si no hay soporte
+    // se usa el lazo escalar. Tolerancia: los enteros y max dan exactamente el
+    // mismo resultado que el lazo generico; en punto flotante la suma se
+    // reasocia por carriles, asi que |simd - escalar| <= n * eps * sum|x_i|.
+    namespace simd {
+
+        enum class isa { scalar, neon, avx2, avx512 };
+
+        // Nivel SIMD de la CPU actual; se detecta una vez (src/dispatch.cpp).
+        isa detect();
+
+        // Variante en uso. Antes de main se fija una tabla de punteros con los
+        // kernels de detect() (o de CORE_NUMERIC_ISA=scalar|neon|avx2|avx512 si
+        // pide un nivel que la CPU tenga), asi cada llamada es un salto
+        // indirecto sin comprobaciones. La biblioteca se compila para el x86-64
+        // base: las instrucciones de cada ISA solo estan en sus kernels.
+        isa active();
+
+        // Cambia la variante para todo el proceso (pruebas, comparar kernels).
+        // Lanza std::invalid_argument si la CPU o la compilacion no la tienen.
+        void use(isa level);
+
+        constexpr const char* name(isa level) {
+            switch (level) {
+                case isa::avx512: return "avx512";
+                case isa::avx2:   return "avx2";
+                case isa::neon:   return "neon";
+                default:          return "scalar";
+            }
+        }
+
+        template<typename T>
+        concept Lane =
+            std::is_same_v<T, double> || std::is_same_v<T, float> ||
+            std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t>;
+
+        // Rango contiguo cuyos elementos puede leer un kernel directamente.
+        template<typename C>
+        concept Contiguous =
+            std::ranges::contiguous_range<const C> &&
+            std::ranges::sized_range<const C> &&
+            Lane<std::remove_cv_t<std::ranges::range_value_t<const C>>>;
+
+        // Rango contiguo de flotantes de 16 bits: los kernels lo ensanchan a float.
+        template<typename C>
+        concept HalfContiguous =
+            std::ranges::contiguous_range<const C> &&
+            std::ranges::sized_range<const C> &&
+            HalfFloat<std::remove_cv_t<std::ranges::range_value_t<const C>>>;
+
+        // Mismos bits vistos como float16 / bfloat16 (para std::float16_t y std::bfloat16_t).
+        template<HalfFloat T>
+        const half_storage_t<T>* storage(const T* p) {
+            return reinterpret_cast<const half_storage_t<T>*>(p);
+        }
+
+        // Suma exacta de x^2 partida en dos mitades (total = hi * 2^32 + lo) para
+        // que cada carril acumule en 64 bits sin desbordar. Exacta para enteros
+        // de hasta 32 bits y menos de 2^32 elementos.
+        struct square_sum {
+            std::uint64_t hi = 0;
+            std::uint64_t lo = 0;
+
+            square_sum& operator+=(const square_sum& o) {
+                hi += o.hi;
+                lo += o.lo;
+                return *this;
+            }
+
+            // Quitar un sumando que ya estaba incluido (ventanas deslizantes).
+            square_sum& operator-=(const square_sum& o) {
+                hi -= o.hi;
+                lo -= o.lo;
+                return *this;
+            }
+        };
+
+        // Suma de los pesos y de w * x (weighted_sum).
+        struct weighted_sums {
+            double weight = 0.0;
+            double sum = 0.0;
+        };
+
+        // Kernels que saltan NaN: valor sobre los elementos que no son NaN y
+        // cuantos son (count < n si habia NaN).
+        struct nan_skipped {
+            double value = 0.0;
+            std::size_t count = 0;
+        };
+
+        // Mascaras de validez como en Apache Arrow: el elemento i es valido si
+        // el bit (i % 8) del byte i / 8 esta a 1 (bit menos significativo primero).
+        inline bool valid_bit(const std::uint8_t* bits, std::size_t i) {
+            return (bits[i >> 3] >> (i & 7)) & 1u;
+        }
+
+        namespace scalar {
+            template<typename T>
+            square_sum sum_sq(const T* p, std::size_t n) {
+                square_sum r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::uint64_t a = static_cast<std::uint64_t>(p[i]);
+                    if constexpr (std::is_signed_v<T>) if (p[i] < 0) a = 0 - a;
+                    const std::uint64_t sq = a * a;
+                    r.hi += sq >> 32;
+                    r.lo += sq & 0xffffffffu;
+                }
+                return r;
+            }
+
+            template<typename T, typename R = T>
+            R sum(const T* p, std::size_t n) {
+                R acc{};
+                for (std::size_t i = 0; i < n; ++i) acc += p[i];
+                return acc;
+            }
+
+            template<typename T>
+            T max(const T* p, std::size_t n) {
+                T result = p[0];
+                for (std::size_t i = 1; i < n; ++i)
+                    if (p[i] > result) result = p[i];
+                return result;
+            }
+
+            template<typename T>
+            T min(const T* p, std::size_t n) {
+                T result = p[0];
+                for (std::size_t i = 1; i < n; ++i)
+                    if (p[i] < result) result = p[i];
+                return result;
+            }
+
+            template<typename T>
+            double sq_dev(const T* p, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    double d = static_cast<double>(p[i]) - mu;
+                    acc += d * d;
+                }
+                return acc;
+            }
+
+            template<typename T, typename U = T>
+            weighted_sums weighted_sum(const T* x, const U* w, std::size_t n) {
+                weighted_sums r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    r.weight += static_cast<double>(w[i]);
+                    r.sum += static_cast<double>(w[i]) * static_cast<double>(x[i]);
+                }
+                return r;
+            }
+
+            template<typename T, typename U = T>
+            double weighted_sq_dev(const T* x, const U* w, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double d = static_cast<double>(x[i]) - mu;
+                    acc += static_cast<double>(w[i]) * d * d;
+                }
+                return acc;
+            }
+
+            template<typename T>
+            double masked_sum(const T* x, const std::uint8_t* bits, std::size_t n) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i)
+                    if (valid_bit(bits, i)) acc += static_cast<double>(x[i]);
+                return acc;
+            }
+
+            template<typename T>
+            double masked_sq_dev(const T* x, const std::uint8_t* bits, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (!valid_bit(bits, i)) continue;
+                    const double d = static_cast<double>(x[i]) - mu;
+                    acc += d * d;
+                }
+                return acc;
+            }
+
+            // -inf si no hay ningun elemento valido.
+            template<typename T>
+            T masked_max(const T* x, const std::uint8_t* bits, std::size_t n) {
+                T result = -std::numeric_limits<T>::infinity();
+                for (std::size_t i = 0; i < n; ++i)
+                    if (valid_bit(bits, i) && x[i] > result) result = x[i];
+                return result;
+            }
+
+            template<typename T>
+            nan_skipped nan_sum(const T* x, std::size_t n) {
+                nan_skipped r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double v = static_cast<double>(x[i]);
+                    const bool ok = v == v;
+                    r.value += ok ? v : 0.0;
+                    r.count += ok;
+                }
+                return r;
+            }
+
+            template<typename T>
+            double nan_sq_dev(const T* x, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double d = static_cast<double>(x[i]) - mu;
+                    acc += d == d ? d * d : 0.0;
+                }
+                return acc;
+            }
+
+            // value es -inf (nan_max) o +inf (nan_min) si no hay elementos validos.
+            template<typename T>
+            nan_skipped nan_max(const T* x, std::size_t n) {
+                nan_skipped r{-std::numeric_limits<double>::infinity(), 0};
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double v = static_cast<double>(x[i]);
+                    r.count += v == v;
+                    if (v > r.value) r.value = v;
+                }
+                return r;
+            }
+
+            template<typename T>
+            nan_skipped nan_min(const T* x, std::size_t n) {
+                nan_skipped r{std::numeric_limits<double>::infinity(), 0};
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double v = static_cast<double>(x[i]);
+                    r.count += v == v;
+                    if (v < r.value) r.value = v;
+                }
+                return r;
+            }
+        }
+
+        // Puntos de entrada con despacho; los kernels viven en src/kernels_<isa>.cpp.
+        double sum(const double* p, std::size_t n);
+        float sum(const float* p, std::size_t n);
+        std::int32_t sum(const std::int32_t* p, std::size_t n);
+        std::int64_t sum(const std::int64_t* p, std::size_t n);
+
+        // Suma de float acumulada en double, como la rama flotante de mean.
+        double sum_wide(const float* p, std::size_t n);
+        // Suma de int32 en carriles de 64 bits: exacta para n < 2^32.
+        std::int64_t sum_wide(const std::int32_t* p, std::size_t n);
+
+        // Suma exacta de x^2 (ver square_sum).
+        square_sum sum_sq(const std::int32_t* p, std::size_t n);
+
+        double max(const double* p, std::size_t n);
+        float max(const float* p, std::size_t n);
+        std::int32_t max(const std::int32_t* p, std::size_t n);
+        std::int64_t max(const std::int64_t* p, std::size_t n);
+
+        double min(const double* p, std::size_t n);
+        float min(const float* p, std::size_t n);
+        std::int32_t min(const std::int32_t* p, std::size_t n);
+        std::int64_t min(const std::int64_t* p, std::size_t n);
+
+        // Suma de (x - mu)^2.
+        double sq_dev(const double* p, std::size_t n, double mu);
+        double sq_dev(const float* p, std::size_t n, double mu);
+        double sq_dev(const std::int32_t* p, std::size_t n, double mu);
+        double sq_dev(const std::int64_t* p, std::size_t n, double mu);
+
+        // Pesos y mascaras para double y float, acumulando en double. Los
+        // kernels con mascara leen ceil(n / 8) bytes de bits y nunca suman
+        // las posiciones invalidas (aunque sean NaN).
+        weighted_sums weighted_sum(const double* x, const double* w, std::size_t n);
+        weighted_sums weighted_sum(const float* x, const float* w, std::size_t n);
+        double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu);
+        double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu);
+
+        double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_max(const double* x, const std::uint8_t* bits, std::size_t n);
+        float masked_max(const float* x, const std::uint8_t* bits, std::size_t n);
+
+        // Saltando NaN (nan.h), acumulando en double. El conteo de validos sale
+        // del mismo recorrido, sin ramas: una comparacion x == x por carril.
+        nan_skipped nan_sum(const double* x, std::size_t n);
+        nan_skipped nan_sum(const float* x, std::size_t n);
+        double nan_sq_dev(const double* x, std::size_t n, double mu);
+        double nan_sq_dev(const float* x, std::size_t n, double mu);
+        nan_skipped nan_max(const double* x, std::size_t n);
+        nan_skipped nan_max(const float* x, std::size_t n);
+        nan_skipped nan_min(const double* x, std::size_t n);
+        nan_skipped nan_min(const float* x, std::size_t n);
+
+        // Flotantes de 16 bits. Cada carril suma en float durante bloques cortos
+        // (half_block elementos) y el total se lleva en double, asi que el error
+        // es del orden del de sum_wide(const float*) y no del de 16 bits.
+        inline constexpr std::size_t half_block = 512;
+
+        double sum_wide(const float16* p, std::size_t n);
+        double sum_wide(const bfloat16* p, std::size_t n);
+        double sq_dev(const float16* p, std::size_t n, double mu);
+        double sq_dev(const bfloat16* p, std::size_t n, double mu);
+        float16 max(const float16* p, std::size_t n);
+        bfloat16 max(const bfloat16* p, std::size_t n);
+        float16 min(const float16* p, std::size_t n);
+        bfloat16 min(const bfloat16* p, std::size_t n);
+
+        // std::float16_t / std::bfloat16_t usan los kernels de float16 / bfloat16.
+        template<HalfFloat T> requires (!std::is_same_v<T, half_storage_t<T>>)
+        double sum_wide(const T* p, std::size_t n) { return sum_wide(storage(p), n); }
+
+        template<HalfFloat T> requires (!std::is_same_v<T, half_storage_t<T>>)
+        double sq_dev(const T* p, std::size_t n, double mu) { return sq_dev(storage(p), n, mu); }
+
+        template<HalfFloat T> requires (!std::is_same_v<T, half_storage_t<T>>)
+        T max(const T* p, std::size_t n) { return std::bit_cast<T>(max(storage(p), n)); }
+
+        template<HalfFloat T> requires (!std::is_same_v<T, half_storage_t<T>>)
+        T min(const T* p, std::size_t n) { return std::bit_cast<T>(min(storage(p), n)); }
+    }
+}
+
+#endif // CORE_NUMERIC_SIMD_H
@@ -0,0 +1,207 @@
+#ifndef CORE_NUMERIC_STREAM_H
+#define CORE_NUMERIC_STREAM_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <concepts>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/accumulator.h"
+#include "core_numeric/memory.h"
+
+namespace core_numeric {
+
+    // Fuente de bloques: read(buf) llena buf y devuelve cuantos elementos leyo;
+    // 0 indica fin de datos. Sirve para archivos, pipes, sockets o memoria.
+    template<typename S>
+    concept ChunkSource = requires (S& s, std::span<typename S::value_type> buf) {
+        { s.read(buf) } -> std::convertible_to<std::size_t>;
+    };
+
+    // Lectura de bytes sobre std::FILE*: funciona con archivos normales, pipes
+    // y stdin, donde mmap no sirve. Los errores se lanzan como std::system_error.
+    class file_stream {
+    public:
+        explicit file_stream(const std::string& path);
+        explicit file_stream(std::FILE* file, bool owns = false) : file_(file), owns_(owns) {}
+
+        file_stream(const file_stream&) = delete;
+        file_stream& operator=(const file_stream&) = delete;
+        file_stream(file_stream&& other) noexcept
+            : file_(std::exchange(other.file_, nullptr)), owns_(other.owns_) {}
+
+        ~file_stream();
+
+        // Lee hasta n bytes; devuelve menos solo al llegar al final.
+        std::size_t read(std::byte* dst, std::size_t n);
+
+    private:
+        std::FILE* file_ = nullptr;
+        bool owns_ = false;
+    };
+
+    template<typename T>
+    requires std::is_trivially_copyable_v<T>
+    class file_source {
+    public:
+        using value_type = T;
+
+        explicit file_source(const std::string& path) : in_(path) {}
+        explicit file_source(std::FILE* file) : in_(file) {}
+
+        std::size_t read(std::span<T> buf) {
+            const std::size_t bytes = in_.read(reinterpret_cast<std::byte*>(buf.data()), buf.size_bytes());
+            if (bytes % sizeof(T) != 0)
+                throw std::runtime_error("file_source: stream ended inside an element");
+            return bytes / sizeof(T);
+        }
+
+    private:
+        file_stream in_;
+    };
+
+    template<typename T>
+    class span_source {
+    public:
+        using value_type = T;
+
+        explicit span_source(std::span<const T> data) : data_(data) {}
+
+        std::size_t read(std::span<T> buf) {
+            const std::size_t n = buf.size() < data_.size() ? buf.size() : data_.size();
+            std::copy_n(data_.begin(), n, buf.begin());
+            data_ = data_.subspan(n);
+            return n;
+        }
+
+    private:
+        std::span<const T> data_;
+    };
+
+    struct stream_options {
+        std::size_t chunk_elems = std::size_t{1} << 16; // elementos por bloque
+        std::size_t buffers = 3;                        // bloques en vuelo (>= 2)
+    };
+
+    // Lector con prefetch: un hilo llena un anillo de buffers reutilizables
+    // mientras el consumidor reduce el bloque anterior. next() devuelve el
+    // siguiente bloque (vacio al final) y libera el que se devolvio antes.
+    // Un error en el hilo lector se relanza desde next().
+    template<ChunkSource Src>
+    class chunk_reader {
+        using T = typename Src::value_type;
+
+    public:
+        chunk_reader(Src& source, stream_options opts = {})
+            : source_(source),
+              buffers_(opts.buffers < 2 ? 2 : opts.buffers, scratch_resource()),
+              lengths_(buffers_.size(), 0, scratch_resource()),
+              producer_(start(opts.chunk_elems ? opts.chunk_elems : 1)) {}
+
+        chunk_reader(const chunk_reader&) = delete;
+        chunk_reader& operator=(const chunk_reader&) = delete;
+
+        ~chunk_reader() {
+            {
+                std::lock_guard lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            producer_.join();
+        }
+
+        std::span<const T> next() {
+            std::unique_lock lock(mutex_);
+            if (holding_) {
+                holding_ = false;
+                ++released_;
+                cv_.notify_all();
+            }
+            cv_.wait(lock, [this] { return produced_ > taken_ || done_; });
+            if (produced_ == taken_) {
+                if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+                return {};
+            }
+            const std::size_t slot = taken_++ % buffers_.size();
+            holding_ = true;
+            return {buffers_[slot].data(), lengths_[slot]};
+        }
+
+    private:
+        // Dimensiona los buffers antes de lanzar el hilo lector.
+        std::thread start(std::size_t chunk_elems) {
+            for (auto& b : buffers_) b.resize(chunk_elems);
+            return std::thread([this] { produce(); });
+        }
+
+        void produce() {
+            try {
+                for (std::size_t i = 0;; ++i) {
+                    {
+                        std::unique_lock lock(mutex_);
+                        cv_.wait(lock, [&] { return stop_ || i - released_ < buffers_.size(); });
+                        if (stop_) break;
+                    }
+                    // La lectura va fuera del candado: es lo que se solapa con el calculo.
+                    const std::size_t slot = i % buffers_.size();
+                    const std::size_t n = source_.read(std::span<T>(buffers_[slot]));
+                    std::lock_guard lock(mutex_);
+                    if (n == 0) break;
+                    lengths_[slot] = n;
+                    ++produced_;
+                    cv_.notify_all();
+                }
+            } catch (...) {
+                std::lock_guard lock(mutex_);
+                error_ = std::current_exception();
+            }
+            std::lock_guard lock(mutex_);
+            done_ = true;
+            cv_.notify_all();
+        }
+
+        Src& source_;
+        std::pmr::vector<std::pmr::vector<T>> buffers_;
+        std::pmr::vector<std::size_t> lengths_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::size_t produced_ = 0;
+        std::size_t taken_ = 0;
+        std::size_t released_ = 0;
+        bool holding_ = false;
+        bool done_ = false;
+        bool stop_ = false;
+        std::exception_ptr error_;
+
+        std::thread producer_;
+    };
+
+    // reduce_stream<stats::mean, stats::variance, stats::max>(source): una
+    // pasada sobre un flujo sin cargarlo entero en memoria. Cada bloque se
+    // empuja al acumulador igual que en describe mientras se lee el siguiente.
+    template<stats... S, typename Src>
+    requires (sizeof...(S) > 0) && ChunkSource<std::remove_cvref_t<Src>>
+    auto reduce_stream(Src&& source, stream_options opts = {}) {
+        using T = typename std::remove_cvref_t<Src>::value_type;
+        accumulator<T, (stats::none | ... | S)> acc;
+
+        chunk_reader<std::remove_cvref_t<Src>> reader(source, opts);
+        for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+            detail::push_blocks(acc, chunk);
+        return acc;
+    }
+}
+
+#endif // CORE_NUMERIC_STREAM_H
@@ -0,0 +1,198 @@
+#ifndef CORE_NUMERIC_SUMMATION_H
+#define CORE_NUMERIC_SUMMATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/reductions.h"
+
+namespace core_numeric {
+
+    // Politicas de suma: mas precision a cambio de algo de velocidad, sin pasar
+    // a long double. Solo afectan a acumuladores de punto flotante; con enteros
+    // todas equivalen a naive (en 64 bits, como sum; ver integer.h).
+    //   naive    : un acumulador por carril (el sum de siempre)
+    //   pairwise : bloques de 128 sumados en cascada, error O(log n)
+    //   kahan    : Kahan-Neumaier compensado, error O(1) independiente de n
+    //   blocked  : bloques SIMD de 1024 combinados en cascada
+    namespace summation {
+        struct naive {};
+        struct pairwise {};
+        struct kahan {};
+        struct blocked {};
+    }
+
+    template<typename S>
+    concept SummationPolicy =
+        std::is_same_v<S, summation::naive> || std::is_same_v<S, summation::pairwise> ||
+        std::is_same_v<S, summation::kahan> || std::is_same_v<S, summation::blocked>;
+
+    namespace detail {
+        template<typename Acc>
+        struct neumaier {
+            Acc s{};
+            Acc c{};
+
+            void add(Acc x) {
+                const Acc t = s + x;
+                if ((s < 0 ? -s : s) >= (x < 0 ? -x : x)) c += (s - t) + x;
+                else c += (x - t) + s;
+                s = t;
+            }
+
+            Acc value() const { return s + c; }
+        };
+
+        // Suma por pares sin recursion: cada nivel guarda la suma de 2^l bloques.
+        template<typename Acc>
+        struct cascade {
+            Acc levels[64]{};
+            std::uint64_t mask = 0;
+
+            void add(Acc block) {
+                int l = 0;
+                for (; mask & (std::uint64_t{1} << l); ++l) {
+                    block = levels[l] + block;
+                    mask &= ~(std::uint64_t{1} << l);
+                }
+                levels[l] = block;
+                mask |= std::uint64_t{1} << l;
+            }
+
+            Acc value() const {
+                Acc r{};
+                for (int l = 0; l < 64; ++l)
+                    if (mask & (std::uint64_t{1} << l)) r = levels[l] + r;
+                return r;
+            }
+        };
+
+        inline constexpr std::size_t pairwise_block = 128;
+        inline constexpr std::size_t simd_block = 1024;
+
+        template<typename Acc, typename T>
+        Acc simd_block_sum(const T* p, std::size_t n) {
+            if constexpr (std::is_same_v<Acc, double> && std::is_same_v<T, float>)
+                return simd::sum_wide(p, n);
+            else
+                return static_cast<Acc>(simd::sum(p, n));
+        }
+
+        template<typename S, typename Acc, Iterable T, typename F>
+        Acc policy_sum(const T& container, F f) {
+            if constexpr (!std::is_floating_point_v<Acc> || std::is_same_v<S, summation::naive>) {
+                Acc acc{};
+                for (const auto& x : container) acc += f(x);
+                return acc;
+            } else if constexpr (std::is_same_v<S, summation::kahan>) {
+                neumaier<Acc> k;
+                for (const auto& x : container) k.add(f(x));
+                return k.value();
+            } else {
+                cascade<Acc> c;
+                Acc block{};
+                std::size_t k = 0;
+                for (const auto& x : container) {
+                    block += f(x);
+                    if (++k == pairwise_block) {
+                        c.add(block);
+                        block = Acc{};
+                        k = 0;
+                    }
+                }
+                if (k) c.add(block);
+                return c.value();
+            }
+        }
+
+        // Suma de los elementos (convertidos a Acc) con la politica S.
+        template<typename S, typename Acc, Iterable T>
+        Acc policy_sum(const T& container) {
+            using Q = element_t<T>;
+
+            if constexpr (std::is_same_v<S, summation::blocked> && simd::Contiguous<T> &&
+                          std::is_floating_point_v<Acc>) {
+                const Q* p = std::ranges::data(container);
+                const std::size_t n = std::ranges::size(container);
+                cascade<Acc> c;
+                for (std::size_t i = 0; i < n; i += simd_block)
+                    c.add(simd_block_sum<Acc>(p + i, n - i < simd_block ? n - i : simd_block));
+                return c.value();
+            } else if constexpr (std::is_same_v<S, summation::naive> && std::is_same_v<Acc, wide_t<Q>>) {
+                return sum(container);
+            } else if constexpr (std::is_same_v<S, summation::naive> && std::is_same_v<Acc, double>) {
+                return floating_sum(container);
+            } else {
+                return policy_sum<S, Acc>(container, [](const auto& x) { return static_cast<Acc>(x); });
+            }
+        }
+
+        // Si policy_sum<S, Acc> pasa por los kernels de simd:: (para las metricas).
+        template<typename S, typename Acc, typename T>
+        constexpr bool policy_sum_vectorized =
+            (std::is_same_v<S, summation::blocked> && simd::Contiguous<T> && std::is_floating_point_v<Acc>) ||
+            (std::is_same_v<S, summation::naive> && std::is_same_v<Acc, wide_t<element_t<T>>> &&
+             (simd::Contiguous<T> || simd::HalfContiguous<T>)) ||
+            (std::is_same_v<S, summation::naive> && std::is_same_v<Acc, double> &&
+             ((simd::Contiguous<T> && std::is_floating_point_v<element_t<T>>) || simd::HalfContiguous<T>));
+    }
+
+    template<SummationPolicy S, Iterable T>
+    requires Addable<element_t<T>>
+    auto sum(const T& container) {
+        using Q = element_t<T>;
+        CORE_NUMERIC_METRIC("sum", container, (detail::policy_sum_vectorized<S, detail::wide_t<Q>, T>));
+        return detail::policy_sum<S, detail::wide_t<Q>>(container);
+    }
+
+    template<SummationPolicy S, Iterable T>
+    requires Divisible<element_t<T>>
+    auto mean(const T& container) {
+        using Q = element_t<T>;
+        CORE_NUMERIC_METRIC("mean", container,
+            (std::is_integral_v<Q> ? simd::Contiguous<T> || simd::HalfContiguous<T>
+                                   : detail::policy_sum_vectorized<S, double, T>));
+
+        if constexpr (std::is_integral_v<Q>) {
+            return mean(container);
+        } else {
+            return detail::policy_sum<S, double>(container) / static_cast<double>(detail::count(container));
+        }
+    }
+
+    // Tres pasadas, todas con la politica S: la media y luego la formula
+    // corregida sum (x - mu)^2 - (sum (x - mu))^2 / n. Con naive equivale a
+    // variance(container).
+    template<SummationPolicy S, Iterable T>
+    requires Addable<element_t<T>>
+    auto variance(const T& container) {
+        CORE_NUMERIC_METRIC("variance", container,
+            (std::is_same_v<S, summation::naive> && (simd::Contiguous<T> || simd::HalfContiguous<T>)));
+        if constexpr (std::is_same_v<S, summation::naive>) {
+            return variance(container);
+        } else {
+            const double n = static_cast<double>(detail::count(container));
+            const double mu = detail::policy_sum<S, double>(container) / n;
+            const double dev = detail::policy_sum<S, double>(container,
+                [mu](const auto& x) { return static_cast<double>(x) - mu; });
+            const double sq = detail::policy_sum<S, double>(container,
+                [mu](const auto& x) {
+                    const double d = static_cast<double>(x) - mu;
+                    return d * d;
+                });
+            return (sq - dev * dev / n) / n;
+        }
+    }
+
+    template<SummationPolicy S, Iterable T, typename F>
+    auto transform_reduce(const T& container, F func) {
+        using R = decltype(func(*std::ranges::begin(container)));
+        return detail::policy_sum<S, R>(container, func);
+    }
+}
+
+#endif // CORE_NUMERIC_SUMMATION_H
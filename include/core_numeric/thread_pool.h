@@ -0,0 +1,100 @@
+#ifndef CORE_NUMERIC_THREAD_POOL_H
+#define CORE_NUMERIC_THREAD_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace core_numeric {
+
+    // Pool de hilos persistente con robo de trabajo, compartido por todos los
+    // algoritmos paralelos. parallel_for(n, body) reparte los indices [0, n)
+    // por division recursiva: cada participante parte su rango, deja la mitad
+    // alta en su cola y sigue con la baja; los hilos ociosos roban de las
+    // colas ajenas (primero las de su mismo nodo NUMA). El hilo que llama
+    // participa, asi que un pool de tamano 1 no crea hilos.
+    //
+    // Una llamada no reserva memoria: el trabajo vive en la pila del llamador
+    // y las colas tienen capacidad fija (si se llenan, el rango se ejecuta sin
+    // dividir).
+    class thread_pool {
+    public:
+        struct options {
+            std::size_t threads = 0; // participantes, incluido el llamador (0: una por CPU)
+            bool pin = false;        // fijar cada hilo a una CPU, agrupadas por nodo NUMA (Linux)
+            int node = -1;           // >= 0: solo CPUs de ese nodo (implica pin)
+        };
+
+        thread_pool() : thread_pool(options{}) {}
+        explicit thread_pool(options opts);
+        ~thread_pool();
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        std::size_t size() const noexcept;
+
+        // Nodo NUMA de la CPU de cada trabajador (indice 1..size()-1); -1 para el llamador.
+        int node_of_worker(std::size_t i) const noexcept;
+
+        // Ejecuta body(i) para cada i en [0, n) y espera a que terminen todos.
+        // La primera excepcion lanzada por body se relanza aqui.
+        template<typename F>
+        void parallel_for(std::size_t n, F&& body) {
+            if (n == 0) return;
+            using B = std::remove_reference_t<F>;
+            job j;
+            j.fn = [](void* ctx, std::size_t i) { (*static_cast<B*>(ctx))(i); };
+            j.ctx = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+            j.remaining.store(n, std::memory_order_relaxed);
+            run(j, n);
+            if (j.error) std::rethrow_exception(j.error);
+        }
+
+        // Como parallel_for, pero cada indice i se encola en un trabajador del
+        // nodo where(i) (si el pool tiene alguno alli) y no se divide. Los
+        // trabajadores atienden primero su cola; solo al quedar ociosos roban
+        // de otros nodos. El llamador roba empezando por su propio nodo.
+        template<typename W, typename F>
+        void parallel_for_nodes(std::size_t n, W&& where, F&& body) {
+            if (n == 0) return;
+            using B = std::remove_reference_t<F>;
+            using N = std::remove_reference_t<W>;
+            job j;
+            j.fn = [](void* ctx, std::size_t i) { (*static_cast<B*>(ctx))(i); };
+            j.ctx = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+            j.where = [](void* ctx, std::size_t i) { return static_cast<int>((*static_cast<N*>(ctx))(i)); };
+            j.where_ctx = const_cast<void*>(static_cast<const void*>(std::addressof(where)));
+            j.remaining.store(n, std::memory_order_relaxed);
+            run_nodes(j, n);
+            if (j.error) std::rethrow_exception(j.error);
+        }
+
+        struct job {
+            void (*fn)(void*, std::size_t) = nullptr;
+            void* ctx = nullptr;
+            int (*where)(void*, std::size_t) = nullptr;
+            void* where_ctx = nullptr;
+            std::atomic<std::size_t> remaining{0};
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+        };
+
+    private:
+        struct impl;
+
+        void run(job& j, std::size_t n);
+        void run_nodes(job& j, std::size_t n);
+
+        std::unique_ptr<impl> impl_;
+    };
+
+    // Pool por defecto del proceso, creado en el primer uso con
+    // hardware_concurrency() participantes y sin fijar hilos.
+    thread_pool& default_pool();
+}
+
+#endif // CORE_NUMERIC_THREAD_POOL_H
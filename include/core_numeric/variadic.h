@@ -0,0 +1,52 @@
+#ifndef CORE_NUMERIC_VARIADIC_H
+#define CORE_NUMERIC_VARIADIC_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/moments.h"
+
+namespace core_numeric {
+
+    template<Comparable... Ts>
+    constexpr auto sum_variadic(Ts... xs) {
+        return (xs + ...);
+    }
+
+    template<Comparable... Ts>
+    constexpr double mean_variadic(Ts... xs) {
+        constexpr std::size_t n = sizeof...(xs);
+        return (static_cast<double>(xs) + ...) / n;
+    }
+
+    template<Comparable... Ts>
+    constexpr double variance_variadic(Ts... xs) {
+        constexpr std::size_t n = sizeof...(xs);
+        const double mean = (static_cast<double>(xs) + ...) / n;
+        const auto sq = [mean](double x) {
+            const double d = x - mean;
+            return d * d;
+        };
+
+        return (sq(static_cast<double>(xs)) + ...) / n;
+    }
+
+    // Welford desenrollado sobre el paquete: una sola pasada, sin memoria auxiliar.
+    template<int Order = 2, Comparable... Ts>
+    constexpr auto moments_variadic(Ts... xs) {
+        using Q = std::common_type_t<Ts...>;
+        moments_state<Q> s;
+        (push<Order>(s, static_cast<Q>(xs)), ...);
+        return s;
+    }
+
+    template<Comparable T, Comparable... Ts>
+    constexpr auto max_variadic(T first, Ts... rest) {
+        auto max_val = first;
+        ((max_val = max_val > rest ? max_val : rest), ...);
+        return max_val;
+    }
+}
+
+#endif // CORE_NUMERIC_VARIADIC_H
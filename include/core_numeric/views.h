@@ -0,0 +1,156 @@
+#ifndef CORE_NUMERIC_VIEWS_H
+#define CORE_NUMERIC_VIEWS_H
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+#include "core_numeric/accumulator.h"
+#include "core_numeric/concepts.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/reductions.h"
+
+namespace core_numeric {
+
+    // Vista no propietaria de n elementos separados por stride (en elementos,
+    // puede ser negativo). Sirve para columnas de matrices por filas o campos
+    // intercalados sin copiarlos a un std::vector.
+    template<typename T>
+    class strided_view : public std::ranges::view_interface<strided_view<T>> {
+    public:
+        class iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_cv_t<T>;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(T* base, std::ptrdiff_t stride, std::ptrdiff_t i) : base_(base), stride_(stride), i_(i) {}
+
+            T& operator*() const { return base_[i_ * stride_]; }
+            T& operator[](difference_type k) const { return base_[(i_ + k) * stride_]; }
+
+            iterator& operator++() { ++i_; return *this; }
+            iterator operator++(int) { auto t = *this; ++i_; return t; }
+            iterator& operator--() { --i_; return *this; }
+            iterator operator--(int) { auto t = *this; --i_; return t; }
+            iterator& operator+=(difference_type k) { i_ += k; return *this; }
+            iterator& operator-=(difference_type k) { i_ -= k; return *this; }
+
+            friend iterator operator+(iterator it, difference_type k) { return it += k; }
+            friend iterator operator+(difference_type k, iterator it) { return it += k; }
+            friend iterator operator-(iterator it, difference_type k) { return it -= k; }
+            friend difference_type operator-(const iterator& a, const iterator& b) { return a.i_ - b.i_; }
+
+            friend bool operator==(const iterator& a, const iterator& b) { return a.i_ == b.i_; }
+            friend auto operator<=>(const iterator& a, const iterator& b) { return a.i_ <=> b.i_; }
+
+        private:
+            T* base_ = nullptr;
+            std::ptrdiff_t stride_ = 1;
+            std::ptrdiff_t i_ = 0;
+        };
+
+        strided_view() = default;
+        strided_view(T* data, std::size_t size, std::ptrdiff_t stride)
+            : data_(data), size_(size), stride_(stride) {}
+
+        iterator begin() const { return {data_, stride_, 0}; }
+        iterator end() const { return {data_, stride_, static_cast<std::ptrdiff_t>(size_)}; }
+        std::size_t size() const { return size_; }
+        std::ptrdiff_t stride() const { return stride_; }
+
+    private:
+        T* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::ptrdiff_t stride_ = 1;
+    };
+
+    template<typename T>
+    strided_view<T> strided(T* data, std::size_t size, std::ptrdiff_t stride) {
+        return {data, size, stride};
+    }
+
+    // Proyecciones: sum(records, &Rec::price) reduce el campo sin copiarlo.
+    // Proj es cualquier invocable (puntero a miembro, lambda) sobre un elemento.
+    template<typename P, typename T>
+    concept Projection = std::regular_invocable<P&, std::ranges::range_reference_t<const T>>;
+
+    namespace detail {
+        template<Iterable T, typename P>
+        auto project(const T& container, P proj) {
+            return std::views::transform(container, proj);
+        }
+    }
+
+    template<Iterable T, Projection<T> P>
+    auto sum(const T& container, P proj) {
+        return sum(detail::project(container, proj));
+    }
+
+    template<Iterable T, Projection<T> P>
+    auto mean(const T& container, P proj) {
+        return mean(detail::project(container, proj));
+    }
+
+    template<Iterable T, Projection<T> P>
+    auto variance(const T& container, P proj) {
+        return variance(detail::project(container, proj));
+    }
+
+    template<Iterable T, Projection<T> P>
+    auto max(const T& container, P proj) {
+        return max(detail::project(container, proj));
+    }
+
+    template<int Order = 2, Iterable T, Projection<T> P>
+    auto moments(const T& container, P proj) {
+        return moments<Order>(detail::project(container, proj));
+    }
+
+    template<stats... S, Iterable T, Projection<T> P>
+    requires (sizeof...(S) > 0)
+    auto describe(const T& container, P proj) {
+        return describe<S...>(detail::project(container, proj));
+    }
+
+#if defined(__cpp_lib_mdspan)
+    // Elementos de un mdspan como rango: contiguo (std::span) con layout_right o
+    // layout_left, strided_view para rango 1 con layout_stride.
+    template<typename T, typename E, typename L, typename A>
+    auto elements(const std::mdspan<T, E, L, A>& m) {
+        if constexpr (std::is_same_v<L, std::layout_right> || std::is_same_v<L, std::layout_left>) {
+            return std::span<T>(m.data_handle(), m.size());
+        } else {
+            static_assert(E::rank() == 1, "elements: layout_stride solo con rango 1");
+            return strided(m.data_handle(), m.extent(0), static_cast<std::ptrdiff_t>(m.stride(0)));
+        }
+    }
+
+    template<typename T, typename E, typename L, typename A>
+    auto sum(const std::mdspan<T, E, L, A>& m) { return sum(elements(m)); }
+
+    template<typename T, typename E, typename L, typename A>
+    auto mean(const std::mdspan<T, E, L, A>& m) { return mean(elements(m)); }
+
+    template<typename T, typename E, typename L, typename A>
+    auto variance(const std::mdspan<T, E, L, A>& m) { return variance(elements(m)); }
+
+    template<typename T, typename E, typename L, typename A>
+    auto max(const std::mdspan<T, E, L, A>& m) { return max(elements(m)); }
+
+    template<int Order = 2, typename T, typename E, typename L, typename A>
+    auto moments(const std::mdspan<T, E, L, A>& m) { return moments<Order>(elements(m)); }
+#endif
+}
+
+#endif // CORE_NUMERIC_VIEWS_H
@@ -0,0 +1,445 @@
+#ifndef CORE_NUMERIC_WEIGHTED_H
+#define CORE_NUMERIC_WEIGHTED_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "core_numeric/concepts.h"
+#include "core_numeric/metrics.h"
+#include "core_numeric/moments.h"
+#include "core_numeric/parallel.h"
+#include "core_numeric/reductions.h"
+#include "core_numeric/simd.h"
+
+namespace core_numeric {
+
+    // Estadisticos con pesos o con mascara de validez, leyendo los valores y
+    // los pesos (o los bits) a la vez, sin compactar antes en otro vector:
+    //   weighted_sum/mean/variance/max/moments(x, w)
+    //   masked_sum/mean/variance/max/moments(x, valid)
+    // x y w son rangos contiguos del mismo tamano. valid es una mascara de bits
+    // al estilo de Apache Arrow (ver simd::valid_bit) con al menos ceil(n / 8)
+    // bytes; las posiciones invalidas no se leen como datos, asi que pueden ser
+    // NaN o basura. Con double y float x double/float los kernels SIMD hacen la
+    // pasada; el resto de tipos usa el lazo escalar.
+    //
+    // La varianza es la de pesos de frecuencia, sum w (x - mean)^2 / sum w,
+    // igual que variance() cuando todos los pesos son 1. Como moments(), se
+    // calcula por bloques de L1 (media del bloque y luego desviaciones desde
+    // cache) y los bloques se combinan con merge(weighted_state).
+    struct weighted_state {
+        std::size_t count = 0; // elementos considerados (con mascara, los validos)
+        double weight = 0.0;   // suma de pesos (con mascara, count)
+        double mean = 0.0;
+        double m2 = 0.0;       // sum w (x - mean)^2
+    };
+
+    constexpr weighted_state merge(const weighted_state& a, const weighted_state& b) {
+        if (b.weight == 0.0) return {a.count + b.count, a.weight, a.mean, a.m2};
+        if (a.weight == 0.0) return {a.count + b.count, b.weight, b.mean, b.m2};
+        const double w = a.weight + b.weight;
+        const double delta = b.mean - a.mean;
+        weighted_state r;
+        r.count = a.count + b.count;
+        r.weight = w;
+        r.mean = a.mean + delta * (b.weight / w);
+        r.m2 = a.m2 + b.m2 + delta * delta * (a.weight * b.weight / w);
+        return r;
+    }
+
+    constexpr double mean(const weighted_state& s) {
+        return s.weight == 0.0 ? std::numeric_limits<double>::quiet_NaN() : s.mean;
+    }
+
+    constexpr double variance(const weighted_state& s) {
+        return s.m2 / s.weight;
+    }
+
+    namespace detail {
+        template<typename C>
+        concept Array = std::ranges::contiguous_range<const C> && std::ranges::sized_range<const C> &&
+                        std::is_arithmetic_v<element_t<C>>;
+
+        template<typename Q, typename W>
+        constexpr bool weighted_kernel = std::is_same_v<Q, W> && (std::is_same_v<Q, double> || std::is_same_v<Q, float>);
+
+        template<typename Q>
+        constexpr bool masked_kernel = std::is_same_v<Q, double> || std::is_same_v<Q, float>;
+
+        template<Array T, Array W>
+        void require_same_size(const T& x, const W& w, const char* what) {
+            if (std::ranges::size(x) != std::ranges::size(w))
+                throw std::invalid_argument(std::string(what) + ": values and weights differ in size");
+        }
+
+        template<Array T>
+        void require_mask(const T& x, std::span<const std::uint8_t> valid, const char* what) {
+            if (valid.size() < (std::ranges::size(x) + 7) / 8)
+                throw std::invalid_argument(std::string(what) + ": validity mask shorter than the values");
+        }
+
+        template<typename Q, typename W>
+        simd::weighted_sums weighted_sums_of(const Q* x, const W* w, std::size_t n) {
+            if constexpr (weighted_kernel<Q, W>) return simd::weighted_sum(x, w, n);
+            else return simd::scalar::weighted_sum(x, w, n);
+        }
+
+        template<typename Q, typename W>
+        weighted_state weighted_moments_of(const Q* x, const W* w, std::size_t n) {
+            weighted_state total;
+            for (std::size_t i = 0; i < n; i += simd::moments_block) {
+                const std::size_t len = n - i < simd::moments_block ? n - i : simd::moments_block;
+                const auto s = weighted_sums_of(x + i, w + i, len);
+                weighted_state b;
+                b.count = len;
+                b.weight = s.weight;
+                if (s.weight != 0.0) {
+                    b.mean = s.sum / s.weight;
+                    if constexpr (weighted_kernel<Q, W>) b.m2 = simd::weighted_sq_dev(x + i, w + i, len, b.mean);
+                    else b.m2 = simd::scalar::weighted_sq_dev(x + i, w + i, len, b.mean);
+                }
+                total = merge(total, b);
+            }
+            return total;
+        }
+
+        template<typename Q, typename W>
+        std::optional<Q> weighted_max_of(const Q* x, const W* w, std::size_t n) {
+            std::optional<Q> best;
+            for (std::size_t i = 0; i < n; ++i)
+                if (w[i] > W{} && (!best || x[i] > *best)) best = x[i];
+            return best;
+        }
+
+        // Bits a 1 entre las posiciones [0, n).
+        inline std::size_t count_valid(const std::uint8_t* bits, std::size_t n) {
+            std::size_t c = 0;
+            std::size_t i = 0;
+            for (; i + 64 <= n; i += 64) {
+                std::uint64_t word;
+                std::memcpy(&word, bits + i / 8, sizeof word);
+                c += static_cast<std::size_t>(std::popcount(word));
+            }
+            for (; i + 8 <= n; i += 8) c += static_cast<std::size_t>(std::popcount(bits[i / 8]));
+            if (i < n) c += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(bits[i / 8] & ((1u << (n - i)) - 1u))));
+            return c;
+        }
+
+        template<typename Q>
+        wide_t<Q> masked_sum_of(const Q* x, const std::uint8_t* bits, std::size_t n) {
+            if constexpr (masked_kernel<Q>) {
+                return static_cast<Q>(simd::masked_sum(x, bits, n));
+            } else {
+                wide_t<Q> acc{};
+                for (std::size_t i = 0; i < n; ++i)
+                    if (simd::valid_bit(bits, i)) acc += x[i];
+                return acc;
+            }
+        }
+
+        template<typename Q>
+        weighted_state masked_moments_of(const Q* x, const std::uint8_t* bits, std::size_t n) {
+            weighted_state total;
+            for (std::size_t i = 0; i < n; i += simd::moments_block) {
+                const std::size_t len = n - i < simd::moments_block ? n - i : simd::moments_block;
+                const std::uint8_t* b = bits + i / 8;
+                const std::size_t c = count_valid(b, len);
+                if (c == 0) continue;
+                weighted_state s;
+                s.count = c;
+                s.weight = static_cast<double>(c);
+                if constexpr (masked_kernel<Q>) {
+                    s.mean = simd::masked_sum(x + i, b, len) / s.weight;
+                    s.m2 = simd::masked_sq_dev(x + i, b, len, s.mean);
+                } else {
+                    s.mean = simd::scalar::masked_sum(x + i, b, len) / s.weight;
+                    s.m2 = simd::scalar::masked_sq_dev(x + i, b, len, s.mean);
+                }
+                total = merge(total, s);
+            }
+            return total;
+        }
+
+        template<typename Q>
+        std::optional<Q> masked_max_of(const Q* x, const std::uint8_t* bits, std::size_t n) {
+            if (count_valid(bits, n) == 0) return std::nullopt;
+            if constexpr (masked_kernel<Q>) {
+                return simd::masked_max(x, bits, n);
+            } else {
+                std::optional<Q> best;
+                for (std::size_t i = 0; i < n; ++i)
+                    if (simd::valid_bit(bits, i) && (!best || x[i] > *best)) best = x[i];
+                return best;
+            }
+        }
+
+        template<typename Q>
+        std::optional<Q> max_of(const std::optional<Q>& a, const std::optional<Q>& b) {
+            if (!a) return b;
+            if (!b) return a;
+            return *b > *a ? b : a;
+        }
+
+        // Reparte [0, n) entre los hilos en bloques que empiezan en multiplos
+        // de align (8 con mascaras, para no partir un byte) y reduce cada uno
+        // con f(first, len).
+        template<typename F, typename Combine>
+        auto parallel_indices(execution::parallel_policy policy, std::size_t n, std::size_t align, F f, Combine combine) {
+            policy.cutoff /= align;
+            policy.grain = std::max<std::size_t>(policy.grain / align, 1);
+            const std::size_t units = (n + align - 1) / align;
+            return parallel_reduce(policy, std::views::iota(std::size_t{0}, units), [&](const auto& part) {
+                const std::size_t first = *part.begin() * align;
+                const std::size_t last = std::min(n, (*part.begin() + part.size()) * align);
+                return f(first, last - first);
+            }, combine);
+        }
+
+        template<typename P>
+        constexpr bool sequential = std::is_same_v<std::remove_cvref_t<P>, execution::sequenced_policy>;
+    }
+
+    template<detail::Array T, detail::Array W>
+    double weighted_sum(const T& x, const W& w) {
+        CORE_NUMERIC_METRIC("weighted_sum", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+        detail::require_same_size(x, w, "weighted_sum");
+        return detail::weighted_sums_of(std::ranges::data(x), std::ranges::data(w), std::ranges::size(x)).sum;
+    }
+
+    // NaN si los pesos suman 0.
+    template<detail::Array T, detail::Array W>
+    double weighted_mean(const T& x, const W& w) {
+        CORE_NUMERIC_METRIC("weighted_mean", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+        detail::require_same_size(x, w, "weighted_mean");
+        const auto s = detail::weighted_sums_of(std::ranges::data(x), std::ranges::data(w), std::ranges::size(x));
+        return s.weight == 0.0 ? std::numeric_limits<double>::quiet_NaN() : s.sum / s.weight;
+    }
+
+    template<detail::Array T, detail::Array W>
+    weighted_state weighted_moments(const T& x, const W& w) {
+        CORE_NUMERIC_METRIC("weighted_moments", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+        detail::require_same_size(x, w, "weighted_moments");
+        return detail::weighted_moments_of(std::ranges::data(x), std::ranges::data(w), std::ranges::size(x));
+    }
+
+    template<detail::Array T, detail::Array W>
+    double weighted_variance(const T& x, const W& w) {
+        CORE_NUMERIC_METRIC("weighted_variance", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+        return variance(weighted_moments(x, w));
+    }
+
+    // Maximo entre los elementos con peso positivo; std::invalid_argument si no hay ninguno.
+    template<detail::Array T, detail::Array W>
+    element_t<T> weighted_max(const T& x, const W& w) {
+        CORE_NUMERIC_METRIC("weighted_max", x, false);
+        detail::require_same_size(x, w, "weighted_max");
+        const auto m = detail::weighted_max_of(std::ranges::data(x), std::ranges::data(w), std::ranges::size(x));
+        if (!m) throw std::invalid_argument("weighted_max: no element with positive weight");
+        return *m;
+    }
+
+    template<detail::Array T>
+    auto masked_sum(const T& x, std::span<const std::uint8_t> valid) {
+        CORE_NUMERIC_METRIC("masked_sum", x, detail::masked_kernel<element_t<T>>);
+        detail::require_mask(x, valid, "masked_sum");
+        return detail::masked_sum_of(std::ranges::data(x), valid.data(), std::ranges::size(x));
+    }
+
+    // Como mean(): con enteros en el tipo del elemento (std::invalid_argument
+    // si no hay validos), en punto flotante en double (NaN si no hay validos).
+    template<detail::Array T>
+    auto masked_mean(const T& x, std::span<const std::uint8_t> valid) {
+        CORE_NUMERIC_METRIC("masked_mean", x, detail::masked_kernel<element_t<T>>);
+        using Q = element_t<T>;
+        detail::require_mask(x, valid, "masked_mean");
+        const std::size_t n = std::ranges::size(x);
+        const std::size_t c = detail::count_valid(valid.data(), n);
+
+        if constexpr (std::is_integral_v<Q>) {
+            if (c == 0) throw std::invalid_argument("masked_mean: no valid element");
+            using W = detail::wide_t<Q>;
+            return static_cast<Q>(detail::masked_sum_of(std::ranges::data(x), valid.data(), n) / static_cast<W>(c));
+        } else if constexpr (detail::masked_kernel<Q>) {
+            return simd::masked_sum(std::ranges::data(x), valid.data(), n) / static_cast<double>(c);
+        } else {
+            return simd::scalar::masked_sum(std::ranges::data(x), valid.data(), n) / static_cast<double>(c);
+        }
+    }
+
+    template<detail::Array T>
+    weighted_state masked_moments(const T& x, std::span<const std::uint8_t> valid) {
+        CORE_NUMERIC_METRIC("masked_moments", x, detail::masked_kernel<element_t<T>>);
+        detail::require_mask(x, valid, "masked_moments");
+        return detail::masked_moments_of(std::ranges::data(x), valid.data(), std::ranges::size(x));
+    }
+
+    template<detail::Array T>
+    double masked_variance(const T& x, std::span<const std::uint8_t> valid) {
+        CORE_NUMERIC_METRIC("masked_variance", x, detail::masked_kernel<element_t<T>>);
+        return variance(masked_moments(x, valid));
+    }
+
+    // std::invalid_argument si no hay ningun elemento valido.
+    template<detail::Array T>
+    element_t<T> masked_max(const T& x, std::span<const std::uint8_t> valid) {
+        CORE_NUMERIC_METRIC("masked_max", x, detail::masked_kernel<element_t<T>>);
+        detail::require_mask(x, valid, "masked_max");
+        const auto m = detail::masked_max_of(std::ranges::data(x), valid.data(), std::ranges::size(x));
+        if (!m) throw std::invalid_argument("masked_max: no valid element");
+        return *m;
+    }
+
+    // Versiones paralelas: bloques contiguos por hilo, parciales combinados en
+    // orden con merge(weighted_state) (deterministas para un numero fijo de hilos).
+    template<ExecutionPolicy P, detail::Array T, detail::Array W>
+    double weighted_sum(P&& policy, const T& x, const W& w) {
+        if constexpr (detail::sequential<P>) {
+            return weighted_sum(x, w);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("weighted_sum", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+            detail::require_same_size(x, w, "weighted_sum");
+            const auto* px = std::ranges::data(x);
+            const auto* pw = std::ranges::data(w);
+            return detail::parallel_indices(policy, std::ranges::size(x), 1,
+                [&](std::size_t i, std::size_t len) { return detail::weighted_sums_of(px + i, pw + i, len).sum; },
+                [](double a, double b) { return a + b; });
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T, detail::Array W>
+    weighted_state weighted_moments(P&& policy, const T& x, const W& w) {
+        if constexpr (detail::sequential<P>) {
+            return weighted_moments(x, w);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("weighted_moments", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+            detail::require_same_size(x, w, "weighted_moments");
+            const auto* px = std::ranges::data(x);
+            const auto* pw = std::ranges::data(w);
+            return detail::parallel_indices(policy, std::ranges::size(x), 1,
+                [&](std::size_t i, std::size_t len) { return detail::weighted_moments_of(px + i, pw + i, len); },
+                [](const weighted_state& a, const weighted_state& b) { return merge(a, b); });
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T, detail::Array W>
+    double weighted_mean(P&& policy, const T& x, const W& w) {
+        if constexpr (detail::sequential<P>) {
+            return weighted_mean(x, w);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("weighted_mean", x, (detail::weighted_kernel<element_t<T>, element_t<W>>));
+            detail::require_same_size(x, w, "weighted_mean");
+            const auto* px = std::ranges::data(x);
+            const auto* pw = std::ranges::data(w);
+            const auto s = detail::parallel_indices(policy, std::ranges::size(x), 1,
+                [&](std::size_t i, std::size_t len) { return detail::weighted_sums_of(px + i, pw + i, len); },
+                [](simd::weighted_sums a, const simd::weighted_sums& b) {
+                    a.weight += b.weight;
+                    a.sum += b.sum;
+                    return a;
+                });
+            return s.weight == 0.0 ? std::numeric_limits<double>::quiet_NaN() : s.sum / s.weight;
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T, detail::Array W>
+    double weighted_variance(P&& policy, const T& x, const W& w) {
+        return variance(weighted_moments(policy, x, w));
+    }
+
+    template<ExecutionPolicy P, detail::Array T, detail::Array W>
+    element_t<T> weighted_max(P&& policy, const T& x, const W& w) {
+        if constexpr (detail::sequential<P>) {
+            return weighted_max(x, w);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("weighted_max", x, false);
+            using Q = element_t<T>;
+            detail::require_same_size(x, w, "weighted_max");
+            const auto* px = std::ranges::data(x);
+            const auto* pw = std::ranges::data(w);
+            const auto m = detail::parallel_indices(policy, std::ranges::size(x), 1,
+                [&](std::size_t i, std::size_t len) { return detail::weighted_max_of(px + i, pw + i, len); },
+                [](const std::optional<Q>& a, const std::optional<Q>& b) { return detail::max_of(a, b); });
+            if (!m) throw std::invalid_argument("weighted_max: no element with positive weight");
+            return *m;
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T>
+    auto masked_sum(P&& policy, const T& x, std::span<const std::uint8_t> valid) {
+        if constexpr (detail::sequential<P>) {
+            return masked_sum(x, valid);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("masked_sum", x, detail::masked_kernel<element_t<T>>);
+            detail::require_mask(x, valid, "masked_sum");
+            const auto* px = std::ranges::data(x);
+            return detail::parallel_indices(policy, std::ranges::size(x), 8,
+                [&](std::size_t i, std::size_t len) { return detail::masked_sum_of(px + i, valid.data() + i / 8, len); },
+                [](auto a, auto b) { return a + b; });
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T>
+    weighted_state masked_moments(P&& policy, const T& x, std::span<const std::uint8_t> valid) {
+        if constexpr (detail::sequential<P>) {
+            return masked_moments(x, valid);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("masked_moments", x, detail::masked_kernel<element_t<T>>);
+            detail::require_mask(x, valid, "masked_moments");
+            const auto* px = std::ranges::data(x);
+            return detail::parallel_indices(policy, std::ranges::size(x), 8,
+                [&](std::size_t i, std::size_t len) { return detail::masked_moments_of(px + i, valid.data() + i / 8, len); },
+                [](const weighted_state& a, const weighted_state& b) { return merge(a, b); });
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T>
+    auto masked_mean(P&& policy, const T& x, std::span<const std::uint8_t> valid) {
+        using Q = element_t<T>;
+        if constexpr (detail::sequential<P>) {
+            return masked_mean(x, valid);
+        } else if constexpr (std::is_integral_v<Q>) {
+            CORE_NUMERIC_METRIC_PAR("masked_mean", x, detail::masked_kernel<element_t<T>>);
+            const auto s = masked_sum(policy, x, valid);
+            const std::size_t c = detail::count_valid(valid.data(), std::ranges::size(x));
+            if (c == 0) throw std::invalid_argument("masked_mean: no valid element");
+            return static_cast<Q>(s / static_cast<detail::wide_t<Q>>(c));
+        } else {
+            CORE_NUMERIC_METRIC_PAR("masked_mean", x, detail::masked_kernel<element_t<T>>);
+            return mean(masked_moments(policy, x, valid));
+        }
+    }
+
+    template<ExecutionPolicy P, detail::Array T>
+    double masked_variance(P&& policy, const T& x, std::span<const std::uint8_t> valid) {
+        return variance(masked_moments(policy, x, valid));
+    }
+
+    template<ExecutionPolicy P, detail::Array T>
+    element_t<T> masked_max(P&& policy, const T& x, std::span<const std::uint8_t> valid) {
+        if constexpr (detail::sequential<P>) {
+            return masked_max(x, valid);
+        } else {
+            CORE_NUMERIC_METRIC_PAR("masked_max", x, detail::masked_kernel<element_t<T>>);
+            using Q = element_t<T>;
+            detail::require_mask(x, valid, "masked_max");
+            const auto* px = std::ranges::data(x);
+            const auto m = detail::parallel_indices(policy, std::ranges::size(x), 8,
+                [&](std::size_t i, std::size_t len) { return detail::masked_max_of(px + i, valid.data() + i / 8, len); },
+                [](const std::optional<Q>& a, const std::optional<Q>& b) { return detail::max_of(a, b); });
+            if (!m) throw std::invalid_argument("masked_max: no valid element");
+            return *m;
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_WEIGHTED_H
@@ -1,143 +1,11 @@
 #include <iostream>
 #include <vector>
-#include <concepts>
-#include <iterator>
 #include <string>
+#include <span>
 
-using namespace std;
+#include "core_numeric/core_numeric.h"
 
-template<typename C>
-concept Iterable = requires (C c) {
-    std::begin(c);
-    std::end(c);
-};
-
-template<typename T>
-concept Addable = requires (T a, T b) {
-    {a + b} -> std::same_as<T>;
-};
-
-template<typename T>
-concept Divisible = requires (T a , std::size_t n) {
-    {a / n} -> std::convertible_to<T>;
-};
-
-template<typename T>
-concept Comparable =
-    is_arithmetic_v<T> &&
-    !std::is_same_v<T, char> &&
-    !std::is_same_v<T, signed char> &&
-    !std::is_same_v<T, unsigned char>;
-
-namespace core_numeric {
-
-    template<Iterable T>
-    requires Addable<typename T::value_type>
-    auto sum(const T& container) {
-        using Q = typename T::value_type;
-
-        Q result{};
-
-        for (const auto &elem : container)
-            result += elem;
-
-        return result;
-    }
-
-    template<Iterable T>
-    requires Divisible<typename T::value_type>
-    auto mean(const T& container) {
-        using Q = typename T::value_type;
-
-        if constexpr (std::is_integral_v<Q>) {
-            return sum(container) / static_cast<Q>(container.size());
-        } else {
-            double s = 0.0;
-            for (const auto& x : container) s += static_cast<double>(x);
-            return s / static_cast<double>(container.size());
-        }
-    }
-
-    template<Iterable T>
-    requires Addable<typename T::value_type>
-    auto variance(const T& container) {
-        using Q = typename T::value_type;
-        if constexpr (std::is_integral_v<Q>) {
-            double mu = static_cast<double>(sum(container)) / container.size();
-
-            double acc = 0.0;
-            for (const auto& x : container) {
-                double d = static_cast<double>(x) - mu;
-                acc += d * d;
-            }
-            return acc / static_cast<double>(container.size());
-        } else {
-            double mu = 0.0;
-            for (const auto& x : container) mu += static_cast<double>(x);
-            mu /= static_cast<double>(container.size());
-
-            double acc = 0.0;
-            for (const auto& x : container) {
-                double d = static_cast<double>(x) - mu;
-                acc += d * d;
-            }
-            return acc / static_cast<double>(container.size());
-        }
-    }
-
-    template<Iterable T>
-    requires Comparable<typename T::value_type>
-    auto max(const T& container) {
-        using Q = typename T::value_type;
-        Q result = container[0];
-
-        for (const auto &elem : container) {
-            if (elem > result)
-                result = elem;
-        }
-
-        return result;
-    }
-
-    template <Iterable T, typename F>
-    auto transform_reduce(const T& container, F func) {
-        using R = decltype(func(*container.begin()));
-
-        R result{};
-
-        for (const auto& x : container)
-            result += func(x);
-
-        return result;
-    }
-
-    template<Comparable... Ts>
-    auto sum_variadic(Ts... xs) {
-        return (xs + ...);
-    }
-
-    template<Comparable... Ts>
-    double mean_variadic(Ts... xs) {
-        constexpr std::size_t n = sizeof...(xs);
-        return (static_cast<double>(xs) + ...) / n;
-    }
-
-    template<Comparable... Ts>
-    double variance_variadic(Ts... xs) {
-        constexpr std::size_t n = sizeof...(xs);
-        double mean = (static_cast<double>(xs) + ...) / n;
-
-        return (( (static_cast<double>(xs) - mean) *
-                  (static_cast<double>(xs) - mean) ) + ...) / n;
-    }
-
-    template<Comparable T, Comparable... Ts>
-    auto max_variadic(T first, Ts... rest) {
-        auto max_val = first;
-        ((max_val = max_val > rest ? max_val : rest), ...);
-        return max_val;
-    }
-}
+using namespace std;
 
 void testSum() {
 
@@ -217,6 +85,107 @@ void testMax() {
 
 }
 
+void testMoments() {
+
+    cout << "--------------------------------------------" << endl;
+    cout << "Testing moments:" << endl;
+
+    vector<double> v1{1,2,3,4};
+    auto m = core_numeric::moments(v1);
+    cout << m.count << " " << core_numeric::mean(m) << " "
+         << core_numeric::variance(m) << " " << m.min << " " << core_numeric::max(m) << endl;
+    // Resultado esperado: 4 2.5 1.25 1 4
+
+    vector<int> v2{2,4,4,4,5,5,7,9};
+    auto m4 = core_numeric::moments<4>(v2);
+    cout << m4.m2 / m4.count << " " << m4.m3 / m4.count << " " << m4.m4 / m4.count << endl;
+    // Resultado esperado: 4 5.25 44.5
+}
+
+void testParallel() {
+
+    cout << "--------------------------------------------" << endl;
+    cout << "Testing parallel:" << endl;
+
+    vector<double> v(100000);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<double>(i % 10);
+
+    auto par4 = core_numeric::execution::par.on(4);
+    cout << core_numeric::sum(par4, v) << " " << core_numeric::mean(par4, v) << " "
+         << core_numeric::variance(par4, v) << " " << core_numeric::max(par4, v) << endl;
+    // Resultado esperado: 450000 4.5 8.25 9
+
+    cout << core_numeric::transform_reduce(core_numeric::execution::par, v,
+                                           [](double x){ return x*x; }) << endl;
+    // Resultado esperado: 2850000
+}
+
+void testAccumulator() {
+
+    cout << "--------------------------------------------" << endl;
+    cout << "Testing accumulator:" << endl;
+
+    using core_numeric::stats;
+    core_numeric::accumulator<double, stats::mean | stats::variance | stats::max> a, b;
+
+    vector<double> lote{1, 2};
+    a.push(std::span<const double>(lote));
+    b.push(3.0);
+    b.push(4.0);
+    a.merge(b);
+    cout << a.count() << " " << a.mean() << " " << a.variance() << " " << a.max() << endl;
+    // Resultado esperado: 4 2.5 1.25 4
+
+    // NO EJECUTA
+    // Falla el requires de sum(): stats::sum no forma parte del acumulador
+    // cout << a.sum() << endl;
+}
+
+void testSummation() {
+
+    cout << "--------------------------------------------" << endl;
+    cout << "Testing summation policies:" << endl;
+
+    // 1 seguido de 10^6 valores de 1e-16: la suma ingenua pierde los que caen en el carril del 1
+    vector<double> v(1000001, 1e-16);
+    v[0] = 1.0;
+    cout.precision(17);
+    cout << core_numeric::sum<core_numeric::summation::naive>(v) << endl;
+    // Resultado esperado: 1.00000000009 (aprox., depende de los carriles SIMD)
+    cout << core_numeric::sum<core_numeric::summation::kahan>(v) << endl;
+    // Resultado esperado: 1.0000000001
+    cout << core_numeric::sum<core_numeric::summation::pairwise>(v) << endl;
+    // Resultado esperado: 1.0000000001 (aprox.)
+    cout << core_numeric::sum<core_numeric::summation::blocked>(v) << endl;
+    // Resultado esperado: 1.0000000001 (aprox.)
+    cout.precision(6);
+
+    vector<double> w{1e9 + 1, 1e9 + 2, 1e9 + 3, 1e9 + 4};
+    cout << core_numeric::variance<core_numeric::summation::kahan>(w) << endl;
+    // Resultado esperado: 1.25
+
+    vector<double> x{1,2,3};
+    cout << core_numeric::transform_reduce<core_numeric::summation::pairwise>(x, [](double a){ return a*a; }) << endl;
+    // Resultado esperado: 14
+}
+
+void testDescribe() {
+
+    cout << "--------------------------------------------" << endl;
+    cout << "Testing describe:" << endl;
+
+    using core_numeric::stats;
+    vector<double> v{1,2,3,4};
+    auto d = core_numeric::describe<stats::sum, stats::mean, stats::variance, stats::max>(v);
+    cout << d.sum() << " " << d.mean() << " " << d.variance() << " " << d.max() << endl;
+    // Resultado esperado: 10 2.5 1.25 4
+
+    vector<int> w{3, 9, 2, 7};
+    auto e = core_numeric::describe<stats::min, stats::max>(core_numeric::execution::par, w);
+    cout << e.min() << " " << e.max() << endl;
+    // Resultado esperado: 2 9
+}
+
 void testTransformReduce() {
 
     cout << "--------------------------------------------" << endl;
@@ -307,16 +276,39 @@ void testMaxVariadic() {
     // cout << core_numeric::max_variadic(string("a"), string("b")) << endl;
 }
 
+void testMomentsVariadic() {
+
+    cout << "--------------------------------------------" << endl;
+    cout << "Testing moments_variadic:" << endl;
+
+    constexpr auto m = core_numeric::moments_variadic(1, 2, 3, 4);
+    static_assert(m.count == 4 && m.mean == 2.5 && m.max == 4);
+    cout << core_numeric::mean(m) << " " << core_numeric::variance(m) << endl;
+    // Resultado esperado: 2.5 1.25
+
+    // Evaluadas en compilacion
+    static_assert(core_numeric::sum_variadic(1, 2, 33, 4) == 40);
+    static_assert(core_numeric::mean_variadic(1, 2, 3, 4) == 2.5);
+    static_assert(core_numeric::variance_variadic(1, 2, 3, 4) == 1.25);
+    static_assert(core_numeric::max_variadic(1, 2.7, 3, 4) == 4);
+}
+
 int main() {
     testSum();
     testMean();
     testVariance();
     testMax();
+    testMoments();
+    testParallel();
+    testAccumulator();
+    testSummation();
+    testDescribe();
     testTransformReduce();
     testSumVariadic();
     testMeanVariadic();
     testVarianceVariadic();
     testMaxVariadic();
+    testMomentsVariadic();
 
     return 0;
 }
\ No newline at end of file
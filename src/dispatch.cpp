@@ -0,0 +1,417 @@
+// Seleccion del kernel en tiempo de ejecucion. CMake define
+// CORE_NUMERIC_KERNELS_X86 o CORE_NUMERIC_KERNELS_NEON segun las TUs de
+// kernels que compila para la arquitectura destino. La CPU se consulta una
+// vez al cargar la biblioteca y cada punto de entrada salta por la tabla de
+// la ISA elegida (ver simd::active).
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "core_numeric/simd.h"
+#include "kernels.h"
+
+namespace core_numeric::simd {
+
+    isa detect() {
+        static const isa level = [] {
+#if defined(CORE_NUMERIC_KERNELS_X86)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return isa::avx512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c"))
+                return isa::avx2;
+            return isa::scalar;
+#elif defined(CORE_NUMERIC_KERNELS_NEON)
+            return isa::neon;
+#else
+            return isa::scalar;
+#endif
+        }();
+        return level;
+    }
+
+    namespace {
+        // Version de cada kernel para la ISA I. Las ramas descartadas no se
+        // instancian, asi que solo se enlazan las TUs que CMake compila.
+        template<isa I, typename T>
+        T sum_impl(const T* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::sum(p, n);
+            else if constexpr (I == isa::avx2) return avx2::sum(p, n);
+            else if constexpr (I == isa::neon) return neon::sum(p, n);
+            else return scalar::sum(p, n);
+        }
+
+        template<isa I, typename T>
+        T max_impl(const T* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::max(p, n);
+            else if constexpr (I == isa::avx2) return avx2::max(p, n);
+            else if constexpr (I == isa::neon) return neon::max(p, n);
+            else return scalar::max(p, n);
+        }
+
+        template<isa I, typename T>
+        T min_impl(const T* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::min(p, n);
+            else if constexpr (I == isa::avx2) return avx2::min(p, n);
+            else if constexpr (I == isa::neon) return neon::min(p, n);
+            else return scalar::min(p, n);
+        }
+
+        template<isa I, typename T>
+        double sq_dev_impl(const T* p, std::size_t n, double mu) {
+            if constexpr (I == isa::avx512) return avx512::sq_dev(p, n, mu);
+            else if constexpr (I == isa::avx2) return avx2::sq_dev(p, n, mu);
+            else if constexpr (I == isa::neon) return neon::sq_dev(p, n, mu);
+            else return scalar::sq_dev(p, n, mu);
+        }
+
+        template<isa I, typename T>
+        weighted_sums weighted_sum_impl(const T* x, const T* w, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::weighted_sum(x, w, n);
+            else if constexpr (I == isa::avx2) return avx2::weighted_sum(x, w, n);
+            else if constexpr (I == isa::neon) return neon::weighted_sum(x, w, n);
+            else return scalar::weighted_sum(x, w, n);
+        }
+
+        template<isa I, typename T>
+        double weighted_sq_dev_impl(const T* x, const T* w, std::size_t n, double mu) {
+            if constexpr (I == isa::avx512) return avx512::weighted_sq_dev(x, w, n, mu);
+            else if constexpr (I == isa::avx2) return avx2::weighted_sq_dev(x, w, n, mu);
+            else if constexpr (I == isa::neon) return neon::weighted_sq_dev(x, w, n, mu);
+            else return scalar::weighted_sq_dev(x, w, n, mu);
+        }
+
+        template<isa I, typename T>
+        double masked_sum_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::masked_sum(x, bits, n);
+            else if constexpr (I == isa::avx2) return avx2::masked_sum(x, bits, n);
+            else if constexpr (I == isa::neon) return neon::masked_sum(x, bits, n);
+            else return scalar::masked_sum(x, bits, n);
+        }
+
+        template<isa I, typename T>
+        double masked_sq_dev_impl(const T* x, const std::uint8_t* bits, std::size_t n, double mu) {
+            if constexpr (I == isa::avx512) return avx512::masked_sq_dev(x, bits, n, mu);
+            else if constexpr (I == isa::avx2) return avx2::masked_sq_dev(x, bits, n, mu);
+            else if constexpr (I == isa::neon) return neon::masked_sq_dev(x, bits, n, mu);
+            else return scalar::masked_sq_dev(x, bits, n, mu);
+        }
+
+        // Los kernels comparan en double; con float el maximo se representa exacto.
+        template<isa I, typename T>
+        T masked_max_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            if constexpr (I == isa::avx512) return static_cast<T>(avx512::masked_max(x, bits, n));
+            else if constexpr (I == isa::avx2) return static_cast<T>(avx2::masked_max(x, bits, n));
+            else if constexpr (I == isa::neon) return static_cast<T>(neon::masked_max(x, bits, n));
+            else return scalar::masked_max(x, bits, n);
+        }
+
+        template<isa I, typename T>
+        nan_skipped nan_sum_impl(const T* x, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::nan_sum(x, n);
+            else if constexpr (I == isa::avx2) return avx2::nan_sum(x, n);
+            else if constexpr (I == isa::neon) return neon::nan_sum(x, n);
+            else return scalar::nan_sum(x, n);
+        }
+
+        template<isa I, typename T>
+        double nan_sq_dev_impl(const T* x, std::size_t n, double mu) {
+            if constexpr (I == isa::avx512) return avx512::nan_sq_dev(x, n, mu);
+            else if constexpr (I == isa::avx2) return avx2::nan_sq_dev(x, n, mu);
+            else if constexpr (I == isa::neon) return neon::nan_sq_dev(x, n, mu);
+            else return scalar::nan_sq_dev(x, n, mu);
+        }
+
+        template<isa I, typename T>
+        nan_skipped nan_max_impl(const T* x, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::nan_max(x, n);
+            else if constexpr (I == isa::avx2) return avx2::nan_max(x, n);
+            else if constexpr (I == isa::neon) return neon::nan_max(x, n);
+            else return scalar::nan_max(x, n);
+        }
+
+        template<isa I, typename T>
+        nan_skipped nan_min_impl(const T* x, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::nan_min(x, n);
+            else if constexpr (I == isa::avx2) return avx2::nan_min(x, n);
+            else if constexpr (I == isa::neon) return neon::nan_min(x, n);
+            else return scalar::nan_min(x, n);
+        }
+
+        template<isa I, typename H>
+        double half_sum_impl(const H* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::sum_wide(p, n);
+            else if constexpr (I == isa::avx2) return avx2::sum_wide(p, n);
+            else if constexpr (I == isa::neon) return neon::sum_wide(p, n);
+            else return scalar::sum<H, double>(p, n);
+        }
+
+        // Los kernels devuelven el extremo en float; vuelve a 16 bits sin redondeo.
+        template<isa I, typename H>
+        H half_max_impl(const H* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return H(avx512::max(p, n));
+            else if constexpr (I == isa::avx2) return H(avx2::max(p, n));
+            else if constexpr (I == isa::neon) return H(neon::max(p, n));
+            else return scalar::max(p, n);
+        }
+
+        template<isa I, typename H>
+        H half_min_impl(const H* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return H(avx512::min(p, n));
+            else if constexpr (I == isa::avx2) return H(avx2::min(p, n));
+            else if constexpr (I == isa::neon) return H(neon::min(p, n));
+            else return scalar::min(p, n);
+        }
+
+        template<isa I>
+        double wide_sum_impl(const float* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::sum_wide(p, n);
+            else if constexpr (I == isa::avx2) return avx2::sum_wide(p, n);
+            else if constexpr (I == isa::neon) return neon::sum_wide(p, n);
+            else return scalar::sum<float, double>(p, n);
+        }
+
+        template<isa I>
+        std::int64_t wide_sum_impl(const std::int32_t* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::sum_wide(p, n);
+            else if constexpr (I == isa::avx2) return avx2::sum_wide(p, n);
+            else if constexpr (I == isa::neon) return neon::sum_wide(p, n);
+            else return scalar::sum<std::int32_t, std::int64_t>(p, n);
+        }
+
+        template<isa I>
+        square_sum sum_sq_impl(const std::int32_t* p, std::size_t n) {
+            if constexpr (I == isa::avx512) return avx512::sum_sq(p, n);
+            else if constexpr (I == isa::avx2) return avx2::sum_sq(p, n);
+            else if constexpr (I == isa::neon) return neon::sum_sq(p, n);
+            else return scalar::sum_sq(p, n);
+        }
+
+        template<typename F>
+        using fn = F*;
+
+        // Un puntero por punto de entrada; la tabla de cada ISA es constante y
+        // la activa se elige una vez, asi que llamar cuesta un salto indirecto.
+        struct kernel_table {
+            isa level;
+
+            fn<double(const double*, std::size_t)> sum_f64;
+            fn<float(const float*, std::size_t)> sum_f32;
+            fn<std::int32_t(const std::int32_t*, std::size_t)> sum_i32;
+            fn<std::int64_t(const std::int64_t*, std::size_t)> sum_i64;
+            fn<double(const float*, std::size_t)> sum_wide_f32;
+            fn<std::int64_t(const std::int32_t*, std::size_t)> sum_wide_i32;
+            fn<square_sum(const std::int32_t*, std::size_t)> sum_sq_i32;
+
+            fn<double(const double*, std::size_t)> max_f64;
+            fn<float(const float*, std::size_t)> max_f32;
+            fn<std::int32_t(const std::int32_t*, std::size_t)> max_i32;
+            fn<std::int64_t(const std::int64_t*, std::size_t)> max_i64;
+            fn<double(const double*, std::size_t)> min_f64;
+            fn<float(const float*, std::size_t)> min_f32;
+            fn<std::int32_t(const std::int32_t*, std::size_t)> min_i32;
+            fn<std::int64_t(const std::int64_t*, std::size_t)> min_i64;
+
+            fn<double(const double*, std::size_t, double)> sq_dev_f64;
+            fn<double(const float*, std::size_t, double)> sq_dev_f32;
+            fn<double(const std::int32_t*, std::size_t, double)> sq_dev_i32;
+
+            fn<weighted_sums(const double*, const double*, std::size_t)> weighted_sum_f64;
+            fn<weighted_sums(const float*, const float*, std::size_t)> weighted_sum_f32;
+            fn<double(const double*, const double*, std::size_t, double)> weighted_sq_dev_f64;
+            fn<double(const float*, const float*, std::size_t, double)> weighted_sq_dev_f32;
+
+            fn<double(const double*, const std::uint8_t*, std::size_t)> masked_sum_f64;
+            fn<double(const float*, const std::uint8_t*, std::size_t)> masked_sum_f32;
+            fn<double(const double*, const std::uint8_t*, std::size_t, double)> masked_sq_dev_f64;
+            fn<double(const float*, const std::uint8_t*, std::size_t, double)> masked_sq_dev_f32;
+            fn<double(const double*, const std::uint8_t*, std::size_t)> masked_max_f64;
+            fn<float(const float*, const std::uint8_t*, std::size_t)> masked_max_f32;
+
+            fn<nan_skipped(const double*, std::size_t)> nan_sum_f64;
+            fn<nan_skipped(const float*, std::size_t)> nan_sum_f32;
+            fn<double(const double*, std::size_t, double)> nan_sq_dev_f64;
+            fn<double(const float*, std::size_t, double)> nan_sq_dev_f32;
+            fn<nan_skipped(const double*, std::size_t)> nan_max_f64;
+            fn<nan_skipped(const float*, std::size_t)> nan_max_f32;
+            fn<nan_skipped(const double*, std::size_t)> nan_min_f64;
+            fn<nan_skipped(const float*, std::size_t)> nan_min_f32;
+
+            fn<double(const float16*, std::size_t)> sum_wide_f16;
+            fn<double(const bfloat16*, std::size_t)> sum_wide_bf16;
+            fn<double(const float16*, std::size_t, double)> sq_dev_f16;
+            fn<double(const bfloat16*, std::size_t, double)> sq_dev_bf16;
+            fn<float16(const float16*, std::size_t)> max_f16;
+            fn<bfloat16(const bfloat16*, std::size_t)> max_bf16;
+            fn<float16(const float16*, std::size_t)> min_f16;
+            fn<bfloat16(const bfloat16*, std::size_t)> min_bf16;
+        };
+
+        template<isa I>
+        constexpr kernel_table make_table() {
+            return {
+                .level = I,
+
+                .sum_f64 = sum_impl<I, double>,
+                .sum_f32 = sum_impl<I, float>,
+                .sum_i32 = sum_impl<I, std::int32_t>,
+                .sum_i64 = sum_impl<I, std::int64_t>,
+                .sum_wide_f32 = wide_sum_impl<I>,
+                .sum_wide_i32 = wide_sum_impl<I>,
+                .sum_sq_i32 = sum_sq_impl<I>,
+
+                .max_f64 = max_impl<I, double>,
+                .max_f32 = max_impl<I, float>,
+                .max_i32 = max_impl<I, std::int32_t>,
+                .max_i64 = max_impl<I, std::int64_t>,
+                .min_f64 = min_impl<I, double>,
+                .min_f32 = min_impl<I, float>,
+                .min_i32 = min_impl<I, std::int32_t>,
+                .min_i64 = min_impl<I, std::int64_t>,
+
+                .sq_dev_f64 = sq_dev_impl<I, double>,
+                .sq_dev_f32 = sq_dev_impl<I, float>,
+                .sq_dev_i32 = sq_dev_impl<I, std::int32_t>,
+
+                .weighted_sum_f64 = weighted_sum_impl<I, double>,
+                .weighted_sum_f32 = weighted_sum_impl<I, float>,
+                .weighted_sq_dev_f64 = weighted_sq_dev_impl<I, double>,
+                .weighted_sq_dev_f32 = weighted_sq_dev_impl<I, float>,
+
+                .masked_sum_f64 = masked_sum_impl<I, double>,
+                .masked_sum_f32 = masked_sum_impl<I, float>,
+                .masked_sq_dev_f64 = masked_sq_dev_impl<I, double>,
+                .masked_sq_dev_f32 = masked_sq_dev_impl<I, float>,
+                .masked_max_f64 = masked_max_impl<I, double>,
+                .masked_max_f32 = masked_max_impl<I, float>,
+
+                .nan_sum_f64 = nan_sum_impl<I, double>,
+                .nan_sum_f32 = nan_sum_impl<I, float>,
+                .nan_sq_dev_f64 = nan_sq_dev_impl<I, double>,
+                .nan_sq_dev_f32 = nan_sq_dev_impl<I, float>,
+                .nan_max_f64 = nan_max_impl<I, double>,
+                .nan_max_f32 = nan_max_impl<I, float>,
+                .nan_min_f64 = nan_min_impl<I, double>,
+                .nan_min_f32 = nan_min_impl<I, float>,
+
+                .sum_wide_f16 = half_sum_impl<I, float16>,
+                .sum_wide_bf16 = half_sum_impl<I, bfloat16>,
+                .sq_dev_f16 = sq_dev_impl<I, float16>,
+                .sq_dev_bf16 = sq_dev_impl<I, bfloat16>,
+                .max_f16 = half_max_impl<I, float16>,
+                .max_bf16 = half_max_impl<I, bfloat16>,
+                .min_f16 = half_min_impl<I, float16>,
+                .min_bf16 = half_min_impl<I, bfloat16>,
+            };
+        }
+
+        constexpr kernel_table scalar_table = make_table<isa::scalar>();
+#if defined(CORE_NUMERIC_KERNELS_X86)
+        constexpr kernel_table avx2_table = make_table<isa::avx2>();
+        constexpr kernel_table avx512_table = make_table<isa::avx512>();
+#elif defined(CORE_NUMERIC_KERNELS_NEON)
+        constexpr kernel_table neon_table = make_table<isa::neon>();
+#endif
+
+        // nullptr si la variante no se compilo o la CPU no la soporta.
+        const kernel_table* table_for(isa level) {
+            [[maybe_unused]] const isa cpu = detect();
+            switch (level) {
+#if defined(CORE_NUMERIC_KERNELS_X86)
+                case isa::avx512: return cpu == isa::avx512 ? &avx512_table : nullptr;
+                case isa::avx2:   return cpu == isa::avx512 || cpu == isa::avx2 ? &avx2_table : nullptr;
+#elif defined(CORE_NUMERIC_KERNELS_NEON)
+                case isa::neon:   return cpu == isa::neon ? &neon_table : nullptr;
+#endif
+                case isa::scalar: return &scalar_table;
+                default:          return nullptr;
+            }
+        }
+
+        // CORE_NUMERIC_ISA solo puede pedir un nivel que la CPU tenga (p. ej.
+        // avx2 en una maquina con AVX-512); si no, se usa detect().
+        const kernel_table* startup_table() {
+            if (const char* want = std::getenv("CORE_NUMERIC_ISA")) {
+                for (isa level : {isa::scalar, isa::neon, isa::avx2, isa::avx512})
+                    if (std::strcmp(want, name(level)) == 0)
+                        if (const kernel_table* t = table_for(level)) return t;
+            }
+            return table_for(detect());
+        }
+
+        // Inicializada en constante con la tabla escalar: si el inicializador
+        // estatico de otra TU llama a un kernel antes de que corra el de abajo,
+        // obtiene un resultado correcto con el lazo escalar.
+        constinit std::atomic<const kernel_table*> active_table{&scalar_table};
+
+        [[maybe_unused]] const bool bound = (active_table.store(startup_table(), std::memory_order_relaxed), true);
+
+        const kernel_table& table() { return *active_table.load(std::memory_order_relaxed); }
+    }
+
+    isa active() { return table().level; }
+
+    void use(isa level) {
+        const kernel_table* t = table_for(level);
+        if (!t) throw std::invalid_argument(std::string("simd::use: ") + name(level) + " is not available on this CPU");
+        active_table.store(t, std::memory_order_relaxed);
+    }
+
+    double sum(const double* p, std::size_t n) { return table().sum_f64(p, n); }
+    float sum(const float* p, std::size_t n) { return table().sum_f32(p, n); }
+    std::int32_t sum(const std::int32_t* p, std::size_t n) { return table().sum_i32(p, n); }
+    std::int64_t sum(const std::int64_t* p, std::size_t n) { return table().sum_i64(p, n); }
+
+    double sum_wide(const float* p, std::size_t n) { return table().sum_wide_f32(p, n); }
+    std::int64_t sum_wide(const std::int32_t* p, std::size_t n) { return table().sum_wide_i32(p, n); }
+    square_sum sum_sq(const std::int32_t* p, std::size_t n) { return table().sum_sq_i32(p, n); }
+
+    double max(const double* p, std::size_t n) { return table().max_f64(p, n); }
+    float max(const float* p, std::size_t n) { return table().max_f32(p, n); }
+    std::int32_t max(const std::int32_t* p, std::size_t n) { return table().max_i32(p, n); }
+    std::int64_t max(const std::int64_t* p, std::size_t n) { return table().max_i64(p, n); }
+
+    double min(const double* p, std::size_t n) { return table().min_f64(p, n); }
+    float min(const float* p, std::size_t n) { return table().min_f32(p, n); }
+    std::int32_t min(const std::int32_t* p, std::size_t n) { return table().min_i32(p, n); }
+    std::int64_t min(const std::int64_t* p, std::size_t n) { return table().min_i64(p, n); }
+
+    double sq_dev(const double* p, std::size_t n, double mu) { return table().sq_dev_f64(p, n, mu); }
+    double sq_dev(const float* p, std::size_t n, double mu) { return table().sq_dev_f32(p, n, mu); }
+    double sq_dev(const std::int32_t* p, std::size_t n, double mu) { return table().sq_dev_i32(p, n, mu); }
+
+    // int64 no tiene kernel vectorial de desviaciones.
+    double sq_dev(const std::int64_t* p, std::size_t n, double mu) { return scalar::sq_dev(p, n, mu); }
+
+    weighted_sums weighted_sum(const double* x, const double* w, std::size_t n) { return table().weighted_sum_f64(x, w, n); }
+    weighted_sums weighted_sum(const float* x, const float* w, std::size_t n) { return table().weighted_sum_f32(x, w, n); }
+    double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu) { return table().weighted_sq_dev_f64(x, w, n, mu); }
+    double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu) { return table().weighted_sq_dev_f32(x, w, n, mu); }
+
+    double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n) { return table().masked_sum_f64(x, bits, n); }
+    double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n) { return table().masked_sum_f32(x, bits, n); }
+    double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu) { return table().masked_sq_dev_f64(x, bits, n, mu); }
+    double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu) { return table().masked_sq_dev_f32(x, bits, n, mu); }
+    double masked_max(const double* x, const std::uint8_t* bits, std::size_t n) { return table().masked_max_f64(x, bits, n); }
+    float masked_max(const float* x, const std::uint8_t* bits, std::size_t n) { return table().masked_max_f32(x, bits, n); }
+
+    nan_skipped nan_sum(const double* x, std::size_t n) { return table().nan_sum_f64(x, n); }
+    nan_skipped nan_sum(const float* x, std::size_t n) { return table().nan_sum_f32(x, n); }
+    double nan_sq_dev(const double* x, std::size_t n, double mu) { return table().nan_sq_dev_f64(x, n, mu); }
+    double nan_sq_dev(const float* x, std::size_t n, double mu) { return table().nan_sq_dev_f32(x, n, mu); }
+    nan_skipped nan_max(const double* x, std::size_t n) { return table().nan_max_f64(x, n); }
+    nan_skipped nan_max(const float* x, std::size_t n) { return table().nan_max_f32(x, n); }
+    nan_skipped nan_min(const double* x, std::size_t n) { return table().nan_min_f64(x, n); }
+    nan_skipped nan_min(const float* x, std::size_t n) { return table().nan_min_f32(x, n); }
+
+    double sum_wide(const float16* p, std::size_t n) { return table().sum_wide_f16(p, n); }
+    double sum_wide(const bfloat16* p, std::size_t n) { return table().sum_wide_bf16(p, n); }
+    double sq_dev(const float16* p, std::size_t n, double mu) { return table().sq_dev_f16(p, n, mu); }
+    double sq_dev(const bfloat16* p, std::size_t n, double mu) { return table().sq_dev_bf16(p, n, mu); }
+    float16 max(const float16* p, std::size_t n) { return table().max_f16(p, n); }
+    bfloat16 max(const bfloat16* p, std::size_t n) { return table().max_bf16(p, n); }
+    float16 min(const float16* p, std::size_t n) { return table().min_f16(p, n); }
+    bfloat16 min(const bfloat16* p, std::size_t n) { return table().min_bf16(p, n); }
+}
@@ -0,0 +1,30 @@
+#include "core_numeric/stream.h"
+
+#include <cerrno>
+#include <system_error>
+
+namespace core_numeric {
+
+    file_stream::file_stream(const std::string& path)
+        : file_(std::fopen(path.c_str(), "rb")), owns_(true) {
+        if (!file_) throw std::system_error(errno, std::generic_category(), "file_stream: cannot open " + path);
+    }
+
+    file_stream::~file_stream() {
+        if (file_ && owns_) std::fclose(file_);
+    }
+
+    std::size_t file_stream::read(std::byte* dst, std::size_t n) {
+        std::size_t total = 0;
+        while (total < n) {
+            const std::size_t got = std::fread(dst + total, 1, n - total, file_);
+            total += got;
+            if (got == 0) {
+                if (std::ferror(file_))
+                    throw std::system_error(errno, std::generic_category(), "file_stream: read failed");
+                break;
+            }
+        }
+        return total;
+    }
+}
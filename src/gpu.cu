@@ -0,0 +1,125 @@
+#include <cstddef>
+
+#include <cuda_runtime.h>
+
+#include "core_numeric/gpu_reduce.cuh"
+
+// Instancias de reduce_indices para las funciones de gpu.h; los functores
+// van en vez de lambdas para no exigir --extended-lambda a la biblioteca.
+namespace core_numeric::detail::gpu {
+
+    namespace {
+        struct plus {
+            __device__ double operator()(double a, double b) const { return a + b; }
+        };
+
+        template<typename Q>
+        struct widened {
+            const Q* x;
+
+            __device__ double operator()(std::size_t i) const { return static_cast<double>(x[i]); }
+        };
+
+        // Chan con los casos vacios; con b.count == 1 es un paso de Welford.
+        struct merge_moments {
+            __device__ moments2 operator()(const moments2& a, const moments2& b) const {
+                if (a.count == 0) return b;
+                if (b.count == 0) return a;
+
+                const double na = static_cast<double>(a.count);
+                const double nb = static_cast<double>(b.count);
+                const double delta = b.mean - a.mean;
+                const double delta_n = delta / (na + nb);
+
+                moments2 r;
+                r.count = a.count + b.count;
+                r.mean = a.mean + delta_n * nb;
+                r.m2 = a.m2 + b.m2 + delta * delta_n * na * nb;
+                r.min = b.min < a.min ? b.min : a.min;
+                r.max = b.max > a.max ? b.max : a.max;
+                return r;
+            }
+        };
+
+        template<typename Q>
+        struct single {
+            const Q* x;
+
+            __device__ moments2 operator()(std::size_t i) const {
+                const double v = static_cast<double>(x[i]);
+                return {1, v, 0.0, v, v};
+            }
+        };
+
+        struct indexed {
+            double value;
+            std::size_t index;
+        };
+
+        inline constexpr std::size_t no_index = ~std::size_t{0};
+
+        // Conmutativa: en empates gana el menor indice, como en la CPU.
+        template<bool Max>
+        struct pick {
+            __device__ indexed operator()(const indexed& a, const indexed& b) const {
+                if (b.index == no_index) return a;
+                if (a.index == no_index) return b;
+                bool better;
+                if constexpr (Max) better = b.value > a.value;
+                else better = b.value < a.value;
+                return better || (b.value == a.value && b.index < a.index) ? b : a;
+            }
+        };
+
+        template<typename Q>
+        struct at_index {
+            const Q* x;
+
+            __device__ indexed operator()(std::size_t i) const { return {static_cast<double>(x[i]), i}; }
+        };
+
+        template<typename Q>
+        double sum_of(const execution::device_policy& policy, const Q* x, std::size_t n) {
+            return reduce_indices(policy, n, 0.0, plus{}, widened<Q>{x});
+        }
+
+        template<typename Q>
+        moments2 moments_of(const execution::device_policy& policy, const Q* x, std::size_t n) {
+            return reduce_indices(policy, n, moments2{0, 0.0, 0.0, 0.0, 0.0}, merge_moments{}, single<Q>{x});
+        }
+
+        template<bool Max, typename Q>
+        std::size_t arg_extreme(const execution::device_policy& policy, const Q* x, std::size_t n) {
+            return reduce_indices(policy, n, indexed{0.0, no_index}, pick<Max>{}, at_index<Q>{x}).index;
+        }
+    }
+
+    double sum(const execution::device_policy& policy, const double* x, std::size_t n) { return sum_of(policy, x, n); }
+    double sum(const execution::device_policy& policy, const float* x, std::size_t n) { return sum_of(policy, x, n); }
+
+    moments2 moments(const execution::device_policy& policy, const double* x, std::size_t n) {
+        return moments_of(policy, x, n);
+    }
+    moments2 moments(const execution::device_policy& policy, const float* x, std::size_t n) {
+        return moments_of(policy, x, n);
+    }
+
+    std::size_t argmax(const execution::device_policy& policy, const double* x, std::size_t n) {
+        return arg_extreme<true>(policy, x, n);
+    }
+    std::size_t argmax(const execution::device_policy& policy, const float* x, std::size_t n) {
+        return arg_extreme<true>(policy, x, n);
+    }
+    std::size_t argmin(const execution::device_policy& policy, const double* x, std::size_t n) {
+        return arg_extreme<false>(policy, x, n);
+    }
+    std::size_t argmin(const execution::device_policy& policy, const float* x, std::size_t n) {
+        return arg_extreme<false>(policy, x, n);
+    }
+
+    void load(const execution::device_policy& policy, void* out, const void* at, std::size_t bytes) {
+        const cudaStream_t stream = stream_of(policy);
+        check(cudaMemcpyAsync(out, at, bytes, cudaMemcpyDeviceToHost, stream), "cudaMemcpyAsync");
+        check(cudaStreamSynchronize(stream), "cudaStreamSynchronize");
+    }
+}
@@ -0,0 +1,8 @@
+#define CORE_NUMERIC_BUILDING_INSTANTIATIONS
+#include "core_numeric/core_numeric.h"
+
+namespace core_numeric {
+#define CORE_NUMERIC_DEFINE_(C) CORE_NUMERIC_INSTANTIATE(, C)
+    CORE_NUMERIC_FOR_EACH_COMMON_CONTAINER(CORE_NUMERIC_DEFINE_)
+#undef CORE_NUMERIC_DEFINE_
+}
@@ -0,0 +1,199 @@
+#ifndef CORE_NUMERIC_KERNEL_TAIL_H
+#define CORE_NUMERIC_KERNEL_TAIL_H
+
+#include <cstddef>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+#include "core_numeric/simd.h"
+
+// Colas escalares de los kernels. Van en un espacio de nombres anonimo a
+// proposito: cada TU de kernels se compila con flags de ISA distintos y sus
+// instancias no deben mezclarse con las del resto del programa al enlazar.
+namespace core_numeric::simd {
+    namespace {
+        namespace tail {
+            template<typename T>
+            T max(const T* p, std::size_t n) {
+                T result = p[0];
+                for (std::size_t i = 1; i < n; ++i)
+                    if (p[i] > result) result = p[i];
+                return result;
+            }
+
+            template<typename T>
+            T min(const T* p, std::size_t n) {
+                T result = p[0];
+                for (std::size_t i = 1; i < n; ++i)
+                    if (p[i] < result) result = p[i];
+                return result;
+            }
+
+            inline square_sum sum_sq(const std::int32_t* p, std::size_t n) {
+                square_sum r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const auto sq = static_cast<std::uint64_t>(static_cast<std::int64_t>(p[i]) * p[i]);
+                    r.hi += sq >> 32;
+                    r.lo += sq & 0xffffffffu;
+                }
+                return r;
+            }
+
+            template<typename T>
+            double sq_dev(const T* p, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    double d = static_cast<double>(p[i]) - mu;
+                    acc += d * d;
+                }
+                return acc;
+            }
+
+            template<typename T>
+            weighted_sums weighted_sum(const T* x, const T* w, std::size_t n) {
+                weighted_sums r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    r.weight += static_cast<double>(w[i]);
+                    r.sum += static_cast<double>(w[i]) * static_cast<double>(x[i]);
+                }
+                return r;
+            }
+
+            template<typename T>
+            double weighted_sq_dev(const T* x, const T* w, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double d = static_cast<double>(x[i]) - mu;
+                    acc += static_cast<double>(w[i]) * d * d;
+                }
+                return acc;
+            }
+
+            template<typename T>
+            double masked_sum(const T* x, const std::uint8_t* bits, std::size_t n) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i)
+                    if (valid_bit(bits, i)) acc += static_cast<double>(x[i]);
+                return acc;
+            }
+
+            template<typename T>
+            double masked_sq_dev(const T* x, const std::uint8_t* bits, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (!valid_bit(bits, i)) continue;
+                    const double d = static_cast<double>(x[i]) - mu;
+                    acc += d * d;
+                }
+                return acc;
+            }
+
+            template<typename T>
+            double masked_max(const T* x, const std::uint8_t* bits, std::size_t n) {
+                double result = -std::numeric_limits<double>::infinity();
+                for (std::size_t i = 0; i < n; ++i)
+                    if (valid_bit(bits, i) && x[i] > result) result = x[i];
+                return result;
+            }
+
+            template<typename T>
+            nan_skipped nan_sum(const T* x, std::size_t n) {
+                nan_skipped r;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double v = static_cast<double>(x[i]);
+                    const bool ok = v == v;
+                    r.value += ok ? v : 0.0;
+                    r.count += ok;
+                }
+                return r;
+            }
+
+            template<typename T>
+            double nan_sq_dev(const T* x, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double d = static_cast<double>(x[i]) - mu;
+                    acc += d == d ? d * d : 0.0;
+                }
+                return acc;
+            }
+
+            template<typename T>
+            nan_skipped nan_max(const T* x, std::size_t n) {
+                nan_skipped r{-std::numeric_limits<double>::infinity(), 0};
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double v = static_cast<double>(x[i]);
+                    r.count += v == v;
+                    if (v > r.value) r.value = v;
+                }
+                return r;
+            }
+
+            template<typename T>
+            nan_skipped nan_min(const T* x, std::size_t n) {
+                nan_skipped r{std::numeric_limits<double>::infinity(), 0};
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double v = static_cast<double>(x[i]);
+                    r.count += v == v;
+                    if (v < r.value) r.value = v;
+                }
+                return r;
+            }
+
+            // Mismo algoritmo que detail::half_to_float (half.h), repetido aqui
+            // por la razon de arriba: no depender de la copia inline de otra TU.
+            inline float widen(float16 h) {
+                std::uint32_t u = static_cast<std::uint32_t>(h.bits & 0x7fffu) << 13;
+                const std::uint32_t exp = u & (0x7c00u << 13);
+                u += (127 - 15) << 23;
+                if (exp == 0x7c00u << 13) {
+                    u += (128 - 16) << 23;
+                } else if (exp == 0) {
+                    u += 1 << 23;
+                    u = std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) - std::bit_cast<float>(113u << 23));
+                }
+                return std::bit_cast<float>(u | (static_cast<std::uint32_t>(h.bits & 0x8000u) << 16));
+            }
+
+            inline float widen(bfloat16 h) {
+                return std::bit_cast<float>(static_cast<std::uint32_t>(h.bits) << 16);
+            }
+
+            template<typename H>
+            double half_sum(const H* p, std::size_t n) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) acc += widen(p[i]);
+                return acc;
+            }
+
+            template<typename H>
+            double half_sq_dev(const H* p, std::size_t n, double mu) {
+                double acc = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double d = widen(p[i]) - mu;
+                    acc += d * d;
+                }
+                return acc;
+            }
+
+            template<typename H>
+            float half_max(const H* p, std::size_t n) {
+                float result = widen(p[0]);
+                for (std::size_t i = 1; i < n; ++i)
+                    if (widen(p[i]) > result) result = widen(p[i]);
+                return result;
+            }
+
+            template<typename H>
+            float half_min(const H* p, std::size_t n) {
+                float result = widen(p[0]);
+                for (std::size_t i = 1; i < n; ++i)
+                    if (widen(p[i]) < result) result = widen(p[i]);
+                return result;
+            }
+        }
+    }
+}
+
+#endif // CORE_NUMERIC_KERNEL_TAIL_H
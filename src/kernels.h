@@ -0,0 +1,172 @@
+#ifndef CORE_NUMERIC_KERNELS_H
+#define CORE_NUMERIC_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core_numeric/simd.h"
+
+// Declaraciones de los kernels por ISA. Cada espacio de nombres se define en
+// su propia TU (kernels_<isa>.cpp) compilada con los flags de esa ISA.
+namespace core_numeric::simd {
+    namespace avx2 {
+        double sum(const double* p, std::size_t n);
+        float sum(const float* p, std::size_t n);
+        std::int32_t sum(const std::int32_t* p, std::size_t n);
+        std::int64_t sum(const std::int64_t* p, std::size_t n);
+        double sum_wide(const float* p, std::size_t n);
+        std::int64_t sum_wide(const std::int32_t* p, std::size_t n);
+        square_sum sum_sq(const std::int32_t* p, std::size_t n);
+
+        double max(const double* p, std::size_t n);
+        float max(const float* p, std::size_t n);
+        std::int32_t max(const std::int32_t* p, std::size_t n);
+        std::int64_t max(const std::int64_t* p, std::size_t n);
+
+        double min(const double* p, std::size_t n);
+        float min(const float* p, std::size_t n);
+        std::int32_t min(const std::int32_t* p, std::size_t n);
+        std::int64_t min(const std::int64_t* p, std::size_t n);
+
+        double sq_dev(const double* p, std::size_t n, double mu);
+        double sq_dev(const float* p, std::size_t n, double mu);
+        double sq_dev(const std::int32_t* p, std::size_t n, double mu);
+
+        weighted_sums weighted_sum(const double* x, const double* w, std::size_t n);
+        weighted_sums weighted_sum(const float* x, const float* w, std::size_t n);
+        double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu);
+        double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu);
+        double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_max(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_max(const float* x, const std::uint8_t* bits, std::size_t n);
+
+        nan_skipped nan_sum(const double* x, std::size_t n);
+        nan_skipped nan_sum(const float* x, std::size_t n);
+        double nan_sq_dev(const double* x, std::size_t n, double mu);
+        double nan_sq_dev(const float* x, std::size_t n, double mu);
+        nan_skipped nan_max(const double* x, std::size_t n);
+        nan_skipped nan_max(const float* x, std::size_t n);
+        nan_skipped nan_min(const double* x, std::size_t n);
+        nan_skipped nan_min(const float* x, std::size_t n);
+
+        double sum_wide(const float16* p, std::size_t n);
+        double sum_wide(const bfloat16* p, std::size_t n);
+        double sq_dev(const float16* p, std::size_t n, double mu);
+        double sq_dev(const bfloat16* p, std::size_t n, double mu);
+        float max(const float16* p, std::size_t n);
+        float max(const bfloat16* p, std::size_t n);
+        float min(const float16* p, std::size_t n);
+        float min(const bfloat16* p, std::size_t n);
+    }
+
+    namespace avx512 {
+        double sum(const double* p, std::size_t n);
+        float sum(const float* p, std::size_t n);
+        std::int32_t sum(const std::int32_t* p, std::size_t n);
+        std::int64_t sum(const std::int64_t* p, std::size_t n);
+        double sum_wide(const float* p, std::size_t n);
+        std::int64_t sum_wide(const std::int32_t* p, std::size_t n);
+        square_sum sum_sq(const std::int32_t* p, std::size_t n);
+
+        double max(const double* p, std::size_t n);
+        float max(const float* p, std::size_t n);
+        std::int32_t max(const std::int32_t* p, std::size_t n);
+        std::int64_t max(const std::int64_t* p, std::size_t n);
+
+        double min(const double* p, std::size_t n);
+        float min(const float* p, std::size_t n);
+        std::int32_t min(const std::int32_t* p, std::size_t n);
+        std::int64_t min(const std::int64_t* p, std::size_t n);
+
+        double sq_dev(const double* p, std::size_t n, double mu);
+        double sq_dev(const float* p, std::size_t n, double mu);
+        double sq_dev(const std::int32_t* p, std::size_t n, double mu);
+
+        weighted_sums weighted_sum(const double* x, const double* w, std::size_t n);
+        weighted_sums weighted_sum(const float* x, const float* w, std::size_t n);
+        double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu);
+        double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu);
+        double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_max(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_max(const float* x, const std::uint8_t* bits, std::size_t n);
+
+        nan_skipped nan_sum(const double* x, std::size_t n);
+        nan_skipped nan_sum(const float* x, std::size_t n);
+        double nan_sq_dev(const double* x, std::size_t n, double mu);
+        double nan_sq_dev(const float* x, std::size_t n, double mu);
+        nan_skipped nan_max(const double* x, std::size_t n);
+        nan_skipped nan_max(const float* x, std::size_t n);
+        nan_skipped nan_min(const double* x, std::size_t n);
+        nan_skipped nan_min(const float* x, std::size_t n);
+
+        double sum_wide(const float16* p, std::size_t n);
+        double sum_wide(const bfloat16* p, std::size_t n);
+        double sq_dev(const float16* p, std::size_t n, double mu);
+        double sq_dev(const bfloat16* p, std::size_t n, double mu);
+        float max(const float16* p, std::size_t n);
+        float max(const bfloat16* p, std::size_t n);
+        float min(const float16* p, std::size_t n);
+        float min(const bfloat16* p, std::size_t n);
+    }
+
+    namespace neon {
+        double sum(const double* p, std::size_t n);
+        float sum(const float* p, std::size_t n);
+        std::int32_t sum(const std::int32_t* p, std::size_t n);
+        std::int64_t sum(const std::int64_t* p, std::size_t n);
+        double sum_wide(const float* p, std::size_t n);
+        std::int64_t sum_wide(const std::int32_t* p, std::size_t n);
+        square_sum sum_sq(const std::int32_t* p, std::size_t n);
+
+        double max(const double* p, std::size_t n);
+        float max(const float* p, std::size_t n);
+        std::int32_t max(const std::int32_t* p, std::size_t n);
+        std::int64_t max(const std::int64_t* p, std::size_t n);
+
+        double min(const double* p, std::size_t n);
+        float min(const float* p, std::size_t n);
+        std::int32_t min(const std::int32_t* p, std::size_t n);
+        std::int64_t min(const std::int64_t* p, std::size_t n);
+
+        double sq_dev(const double* p, std::size_t n, double mu);
+        double sq_dev(const float* p, std::size_t n, double mu);
+        double sq_dev(const std::int32_t* p, std::size_t n, double mu);
+
+        weighted_sums weighted_sum(const double* x, const double* w, std::size_t n);
+        weighted_sums weighted_sum(const float* x, const float* w, std::size_t n);
+        double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu);
+        double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu);
+        double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n);
+        double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu);
+        double masked_max(const double* x, const std::uint8_t* bits, std::size_t n);
+        double masked_max(const float* x, const std::uint8_t* bits, std::size_t n);
+
+        nan_skipped nan_sum(const double* x, std::size_t n);
+        nan_skipped nan_sum(const float* x, std::size_t n);
+        double nan_sq_dev(const double* x, std::size_t n, double mu);
+        double nan_sq_dev(const float* x, std::size_t n, double mu);
+        nan_skipped nan_max(const double* x, std::size_t n);
+        nan_skipped nan_max(const float* x, std::size_t n);
+        nan_skipped nan_min(const double* x, std::size_t n);
+        nan_skipped nan_min(const float* x, std::size_t n);
+
+        double sum_wide(const float16* p, std::size_t n);
+        double sum_wide(const bfloat16* p, std::size_t n);
+        double sq_dev(const float16* p, std::size_t n, double mu);
+        double sq_dev(const bfloat16* p, std::size_t n, double mu);
+        float max(const float16* p, std::size_t n);
+        float max(const bfloat16* p, std::size_t n);
+        float min(const float16* p, std::size_t n);
+        float min(const bfloat16* p, std::size_t n);
+    }
+}
+
+#endif // CORE_NUMERIC_KERNELS_H
@@ -0,0 +1,553 @@
+// Kernels AVX2 (+FMA, F16C). Esta TU se compila con -mavx2 -mfma -mf16c y solo se llama
+// despues de comprobar el soporte en tiempo de ejecucion (dispatch.cpp).
+
+#include <immintrin.h>
+
+#include <limits>
+
+#include "kernels.h"
+#include "kernel_tail.h"
+
+namespace core_numeric::simd::avx2 {
+    namespace {
+        double hsum(__m256d v) {
+            __m128d lo = _mm256_castpd256_pd128(v);
+            __m128d hi = _mm256_extractf128_pd(v, 1);
+            lo = _mm_add_pd(lo, hi);
+            return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+        }
+    }
+
+    double sum(const double* p, std::size_t n) {
+        __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            a0 = _mm256_add_pd(a0, _mm256_loadu_pd(p + i));
+            a1 = _mm256_add_pd(a1, _mm256_loadu_pd(p + i + 4));
+        }
+        double acc = hsum(_mm256_add_pd(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    float sum(const float* p, std::size_t n) {
+        __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            a0 = _mm256_add_ps(a0, _mm256_loadu_ps(p + i));
+            a1 = _mm256_add_ps(a1, _mm256_loadu_ps(p + i + 8));
+        }
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, _mm256_add_ps(a0, a1));
+        float acc = 0.0f;
+        for (float l : lanes) acc += l;
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    std::int32_t sum(const std::int32_t* p, std::size_t n) {
+        __m256i a = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+            a = _mm256_add_epi32(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+        alignas(32) std::uint32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        std::uint32_t acc = 0;
+        for (auto l : lanes) acc += l;
+        for (; i < n; ++i) acc += static_cast<std::uint32_t>(p[i]);
+        return static_cast<std::int32_t>(acc);
+    }
+
+    std::int64_t sum(const std::int64_t* p, std::size_t n) {
+        __m256i a = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+            a = _mm256_add_epi64(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        std::uint64_t acc = 0;
+        for (auto l : lanes) acc += l;
+        for (; i < n; ++i) acc += static_cast<std::uint64_t>(p[i]);
+        return static_cast<std::int64_t>(acc);
+    }
+
+    std::int64_t sum_wide(const std::int32_t* p, std::size_t n) {
+        __m256i a0 = _mm256_setzero_si256(), a1 = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            a0 = _mm256_add_epi64(a0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+            a1 = _mm256_add_epi64(a1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+        }
+        alignas(32) std::int64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(a0, a1));
+        std::int64_t acc = 0;
+        for (auto l : lanes) acc += l;
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    // mul_epi32 multiplica los carriles pares; los impares se bajan con un desplazamiento.
+    square_sum sum_sq(const std::int32_t* p, std::size_t n) {
+        const __m256i mask = _mm256_set1_epi64x(0xffffffff);
+        __m256i hi = _mm256_setzero_si256(), lo = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i e = _mm256_mul_epi32(x, x);
+            __m256i o = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(x, 32));
+            hi = _mm256_add_epi64(hi, _mm256_add_epi64(_mm256_srli_epi64(e, 32), _mm256_srli_epi64(o, 32)));
+            lo = _mm256_add_epi64(lo, _mm256_add_epi64(_mm256_and_si256(e, mask), _mm256_and_si256(o, mask)));
+        }
+        alignas(32) std::uint64_t h[4], l[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(h), hi);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l), lo);
+        square_sum r = tail::sum_sq(p + i, n - i);
+        for (int k = 0; k < 4; ++k) r += {h[k], l[k]};
+        return r;
+    }
+
+    // Suma de float acumulada en double, como la rama flotante de mean.
+    double sum_wide(const float* p, std::size_t n) {
+        __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 x = _mm256_loadu_ps(p + i);
+            a0 = _mm256_add_pd(a0, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+            a1 = _mm256_add_pd(a1, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+        }
+        double acc = hsum(_mm256_add_pd(a0, a1));
+        for (; i < n; ++i) acc += static_cast<double>(p[i]);
+        return acc;
+    }
+
+    // max/min(x, acc) devuelven acc si alguno es NaN: igual que el lazo escalar.
+    double max(const double* p, std::size_t n) {
+        if (n < 4) return tail::max(p, n);
+        __m256d a = _mm256_set1_pd(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) a = _mm256_max_pd(_mm256_loadu_pd(p + i), a);
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, a);
+        double result = lanes[0];
+        for (double l : lanes) if (l > result) result = l;
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    double min(const double* p, std::size_t n) {
+        if (n < 4) return tail::min(p, n);
+        __m256d a = _mm256_set1_pd(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) a = _mm256_min_pd(_mm256_loadu_pd(p + i), a);
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, a);
+        double result = lanes[0];
+        for (double l : lanes) if (l < result) result = l;
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    float max(const float* p, std::size_t n) {
+        if (n < 8) return tail::max(p, n);
+        __m256 a = _mm256_set1_ps(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm256_max_ps(_mm256_loadu_ps(p + i), a);
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, a);
+        float result = lanes[0];
+        for (float l : lanes) if (l > result) result = l;
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    float min(const float* p, std::size_t n) {
+        if (n < 8) return tail::min(p, n);
+        __m256 a = _mm256_set1_ps(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm256_min_ps(_mm256_loadu_ps(p + i), a);
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, a);
+        float result = lanes[0];
+        for (float l : lanes) if (l < result) result = l;
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    std::int32_t max(const std::int32_t* p, std::size_t n) {
+        if (n < 8) return tail::max(p, n);
+        __m256i a = _mm256_set1_epi32(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+            a = _mm256_max_epi32(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+        alignas(32) std::int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        std::int32_t result = lanes[0];
+        for (auto l : lanes) if (l > result) result = l;
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    std::int32_t min(const std::int32_t* p, std::size_t n) {
+        if (n < 8) return tail::min(p, n);
+        __m256i a = _mm256_set1_epi32(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+            a = _mm256_min_epi32(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+        alignas(32) std::int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        std::int32_t result = lanes[0];
+        for (auto l : lanes) if (l < result) result = l;
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    std::int64_t max(const std::int64_t* p, std::size_t n) {
+        if (n < 4) return tail::max(p, n);
+        __m256i a = _mm256_set1_epi64x(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            a = _mm256_blendv_epi8(a, x, _mm256_cmpgt_epi64(x, a));
+        }
+        alignas(32) std::int64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        std::int64_t result = lanes[0];
+        for (auto l : lanes) if (l > result) result = l;
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    std::int64_t min(const std::int64_t* p, std::size_t n) {
+        if (n < 4) return tail::min(p, n);
+        __m256i a = _mm256_set1_epi64x(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            a = _mm256_blendv_epi8(a, x, _mm256_cmpgt_epi64(a, x));
+        }
+        alignas(32) std::int64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+        std::int64_t result = lanes[0];
+        for (auto l : lanes) if (l < result) result = l;
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    double sq_dev(const double* p, std::size_t n, double mu) {
+        __m256d m = _mm256_set1_pd(mu);
+        __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(p + i), m);
+            __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(p + i + 4), m);
+            a0 = _mm256_fmadd_pd(d0, d0, a0);
+            a1 = _mm256_fmadd_pd(d1, d1, a1);
+        }
+        return hsum(_mm256_add_pd(a0, a1)) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    double sq_dev(const float* p, std::size_t n, double mu) {
+        __m256d m = _mm256_set1_pd(mu);
+        __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 x = _mm256_loadu_ps(p + i);
+            __m256d d0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(x)), m);
+            __m256d d1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)), m);
+            a0 = _mm256_fmadd_pd(d0, d0, a0);
+            a1 = _mm256_fmadd_pd(d1, d1, a1);
+        }
+        return hsum(_mm256_add_pd(a0, a1)) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    double sq_dev(const std::int32_t* p, std::size_t n, double mu) {
+        __m256d m = _mm256_set1_pd(mu);
+        __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256d d0 = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)), m);
+            __m256d d1 = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)), m);
+            a0 = _mm256_fmadd_pd(d0, d0, a0);
+            a1 = _mm256_fmadd_pd(d1, d1, a1);
+        }
+        return hsum(_mm256_add_pd(a0, a1)) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    namespace {
+        // Cuatro elementos en double: los kernels de pesos y mascaras comparten el cuerpo.
+        __m256d load4(const double* p) { return _mm256_loadu_pd(p); }
+        __m256d load4(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+
+        // Mascaras de carril para los bits 0-3 y 4-7 de un byte de validez.
+        struct byte_mask {
+            __m256d lo;
+            __m256d hi;
+
+            explicit byte_mask(std::uint8_t b) {
+                const __m256i sel_lo = _mm256_setr_epi64x(1, 2, 4, 8);
+                const __m256i sel_hi = _mm256_setr_epi64x(16, 32, 64, 128);
+                const __m256i v = _mm256_set1_epi64x(b);
+                lo = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(v, sel_lo), sel_lo));
+                hi = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(v, sel_hi), sel_hi));
+            }
+        };
+
+        template<typename T>
+        weighted_sums weighted_sum_impl(const T* x, const T* w, std::size_t n) {
+            __m256d sw0 = _mm256_setzero_pd(), sw1 = _mm256_setzero_pd();
+            __m256d sx0 = _mm256_setzero_pd(), sx1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256d w0 = load4(w + i), w1 = load4(w + i + 4);
+                sw0 = _mm256_add_pd(sw0, w0);
+                sw1 = _mm256_add_pd(sw1, w1);
+                sx0 = _mm256_fmadd_pd(w0, load4(x + i), sx0);
+                sx1 = _mm256_fmadd_pd(w1, load4(x + i + 4), sx1);
+            }
+            weighted_sums r = tail::weighted_sum(x + i, w + i, n - i);
+            r.weight += hsum(_mm256_add_pd(sw0, sw1));
+            r.sum += hsum(_mm256_add_pd(sx0, sx1));
+            return r;
+        }
+
+        template<typename T>
+        double weighted_sq_dev_impl(const T* x, const T* w, std::size_t n, double mu) {
+            __m256d m = _mm256_set1_pd(mu);
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256d d0 = _mm256_sub_pd(load4(x + i), m);
+                __m256d d1 = _mm256_sub_pd(load4(x + i + 4), m);
+                a0 = _mm256_fmadd_pd(_mm256_mul_pd(load4(w + i), d0), d0, a0);
+                a1 = _mm256_fmadd_pd(_mm256_mul_pd(load4(w + i + 4), d1), d1, a1);
+            }
+            return hsum(_mm256_add_pd(a0, a1)) + tail::weighted_sq_dev(x + i, w + i, n - i, mu);
+        }
+
+        // AND con la mascara: las posiciones invalidas quedan en +0.0 aunque sean NaN.
+        template<typename T>
+        double masked_sum_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const byte_mask k(bits[i / 8]);
+                a0 = _mm256_add_pd(a0, _mm256_and_pd(load4(x + i), k.lo));
+                a1 = _mm256_add_pd(a1, _mm256_and_pd(load4(x + i + 4), k.hi));
+            }
+            return hsum(_mm256_add_pd(a0, a1)) + tail::masked_sum(x + i, bits + i / 8, n - i);
+        }
+
+        template<typename T>
+        double masked_sq_dev_impl(const T* x, const std::uint8_t* bits, std::size_t n, double mu) {
+            __m256d m = _mm256_set1_pd(mu);
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const byte_mask k(bits[i / 8]);
+                __m256d d0 = _mm256_and_pd(_mm256_sub_pd(load4(x + i), m), k.lo);
+                __m256d d1 = _mm256_and_pd(_mm256_sub_pd(load4(x + i + 4), m), k.hi);
+                a0 = _mm256_fmadd_pd(d0, d0, a0);
+                a1 = _mm256_fmadd_pd(d1, d1, a1);
+            }
+            return hsum(_mm256_add_pd(a0, a1)) + tail::masked_sq_dev(x + i, bits + i / 8, n - i, mu);
+        }
+
+        template<typename T>
+        double masked_max_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            const __m256d ninf = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+            __m256d a0 = ninf, a1 = ninf;
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const byte_mask k(bits[i / 8]);
+                a0 = _mm256_max_pd(_mm256_blendv_pd(ninf, load4(x + i), k.lo), a0);
+                a1 = _mm256_max_pd(_mm256_blendv_pd(ninf, load4(x + i + 4), k.hi), a1);
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, _mm256_max_pd(a0, a1));
+            double result = tail::masked_max(x + i, bits + i / 8, n - i);
+            for (double l : lanes) if (l > result) result = l;
+            return result;
+        }
+
+        // Las comparaciones dan -1 en los carriles que no son NaN: restarlas cuenta.
+        __m256d ordered(__m256d v) { return _mm256_cmp_pd(v, v, _CMP_ORD_Q); }
+
+        std::size_t count_lanes(__m256i c) {
+            alignas(32) std::int64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), c);
+            return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+        }
+
+        template<typename T>
+        nan_skipped nan_sum_impl(const T* x, std::size_t n) {
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            __m256i c = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256d v0 = load4(x + i), v1 = load4(x + i + 4);
+                const __m256d k0 = ordered(v0), k1 = ordered(v1);
+                a0 = _mm256_add_pd(a0, _mm256_and_pd(v0, k0));
+                a1 = _mm256_add_pd(a1, _mm256_and_pd(v1, k1));
+                c = _mm256_sub_epi64(c, _mm256_add_epi64(_mm256_castpd_si256(k0), _mm256_castpd_si256(k1)));
+            }
+            nan_skipped r = tail::nan_sum(x + i, n - i);
+            r.value += hsum(_mm256_add_pd(a0, a1));
+            r.count += count_lanes(c);
+            return r;
+        }
+
+        template<typename T>
+        double nan_sq_dev_impl(const T* x, std::size_t n, double mu) {
+            __m256d m = _mm256_set1_pd(mu);
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m256d d0 = _mm256_sub_pd(load4(x + i), m);
+                __m256d d1 = _mm256_sub_pd(load4(x + i + 4), m);
+                d0 = _mm256_and_pd(d0, ordered(d0));
+                d1 = _mm256_and_pd(d1, ordered(d1));
+                a0 = _mm256_fmadd_pd(d0, d0, a0);
+                a1 = _mm256_fmadd_pd(d1, d1, a1);
+            }
+            return hsum(_mm256_add_pd(a0, a1)) + tail::nan_sq_dev(x + i, n - i, mu);
+        }
+
+        // maxpd / minpd devuelven el segundo operando si hay un NaN: con el
+        // dato primero, un NaN deja el acumulador como estaba.
+        template<bool Max, typename T>
+        nan_skipped nan_extremum_impl(const T* x, std::size_t n) {
+            const double start = Max ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+            __m256d a0 = _mm256_set1_pd(start), a1 = a0;
+            __m256i c = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256d v0 = load4(x + i), v1 = load4(x + i + 4);
+                a0 = Max ? _mm256_max_pd(v0, a0) : _mm256_min_pd(v0, a0);
+                a1 = Max ? _mm256_max_pd(v1, a1) : _mm256_min_pd(v1, a1);
+                c = _mm256_sub_epi64(c, _mm256_add_epi64(_mm256_castpd_si256(ordered(v0)),
+                                                         _mm256_castpd_si256(ordered(v1))));
+            }
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, Max ? _mm256_max_pd(a0, a1) : _mm256_min_pd(a0, a1));
+            nan_skipped r = Max ? tail::nan_max(x + i, n - i) : tail::nan_min(x + i, n - i);
+            for (double l : lanes) if (Max ? l > r.value : l < r.value) r.value = l;
+            r.count += count_lanes(c);
+            return r;
+        }
+    }
+
+    weighted_sums weighted_sum(const double* x, const double* w, std::size_t n) { return weighted_sum_impl(x, w, n); }
+    weighted_sums weighted_sum(const float* x, const float* w, std::size_t n) { return weighted_sum_impl(x, w, n); }
+    double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu) { return weighted_sq_dev_impl(x, w, n, mu); }
+    double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu) { return weighted_sq_dev_impl(x, w, n, mu); }
+
+    double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n) { return masked_sum_impl(x, bits, n); }
+    double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n) { return masked_sum_impl(x, bits, n); }
+    double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu) { return masked_sq_dev_impl(x, bits, n, mu); }
+    double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu) { return masked_sq_dev_impl(x, bits, n, mu); }
+    double masked_max(const double* x, const std::uint8_t* bits, std::size_t n) { return masked_max_impl(x, bits, n); }
+    double masked_max(const float* x, const std::uint8_t* bits, std::size_t n) { return masked_max_impl(x, bits, n); }
+
+    nan_skipped nan_sum(const double* x, std::size_t n) { return nan_sum_impl(x, n); }
+    nan_skipped nan_sum(const float* x, std::size_t n) { return nan_sum_impl(x, n); }
+    double nan_sq_dev(const double* x, std::size_t n, double mu) { return nan_sq_dev_impl(x, n, mu); }
+    double nan_sq_dev(const float* x, std::size_t n, double mu) { return nan_sq_dev_impl(x, n, mu); }
+    nan_skipped nan_max(const double* x, std::size_t n) { return nan_extremum_impl<true>(x, n); }
+    nan_skipped nan_max(const float* x, std::size_t n) { return nan_extremum_impl<true>(x, n); }
+    nan_skipped nan_min(const double* x, std::size_t n) { return nan_extremum_impl<false>(x, n); }
+    nan_skipped nan_min(const float* x, std::size_t n) { return nan_extremum_impl<false>(x, n); }
+
+    namespace {
+        // Ocho flotantes de 16 bits en float: vcvtph2ps (F16C) para float16 y
+        // un desplazamiento de 16 bits para bfloat16.
+        __m256 load8(const float16* p) {
+            return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        }
+
+        __m256 load8(const bfloat16* p) {
+            __m256i x = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            return _mm256_castsi256_ps(_mm256_slli_epi32(x, 16));
+        }
+
+        // Vuelca un acumulador float de un bloque en el total en double.
+        __m256d add_wide(__m256d acc, __m256 x) {
+            acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+            return _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+        }
+
+        template<typename H>
+        double half_sum_impl(const H* p, std::size_t n) {
+            __m256d acc = _mm256_setzero_pd();
+            std::size_t i = 0;
+            while (i + 16 <= n) {
+                const std::size_t end = n - i < half_block ? n : i + half_block;
+                __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+                for (; i + 16 <= end; i += 16) {
+                    a0 = _mm256_add_ps(a0, load8(p + i));
+                    a1 = _mm256_add_ps(a1, load8(p + i + 8));
+                }
+                acc = add_wide(acc, _mm256_add_ps(a0, a1));
+            }
+            return hsum(acc) + tail::half_sum(p + i, n - i);
+        }
+
+        // mu se redondea a float: el error que anade es n * (mu - float(mu))^2.
+        template<typename H>
+        double half_sq_dev_impl(const H* p, std::size_t n, double mu) {
+            const __m256 m = _mm256_set1_ps(static_cast<float>(mu));
+            __m256d acc = _mm256_setzero_pd();
+            std::size_t i = 0;
+            while (i + 16 <= n) {
+                const std::size_t end = n - i < half_block ? n : i + half_block;
+                __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+                for (; i + 16 <= end; i += 16) {
+                    __m256 d0 = _mm256_sub_ps(load8(p + i), m);
+                    __m256 d1 = _mm256_sub_ps(load8(p + i + 8), m);
+                    a0 = _mm256_fmadd_ps(d0, d0, a0);
+                    a1 = _mm256_fmadd_ps(d1, d1, a1);
+                }
+                acc = add_wide(acc, _mm256_add_ps(a0, a1));
+            }
+            return hsum(acc) + tail::half_sq_dev(p + i, n - i, mu);
+        }
+
+        template<typename H>
+        float half_max_impl(const H* p, std::size_t n) {
+            if (n < 8) return tail::half_max(p, n);
+            __m256 a = _mm256_set1_ps(tail::widen(p[0]));
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) a = _mm256_max_ps(load8(p + i), a);
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, a);
+            float result = lanes[0];
+            for (float l : lanes) if (l > result) result = l;
+            for (; i < n; ++i) if (tail::widen(p[i]) > result) result = tail::widen(p[i]);
+            return result;
+        }
+
+        template<typename H>
+        float half_min_impl(const H* p, std::size_t n) {
+            if (n < 8) return tail::half_min(p, n);
+            __m256 a = _mm256_set1_ps(tail::widen(p[0]));
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) a = _mm256_min_ps(load8(p + i), a);
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, a);
+            float result = lanes[0];
+            for (float l : lanes) if (l < result) result = l;
+            for (; i < n; ++i) if (tail::widen(p[i]) < result) result = tail::widen(p[i]);
+            return result;
+        }
+    }
+
+    double sum_wide(const float16* p, std::size_t n) { return half_sum_impl(p, n); }
+    double sum_wide(const bfloat16* p, std::size_t n) { return half_sum_impl(p, n); }
+    double sq_dev(const float16* p, std::size_t n, double mu) { return half_sq_dev_impl(p, n, mu); }
+    double sq_dev(const bfloat16* p, std::size_t n, double mu) { return half_sq_dev_impl(p, n, mu); }
+    float max(const float16* p, std::size_t n) { return half_max_impl(p, n); }
+    float max(const bfloat16* p, std::size_t n) { return half_max_impl(p, n); }
+    float min(const float16* p, std::size_t n) { return half_min_impl(p, n); }
+    float min(const bfloat16* p, std::size_t n) { return half_min_impl(p, n); }
+}
@@ -0,0 +1,448 @@
+// Kernels AVX-512F. Esta TU se compila con -mavx512f y solo se llama
+// despues de comprobar el soporte en tiempo de ejecucion (dispatch.cpp).
+
+#include <immintrin.h>
+
+#include <limits>
+
+#include "kernels.h"
+#include "kernel_tail.h"
+
+namespace core_numeric::simd::avx512 {
+    double sum(const double* p, std::size_t n) {
+        __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            a0 = _mm512_add_pd(a0, _mm512_loadu_pd(p + i));
+            a1 = _mm512_add_pd(a1, _mm512_loadu_pd(p + i + 8));
+        }
+        double acc = _mm512_reduce_add_pd(_mm512_add_pd(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    float sum(const float* p, std::size_t n) {
+        __m512 a0 = _mm512_setzero_ps(), a1 = _mm512_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            a0 = _mm512_add_ps(a0, _mm512_loadu_ps(p + i));
+            a1 = _mm512_add_ps(a1, _mm512_loadu_ps(p + i + 16));
+        }
+        float acc = _mm512_reduce_add_ps(_mm512_add_ps(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    std::int32_t sum(const std::int32_t* p, std::size_t n) {
+        __m512i a = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) a = _mm512_add_epi32(a, _mm512_loadu_si512(p + i));
+        auto acc = static_cast<std::uint32_t>(_mm512_reduce_add_epi32(a));
+        for (; i < n; ++i) acc += static_cast<std::uint32_t>(p[i]);
+        return static_cast<std::int32_t>(acc);
+    }
+
+    std::int64_t sum(const std::int64_t* p, std::size_t n) {
+        __m512i a = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm512_add_epi64(a, _mm512_loadu_si512(p + i));
+        auto acc = static_cast<std::uint64_t>(_mm512_reduce_add_epi64(a));
+        for (; i < n; ++i) acc += static_cast<std::uint64_t>(p[i]);
+        return static_cast<std::int64_t>(acc);
+    }
+
+    std::int64_t sum_wide(const std::int32_t* p, std::size_t n) {
+        __m512i a0 = _mm512_setzero_si512(), a1 = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m512i x = _mm512_loadu_si512(p + i);
+            a0 = _mm512_add_epi64(a0, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(x)));
+            a1 = _mm512_add_epi64(a1, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(x, 1)));
+        }
+        std::int64_t acc = _mm512_reduce_add_epi64(_mm512_add_epi64(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    square_sum sum_sq(const std::int32_t* p, std::size_t n) {
+        const __m512i mask = _mm512_set1_epi64(0xffffffff);
+        __m512i hi = _mm512_setzero_si512(), lo = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m512i x = _mm512_loadu_si512(p + i);
+            __m512i e = _mm512_mul_epi32(x, x);
+            __m512i o = _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(x, 32));
+            hi = _mm512_add_epi64(hi, _mm512_add_epi64(_mm512_srli_epi64(e, 32), _mm512_srli_epi64(o, 32)));
+            lo = _mm512_add_epi64(lo, _mm512_add_epi64(_mm512_and_si512(e, mask), _mm512_and_si512(o, mask)));
+        }
+        square_sum r = tail::sum_sq(p + i, n - i);
+        r += {static_cast<std::uint64_t>(_mm512_reduce_add_epi64(hi)),
+              static_cast<std::uint64_t>(_mm512_reduce_add_epi64(lo))};
+        return r;
+    }
+
+    double sum_wide(const float* p, std::size_t n) {
+        __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m512 x = _mm512_loadu_ps(p + i);
+            a0 = _mm512_add_pd(a0, _mm512_cvtps_pd(_mm512_castps512_ps256(x)));
+            a1 = _mm512_add_pd(a1, _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1))));
+        }
+        double acc = _mm512_reduce_add_pd(_mm512_add_pd(a0, a1));
+        for (; i < n; ++i) acc += static_cast<double>(p[i]);
+        return acc;
+    }
+
+    double max(const double* p, std::size_t n) {
+        if (n < 8) return tail::max(p, n);
+        __m512d a = _mm512_set1_pd(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm512_max_pd(_mm512_loadu_pd(p + i), a);
+        alignas(64) double lanes[8];
+        _mm512_store_pd(lanes, a);
+        double result = lanes[0];
+        for (double l : lanes) if (l > result) result = l;
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    double min(const double* p, std::size_t n) {
+        if (n < 8) return tail::min(p, n);
+        __m512d a = _mm512_set1_pd(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm512_min_pd(_mm512_loadu_pd(p + i), a);
+        alignas(64) double lanes[8];
+        _mm512_store_pd(lanes, a);
+        double result = lanes[0];
+        for (double l : lanes) if (l < result) result = l;
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    float max(const float* p, std::size_t n) {
+        if (n < 16) return tail::max(p, n);
+        __m512 a = _mm512_set1_ps(p[0]);
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) a = _mm512_max_ps(_mm512_loadu_ps(p + i), a);
+        alignas(64) float lanes[16];
+        _mm512_store_ps(lanes, a);
+        float result = lanes[0];
+        for (float l : lanes) if (l > result) result = l;
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    float min(const float* p, std::size_t n) {
+        if (n < 16) return tail::min(p, n);
+        __m512 a = _mm512_set1_ps(p[0]);
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) a = _mm512_min_ps(_mm512_loadu_ps(p + i), a);
+        alignas(64) float lanes[16];
+        _mm512_store_ps(lanes, a);
+        float result = lanes[0];
+        for (float l : lanes) if (l < result) result = l;
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    std::int32_t max(const std::int32_t* p, std::size_t n) {
+        if (n < 16) return tail::max(p, n);
+        __m512i a = _mm512_set1_epi32(p[0]);
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) a = _mm512_max_epi32(a, _mm512_loadu_si512(p + i));
+        std::int32_t result = _mm512_reduce_max_epi32(a);
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    std::int32_t min(const std::int32_t* p, std::size_t n) {
+        if (n < 16) return tail::min(p, n);
+        __m512i a = _mm512_set1_epi32(p[0]);
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) a = _mm512_min_epi32(a, _mm512_loadu_si512(p + i));
+        std::int32_t result = _mm512_reduce_min_epi32(a);
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    std::int64_t max(const std::int64_t* p, std::size_t n) {
+        if (n < 8) return tail::max(p, n);
+        __m512i a = _mm512_set1_epi64(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm512_max_epi64(a, _mm512_loadu_si512(p + i));
+        std::int64_t result = _mm512_reduce_max_epi64(a);
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    std::int64_t min(const std::int64_t* p, std::size_t n) {
+        if (n < 8) return tail::min(p, n);
+        __m512i a = _mm512_set1_epi64(p[0]);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) a = _mm512_min_epi64(a, _mm512_loadu_si512(p + i));
+        std::int64_t result = _mm512_reduce_min_epi64(a);
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    double sq_dev(const double* p, std::size_t n, double mu) {
+        __m512d m = _mm512_set1_pd(mu);
+        __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(p + i), m);
+            __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(p + i + 8), m);
+            a0 = _mm512_fmadd_pd(d0, d0, a0);
+            a1 = _mm512_fmadd_pd(d1, d1, a1);
+        }
+        return _mm512_reduce_add_pd(_mm512_add_pd(a0, a1)) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    double sq_dev(const float* p, std::size_t n, double mu) {
+        __m512d m = _mm512_set1_pd(mu);
+        __m512d a = _mm512_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512d d = _mm512_sub_pd(_mm512_cvtps_pd(_mm256_loadu_ps(p + i)), m);
+            a = _mm512_fmadd_pd(d, d, a);
+        }
+        return _mm512_reduce_add_pd(a) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    double sq_dev(const std::int32_t* p, std::size_t n, double mu) {
+        __m512d m = _mm512_set1_pd(mu);
+        __m512d a = _mm512_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m512d d = _mm512_sub_pd(_mm512_cvtepi32_pd(x), m);
+            a = _mm512_fmadd_pd(d, d, a);
+        }
+        return _mm512_reduce_add_pd(a) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    namespace {
+        // Ocho elementos en double: los kernels de pesos y mascaras comparten el cuerpo.
+        __m512d load8(const double* p) { return _mm512_loadu_pd(p); }
+        __m512d load8(const float* p) { return _mm512_cvtps_pd(_mm256_loadu_ps(p)); }
+
+        template<typename T>
+        weighted_sums weighted_sum_impl(const T* x, const T* w, std::size_t n) {
+            __m512d sw = _mm512_setzero_pd(), swx = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m512d wi = load8(w + i);
+                sw = _mm512_add_pd(sw, wi);
+                swx = _mm512_fmadd_pd(wi, load8(x + i), swx);
+            }
+            weighted_sums r = tail::weighted_sum(x + i, w + i, n - i);
+            r.weight += _mm512_reduce_add_pd(sw);
+            r.sum += _mm512_reduce_add_pd(swx);
+            return r;
+        }
+
+        template<typename T>
+        double weighted_sq_dev_impl(const T* x, const T* w, std::size_t n, double mu) {
+            __m512d m = _mm512_set1_pd(mu);
+            __m512d a = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m512d d = _mm512_sub_pd(load8(x + i), m);
+                a = _mm512_fmadd_pd(_mm512_mul_pd(load8(w + i), d), d, a);
+            }
+            return _mm512_reduce_add_pd(a) + tail::weighted_sq_dev(x + i, w + i, n - i, mu);
+        }
+
+        // Un byte de la mascara es directamente la mascara de 8 carriles.
+        template<typename T>
+        double masked_sum_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            __m512d a = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) a = _mm512_mask_add_pd(a, bits[i / 8], a, load8(x + i));
+            return _mm512_reduce_add_pd(a) + tail::masked_sum(x + i, bits + i / 8, n - i);
+        }
+
+        template<typename T>
+        double masked_sq_dev_impl(const T* x, const std::uint8_t* bits, std::size_t n, double mu) {
+            __m512d m = _mm512_set1_pd(mu);
+            __m512d a = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m512d d = _mm512_maskz_sub_pd(bits[i / 8], load8(x + i), m);
+                a = _mm512_fmadd_pd(d, d, a);
+            }
+            return _mm512_reduce_add_pd(a) + tail::masked_sq_dev(x + i, bits + i / 8, n - i, mu);
+        }
+
+        template<typename T>
+        double masked_max_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            __m512d a = _mm512_set1_pd(-std::numeric_limits<double>::infinity());
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) a = _mm512_mask_max_pd(a, bits[i / 8], a, load8(x + i));
+            const double t = tail::masked_max(x + i, bits + i / 8, n - i);
+            const double v = _mm512_reduce_max_pd(a);
+            return t > v ? t : v;
+        }
+
+        // _CMP_ORD_Q es cierto en los carriles que no son NaN; el conteo va
+        // en un vector de enteros de 64 bits.
+        template<typename T>
+        nan_skipped nan_sum_impl(const T* x, std::size_t n) {
+            const __m512i one = _mm512_set1_epi64(1);
+            __m512d a = _mm512_setzero_pd();
+            __m512i c = _mm512_setzero_si512();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m512d v = load8(x + i);
+                const __mmask8 ok = _mm512_cmp_pd_mask(v, v, _CMP_ORD_Q);
+                a = _mm512_mask_add_pd(a, ok, a, v);
+                c = _mm512_mask_add_epi64(c, ok, c, one);
+            }
+            nan_skipped r = tail::nan_sum(x + i, n - i);
+            r.value += _mm512_reduce_add_pd(a);
+            r.count += static_cast<std::size_t>(_mm512_reduce_add_epi64(c));
+            return r;
+        }
+
+        template<typename T>
+        double nan_sq_dev_impl(const T* x, std::size_t n, double mu) {
+            __m512d m = _mm512_set1_pd(mu);
+            __m512d a = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m512d v = load8(x + i);
+                const __m512d d = _mm512_sub_pd(v, m);
+                a = _mm512_mask3_fmadd_pd(d, d, a, _mm512_cmp_pd_mask(v, v, _CMP_ORD_Q));
+            }
+            return _mm512_reduce_add_pd(a) + tail::nan_sq_dev(x + i, n - i, mu);
+        }
+
+        template<bool Max, typename T>
+        nan_skipped nan_extremum_impl(const T* x, std::size_t n) {
+            const __m512i one = _mm512_set1_epi64(1);
+            const double start = Max ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+            __m512d a = _mm512_set1_pd(start);
+            __m512i c = _mm512_setzero_si512();
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m512d v = load8(x + i);
+                const __mmask8 ok = _mm512_cmp_pd_mask(v, v, _CMP_ORD_Q);
+                a = Max ? _mm512_mask_max_pd(a, ok, a, v) : _mm512_mask_min_pd(a, ok, a, v);
+                c = _mm512_mask_add_epi64(c, ok, c, one);
+            }
+            nan_skipped r = Max ? tail::nan_max(x + i, n - i) : tail::nan_min(x + i, n - i);
+            const double v = Max ? _mm512_reduce_max_pd(a) : _mm512_reduce_min_pd(a);
+            if (Max ? v > r.value : v < r.value) r.value = v;
+            r.count += static_cast<std::size_t>(_mm512_reduce_add_epi64(c));
+            return r;
+        }
+    }
+
+    weighted_sums weighted_sum(const double* x, const double* w, std::size_t n) { return weighted_sum_impl(x, w, n); }
+    weighted_sums weighted_sum(const float* x, const float* w, std::size_t n) { return weighted_sum_impl(x, w, n); }
+    double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu) { return weighted_sq_dev_impl(x, w, n, mu); }
+    double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu) { return weighted_sq_dev_impl(x, w, n, mu); }
+
+    double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n) { return masked_sum_impl(x, bits, n); }
+    double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n) { return masked_sum_impl(x, bits, n); }
+    double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu) { return masked_sq_dev_impl(x, bits, n, mu); }
+    double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu) { return masked_sq_dev_impl(x, bits, n, mu); }
+    double masked_max(const double* x, const std::uint8_t* bits, std::size_t n) { return masked_max_impl(x, bits, n); }
+    double masked_max(const float* x, const std::uint8_t* bits, std::size_t n) { return masked_max_impl(x, bits, n); }
+
+    nan_skipped nan_sum(const double* x, std::size_t n) { return nan_sum_impl(x, n); }
+    nan_skipped nan_sum(const float* x, std::size_t n) { return nan_sum_impl(x, n); }
+    double nan_sq_dev(const double* x, std::size_t n, double mu) { return nan_sq_dev_impl(x, n, mu); }
+    double nan_sq_dev(const float* x, std::size_t n, double mu) { return nan_sq_dev_impl(x, n, mu); }
+    nan_skipped nan_max(const double* x, std::size_t n) { return nan_extremum_impl<true>(x, n); }
+    nan_skipped nan_max(const float* x, std::size_t n) { return nan_extremum_impl<true>(x, n); }
+    nan_skipped nan_min(const double* x, std::size_t n) { return nan_extremum_impl<false>(x, n); }
+    nan_skipped nan_min(const float* x, std::size_t n) { return nan_extremum_impl<false>(x, n); }
+
+    namespace {
+        // Dieciseis flotantes de 16 bits en float: vcvtph2ps para float16 y un
+        // desplazamiento de 16 bits para bfloat16 (son los bits altos del float).
+        __m512 load16(const float16* p) {
+            return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        }
+
+        __m512 load16(const bfloat16* p) {
+            __m512i x = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+            return _mm512_castsi512_ps(_mm512_slli_epi32(x, 16));
+        }
+
+        // Vuelca un acumulador float de un bloque en el total en double.
+        __m512d add_wide(__m512d acc, __m512 x) {
+            acc = _mm512_add_pd(acc, _mm512_cvtps_pd(_mm512_castps512_ps256(x)));
+            return _mm512_add_pd(acc, _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x), 1))));
+        }
+
+        template<typename H>
+        double half_sum_impl(const H* p, std::size_t n) {
+            __m512d acc = _mm512_setzero_pd();
+            std::size_t i = 0;
+            while (i + 32 <= n) {
+                const std::size_t end = n - i < half_block ? n : i + half_block;
+                __m512 a0 = _mm512_setzero_ps(), a1 = _mm512_setzero_ps();
+                for (; i + 32 <= end; i += 32) {
+                    a0 = _mm512_add_ps(a0, load16(p + i));
+                    a1 = _mm512_add_ps(a1, load16(p + i + 16));
+                }
+                acc = add_wide(acc, _mm512_add_ps(a0, a1));
+            }
+            return _mm512_reduce_add_pd(acc) + tail::half_sum(p + i, n - i);
+        }
+
+        // mu se redondea a float: el error que anade es n * (mu - float(mu))^2.
+        template<typename H>
+        double half_sq_dev_impl(const H* p, std::size_t n, double mu) {
+            const __m512 m = _mm512_set1_ps(static_cast<float>(mu));
+            __m512d acc = _mm512_setzero_pd();
+            std::size_t i = 0;
+            while (i + 32 <= n) {
+                const std::size_t end = n - i < half_block ? n : i + half_block;
+                __m512 a0 = _mm512_setzero_ps(), a1 = _mm512_setzero_ps();
+                for (; i + 32 <= end; i += 32) {
+                    __m512 d0 = _mm512_sub_ps(load16(p + i), m);
+                    __m512 d1 = _mm512_sub_ps(load16(p + i + 16), m);
+                    a0 = _mm512_fmadd_ps(d0, d0, a0);
+                    a1 = _mm512_fmadd_ps(d1, d1, a1);
+                }
+                acc = add_wide(acc, _mm512_add_ps(a0, a1));
+            }
+            return _mm512_reduce_add_pd(acc) + tail::half_sq_dev(p + i, n - i, mu);
+        }
+
+        template<typename H>
+        float half_max_impl(const H* p, std::size_t n) {
+            if (n < 16) return tail::half_max(p, n);
+            __m512 a = _mm512_set1_ps(tail::widen(p[0]));
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) a = _mm512_max_ps(load16(p + i), a);
+            float result = _mm512_reduce_max_ps(a);
+            for (; i < n; ++i) if (tail::widen(p[i]) > result) result = tail::widen(p[i]);
+            return result;
+        }
+
+        template<typename H>
+        float half_min_impl(const H* p, std::size_t n) {
+            if (n < 16) return tail::half_min(p, n);
+            __m512 a = _mm512_set1_ps(tail::widen(p[0]));
+            std::size_t i = 0;
+            for (; i + 16 <= n; i += 16) a = _mm512_min_ps(load16(p + i), a);
+            float result = _mm512_reduce_min_ps(a);
+            for (; i < n; ++i) if (tail::widen(p[i]) < result) result = tail::widen(p[i]);
+            return result;
+        }
+    }
+
+    double sum_wide(const float16* p, std::size_t n) { return half_sum_impl(p, n); }
+    double sum_wide(const bfloat16* p, std::size_t n) { return half_sum_impl(p, n); }
+    double sq_dev(const float16* p, std::size_t n, double mu) { return half_sq_dev_impl(p, n, mu); }
+    double sq_dev(const bfloat16* p, std::size_t n, double mu) { return half_sq_dev_impl(p, n, mu); }
+    float max(const float16* p, std::size_t n) { return half_max_impl(p, n); }
+    float max(const bfloat16* p, std::size_t n) { return half_max_impl(p, n); }
+    float min(const float16* p, std::size_t n) { return half_min_impl(p, n); }
+    float min(const bfloat16* p, std::size_t n) { return half_min_impl(p, n); }
+}
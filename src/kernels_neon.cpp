@@ -0,0 +1,527 @@
+// Kernels NEON para aarch64, donde NEON forma parte de la base.
+
+#include <arm_neon.h>
+
+#include <limits>
+
+#include "kernels.h"
+#include "kernel_tail.h"
+
+namespace core_numeric::simd::neon {
+    double sum(const double* p, std::size_t n) {
+        float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            a0 = vaddq_f64(a0, vld1q_f64(p + i));
+            a1 = vaddq_f64(a1, vld1q_f64(p + i + 2));
+        }
+        double acc = vaddvq_f64(vaddq_f64(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    float sum(const float* p, std::size_t n) {
+        float32x4_t a0 = vdupq_n_f32(0.0f), a1 = vdupq_n_f32(0.0f);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            a0 = vaddq_f32(a0, vld1q_f32(p + i));
+            a1 = vaddq_f32(a1, vld1q_f32(p + i + 4));
+        }
+        float acc = vaddvq_f32(vaddq_f32(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    std::int32_t sum(const std::int32_t* p, std::size_t n) {
+        uint32x4_t a = vdupq_n_u32(0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+            a = vaddq_u32(a, vld1q_u32(reinterpret_cast<const std::uint32_t*>(p + i)));
+        std::uint32_t acc = vaddvq_u32(a);
+        for (; i < n; ++i) acc += static_cast<std::uint32_t>(p[i]);
+        return static_cast<std::int32_t>(acc);
+    }
+
+    std::int64_t sum(const std::int64_t* p, std::size_t n) {
+        uint64x2_t a = vdupq_n_u64(0);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2)
+            a = vaddq_u64(a, vld1q_u64(reinterpret_cast<const std::uint64_t*>(p + i)));
+        std::uint64_t acc = vaddvq_u64(a);
+        for (; i < n; ++i) acc += static_cast<std::uint64_t>(p[i]);
+        return static_cast<std::int64_t>(acc);
+    }
+
+    std::int64_t sum_wide(const std::int32_t* p, std::size_t n) {
+        int64x2_t a0 = vdupq_n_s64(0), a1 = vdupq_n_s64(0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            int32x4_t x = vld1q_s32(p + i);
+            a0 = vaddw_s32(a0, vget_low_s32(x));
+            a1 = vaddw_high_s32(a1, x);
+        }
+        std::int64_t acc = vaddvq_s64(vaddq_s64(a0, a1));
+        for (; i < n; ++i) acc += p[i];
+        return acc;
+    }
+
+    square_sum sum_sq(const std::int32_t* p, std::size_t n) {
+        const uint64x2_t mask = vdupq_n_u64(0xffffffff);
+        uint64x2_t hi = vdupq_n_u64(0), lo = vdupq_n_u64(0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            int32x4_t x = vld1q_s32(p + i);
+            uint64x2_t e = vreinterpretq_u64_s64(vmull_s32(vget_low_s32(x), vget_low_s32(x)));
+            uint64x2_t o = vreinterpretq_u64_s64(vmull_high_s32(x, x));
+            hi = vaddq_u64(hi, vaddq_u64(vshrq_n_u64(e, 32), vshrq_n_u64(o, 32)));
+            lo = vaddq_u64(lo, vaddq_u64(vandq_u64(e, mask), vandq_u64(o, mask)));
+        }
+        square_sum r = tail::sum_sq(p + i, n - i);
+        r += {vaddvq_u64(hi), vaddvq_u64(lo)};
+        return r;
+    }
+
+    double sum_wide(const float* p, std::size_t n) {
+        float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t x = vld1q_f32(p + i);
+            a0 = vaddq_f64(a0, vcvt_f64_f32(vget_low_f32(x)));
+            a1 = vaddq_f64(a1, vcvt_high_f64_f32(x));
+        }
+        double acc = vaddvq_f64(vaddq_f64(a0, a1));
+        for (; i < n; ++i) acc += static_cast<double>(p[i]);
+        return acc;
+    }
+
+    // vmaxq propaga NaN, por eso se compara y selecciona como el lazo escalar.
+    double max(const double* p, std::size_t n) {
+        if (n < 2) return tail::max(p, n);
+        float64x2_t a = vdupq_n_f64(p[0]);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            float64x2_t x = vld1q_f64(p + i);
+            a = vbslq_f64(vcgtq_f64(x, a), x, a);
+        }
+        double lanes[2];
+        vst1q_f64(lanes, a);
+        double result = tail::max(lanes, 2);
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    double min(const double* p, std::size_t n) {
+        if (n < 2) return tail::min(p, n);
+        float64x2_t a = vdupq_n_f64(p[0]);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            float64x2_t x = vld1q_f64(p + i);
+            a = vbslq_f64(vcltq_f64(x, a), x, a);
+        }
+        double lanes[2];
+        vst1q_f64(lanes, a);
+        double result = tail::min(lanes, 2);
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    float max(const float* p, std::size_t n) {
+        if (n < 4) return tail::max(p, n);
+        float32x4_t a = vdupq_n_f32(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t x = vld1q_f32(p + i);
+            a = vbslq_f32(vcgtq_f32(x, a), x, a);
+        }
+        float lanes[4];
+        vst1q_f32(lanes, a);
+        float result = tail::max(lanes, 4);
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    float min(const float* p, std::size_t n) {
+        if (n < 4) return tail::min(p, n);
+        float32x4_t a = vdupq_n_f32(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t x = vld1q_f32(p + i);
+            a = vbslq_f32(vcltq_f32(x, a), x, a);
+        }
+        float lanes[4];
+        vst1q_f32(lanes, a);
+        float result = tail::min(lanes, 4);
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    std::int32_t max(const std::int32_t* p, std::size_t n) {
+        if (n < 4) return tail::max(p, n);
+        int32x4_t a = vdupq_n_s32(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) a = vmaxq_s32(a, vld1q_s32(p + i));
+        std::int32_t result = vmaxvq_s32(a);
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    std::int32_t min(const std::int32_t* p, std::size_t n) {
+        if (n < 4) return tail::min(p, n);
+        int32x4_t a = vdupq_n_s32(p[0]);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) a = vminq_s32(a, vld1q_s32(p + i));
+        std::int32_t result = vminvq_s32(a);
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    std::int64_t max(const std::int64_t* p, std::size_t n) {
+        if (n < 2) return tail::max(p, n);
+        int64x2_t a = vdupq_n_s64(p[0]);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            int64x2_t x = vld1q_s64(p + i);
+            a = vbslq_s64(vcgtq_s64(x, a), x, a);
+        }
+        std::int64_t lanes[2];
+        vst1q_s64(lanes, a);
+        std::int64_t result = tail::max(lanes, 2);
+        for (; i < n; ++i) if (p[i] > result) result = p[i];
+        return result;
+    }
+
+    std::int64_t min(const std::int64_t* p, std::size_t n) {
+        if (n < 2) return tail::min(p, n);
+        int64x2_t a = vdupq_n_s64(p[0]);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            int64x2_t x = vld1q_s64(p + i);
+            a = vbslq_s64(vcltq_s64(x, a), x, a);
+        }
+        std::int64_t lanes[2];
+        vst1q_s64(lanes, a);
+        std::int64_t result = tail::min(lanes, 2);
+        for (; i < n; ++i) if (p[i] < result) result = p[i];
+        return result;
+    }
+
+    double sq_dev(const double* p, std::size_t n, double mu) {
+        float64x2_t m = vdupq_n_f64(mu);
+        float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float64x2_t d0 = vsubq_f64(vld1q_f64(p + i), m);
+            float64x2_t d1 = vsubq_f64(vld1q_f64(p + i + 2), m);
+            a0 = vfmaq_f64(a0, d0, d0);
+            a1 = vfmaq_f64(a1, d1, d1);
+        }
+        return vaddvq_f64(vaddq_f64(a0, a1)) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    double sq_dev(const float* p, std::size_t n, double mu) {
+        float64x2_t m = vdupq_n_f64(mu);
+        float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t x = vld1q_f32(p + i);
+            float64x2_t d0 = vsubq_f64(vcvt_f64_f32(vget_low_f32(x)), m);
+            float64x2_t d1 = vsubq_f64(vcvt_high_f64_f32(x), m);
+            a0 = vfmaq_f64(a0, d0, d0);
+            a1 = vfmaq_f64(a1, d1, d1);
+        }
+        return vaddvq_f64(vaddq_f64(a0, a1)) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    double sq_dev(const std::int32_t* p, std::size_t n, double mu) {
+        float64x2_t m = vdupq_n_f64(mu);
+        float64x2_t a = vdupq_n_f64(0.0);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            float64x2_t d = vsubq_f64(vcvtq_f64_s64(vmovl_s32(vld1_s32(p + i))), m);
+            a = vfmaq_f64(a, d, d);
+        }
+        return vaddvq_f64(a) + tail::sq_dev(p + i, n - i, mu);
+    }
+
+    namespace {
+        // Dos elementos en double: los kernels de pesos y mascaras comparten el cuerpo.
+        float64x2_t load2(const double* p) { return vld1q_f64(p); }
+        float64x2_t load2(const float* p) { return vcvt_f64_f32(vld1_f32(p)); }
+
+        // Mascara de los carriles 2k y 2k + 1 de un byte de validez.
+        const std::uint64_t lane_bits[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+
+        uint64x2_t pair_mask(std::uint8_t b, int k) {
+            return vtstq_u64(vdupq_n_u64(b), vld1q_u64(lane_bits + 2 * k));
+        }
+
+        float64x2_t keep(float64x2_t v, uint64x2_t m) {
+            return vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(v), m));
+        }
+
+        template<typename T>
+        weighted_sums weighted_sum_impl(const T* x, const T* w, std::size_t n) {
+            float64x2_t sw0 = vdupq_n_f64(0.0), sw1 = vdupq_n_f64(0.0);
+            float64x2_t sx0 = vdupq_n_f64(0.0), sx1 = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                float64x2_t w0 = load2(w + i), w1 = load2(w + i + 2);
+                sw0 = vaddq_f64(sw0, w0);
+                sw1 = vaddq_f64(sw1, w1);
+                sx0 = vfmaq_f64(sx0, w0, load2(x + i));
+                sx1 = vfmaq_f64(sx1, w1, load2(x + i + 2));
+            }
+            weighted_sums r = tail::weighted_sum(x + i, w + i, n - i);
+            r.weight += vaddvq_f64(vaddq_f64(sw0, sw1));
+            r.sum += vaddvq_f64(vaddq_f64(sx0, sx1));
+            return r;
+        }
+
+        template<typename T>
+        double weighted_sq_dev_impl(const T* x, const T* w, std::size_t n, double mu) {
+            float64x2_t m = vdupq_n_f64(mu);
+            float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                float64x2_t d0 = vsubq_f64(load2(x + i), m);
+                float64x2_t d1 = vsubq_f64(load2(x + i + 2), m);
+                a0 = vfmaq_f64(a0, vmulq_f64(load2(w + i), d0), d0);
+                a1 = vfmaq_f64(a1, vmulq_f64(load2(w + i + 2), d1), d1);
+            }
+            return vaddvq_f64(vaddq_f64(a0, a1)) + tail::weighted_sq_dev(x + i, w + i, n - i, mu);
+        }
+
+        template<typename T>
+        double masked_sum_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const std::uint8_t b = bits[i / 8];
+                a0 = vaddq_f64(a0, keep(load2(x + i), pair_mask(b, 0)));
+                a1 = vaddq_f64(a1, keep(load2(x + i + 2), pair_mask(b, 1)));
+                a0 = vaddq_f64(a0, keep(load2(x + i + 4), pair_mask(b, 2)));
+                a1 = vaddq_f64(a1, keep(load2(x + i + 6), pair_mask(b, 3)));
+            }
+            return vaddvq_f64(vaddq_f64(a0, a1)) + tail::masked_sum(x + i, bits + i / 8, n - i);
+        }
+
+        template<typename T>
+        double masked_sq_dev_impl(const T* x, const std::uint8_t* bits, std::size_t n, double mu) {
+            float64x2_t m = vdupq_n_f64(mu);
+            float64x2_t a = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const std::uint8_t b = bits[i / 8];
+                for (int k = 0; k < 4; ++k) {
+                    float64x2_t d = keep(vsubq_f64(load2(x + i + 2 * k), m), pair_mask(b, k));
+                    a = vfmaq_f64(a, d, d);
+                }
+            }
+            return vaddvq_f64(a) + tail::masked_sq_dev(x + i, bits + i / 8, n - i, mu);
+        }
+
+        template<typename T>
+        double masked_max_impl(const T* x, const std::uint8_t* bits, std::size_t n) {
+            const float64x2_t ninf = vdupq_n_f64(-std::numeric_limits<double>::infinity());
+            float64x2_t a = ninf;
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const std::uint8_t b = bits[i / 8];
+                for (int k = 0; k < 4; ++k)
+                    a = vmaxq_f64(a, vbslq_f64(pair_mask(b, k), load2(x + i + 2 * k), ninf));
+            }
+            const double t = tail::masked_max(x + i, bits + i / 8, n - i);
+            const double v = vmaxvq_f64(a);
+            return t > v ? t : v;
+        }
+
+        // vceqq(v, v) es todo unos en los carriles que no son NaN.
+        uint64x2_t ordered(float64x2_t v) { return vceqq_f64(v, v); }
+
+        template<typename T>
+        nan_skipped nan_sum_impl(const T* x, std::size_t n) {
+            float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+            int64x2_t c = vdupq_n_s64(0);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const float64x2_t v0 = load2(x + i), v1 = load2(x + i + 2);
+                const uint64x2_t k0 = ordered(v0), k1 = ordered(v1);
+                a0 = vaddq_f64(a0, keep(v0, k0));
+                a1 = vaddq_f64(a1, keep(v1, k1));
+                c = vsubq_s64(c, vaddq_s64(vreinterpretq_s64_u64(k0), vreinterpretq_s64_u64(k1)));
+            }
+            nan_skipped r = tail::nan_sum(x + i, n - i);
+            r.value += vaddvq_f64(vaddq_f64(a0, a1));
+            r.count += static_cast<std::size_t>(vaddvq_s64(c));
+            return r;
+        }
+
+        template<typename T>
+        double nan_sq_dev_impl(const T* x, std::size_t n, double mu) {
+            float64x2_t m = vdupq_n_f64(mu);
+            float64x2_t a0 = vdupq_n_f64(0.0), a1 = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                float64x2_t d0 = vsubq_f64(load2(x + i), m);
+                float64x2_t d1 = vsubq_f64(load2(x + i + 2), m);
+                d0 = keep(d0, ordered(d0));
+                d1 = keep(d1, ordered(d1));
+                a0 = vfmaq_f64(a0, d0, d0);
+                a1 = vfmaq_f64(a1, d1, d1);
+            }
+            return vaddvq_f64(vaddq_f64(a0, a1)) + tail::nan_sq_dev(x + i, n - i, mu);
+        }
+
+        // vmaxq / vminq propagan NaN: los carriles NaN se sustituyen por el
+        // valor de partida antes de comparar.
+        template<bool Max, typename T>
+        nan_skipped nan_extremum_impl(const T* x, std::size_t n) {
+            const float64x2_t start = vdupq_n_f64(Max ? -std::numeric_limits<double>::infinity()
+                                                      : std::numeric_limits<double>::infinity());
+            float64x2_t a0 = start, a1 = start;
+            int64x2_t c = vdupq_n_s64(0);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const float64x2_t v0 = load2(x + i), v1 = load2(x + i + 2);
+                const uint64x2_t k0 = ordered(v0), k1 = ordered(v1);
+                const float64x2_t w0 = vbslq_f64(k0, v0, start), w1 = vbslq_f64(k1, v1, start);
+                a0 = Max ? vmaxq_f64(a0, w0) : vminq_f64(a0, w0);
+                a1 = Max ? vmaxq_f64(a1, w1) : vminq_f64(a1, w1);
+                c = vsubq_s64(c, vaddq_s64(vreinterpretq_s64_u64(k0), vreinterpretq_s64_u64(k1)));
+            }
+            nan_skipped r = Max ? tail::nan_max(x + i, n - i) : tail::nan_min(x + i, n - i);
+            const double v = Max ? vmaxvq_f64(vmaxq_f64(a0, a1)) : vminvq_f64(vminq_f64(a0, a1));
+            if (Max ? v > r.value : v < r.value) r.value = v;
+            r.count += static_cast<std::size_t>(vaddvq_s64(c));
+            return r;
+        }
+    }
+
+    weighted_sums weighted_sum(const double* x, const double* w, std::size_t n) { return weighted_sum_impl(x, w, n); }
+    weighted_sums weighted_sum(const float* x, const float* w, std::size_t n) { return weighted_sum_impl(x, w, n); }
+    double weighted_sq_dev(const double* x, const double* w, std::size_t n, double mu) { return weighted_sq_dev_impl(x, w, n, mu); }
+    double weighted_sq_dev(const float* x, const float* w, std::size_t n, double mu) { return weighted_sq_dev_impl(x, w, n, mu); }
+
+    double masked_sum(const double* x, const std::uint8_t* bits, std::size_t n) { return masked_sum_impl(x, bits, n); }
+    double masked_sum(const float* x, const std::uint8_t* bits, std::size_t n) { return masked_sum_impl(x, bits, n); }
+    double masked_sq_dev(const double* x, const std::uint8_t* bits, std::size_t n, double mu) { return masked_sq_dev_impl(x, bits, n, mu); }
+    double masked_sq_dev(const float* x, const std::uint8_t* bits, std::size_t n, double mu) { return masked_sq_dev_impl(x, bits, n, mu); }
+    double masked_max(const double* x, const std::uint8_t* bits, std::size_t n) { return masked_max_impl(x, bits, n); }
+    double masked_max(const float* x, const std::uint8_t* bits, std::size_t n) { return masked_max_impl(x, bits, n); }
+
+    nan_skipped nan_sum(const double* x, std::size_t n) { return nan_sum_impl(x, n); }
+    nan_skipped nan_sum(const float* x, std::size_t n) { return nan_sum_impl(x, n); }
+    double nan_sq_dev(const double* x, std::size_t n, double mu) { return nan_sq_dev_impl(x, n, mu); }
+    double nan_sq_dev(const float* x, std::size_t n, double mu) { return nan_sq_dev_impl(x, n, mu); }
+    nan_skipped nan_max(const double* x, std::size_t n) { return nan_extremum_impl<true>(x, n); }
+    nan_skipped nan_max(const float* x, std::size_t n) { return nan_extremum_impl<true>(x, n); }
+    nan_skipped nan_min(const double* x, std::size_t n) { return nan_extremum_impl<false>(x, n); }
+    nan_skipped nan_min(const float* x, std::size_t n) { return nan_extremum_impl<false>(x, n); }
+
+    namespace {
+        // Ocho flotantes de 16 bits en dos vectores float: fcvtl para float16 y
+        // un desplazamiento de 16 bits para bfloat16.
+        struct float_pair {
+            float32x4_t lo;
+            float32x4_t hi;
+        };
+
+        float_pair load8(const float16* p) {
+            const uint16x8_t x = vld1q_u16(reinterpret_cast<const std::uint16_t*>(p));
+            return {vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(x))),
+                    vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(x)))};
+        }
+
+        float_pair load8(const bfloat16* p) {
+            const uint16x8_t x = vld1q_u16(reinterpret_cast<const std::uint16_t*>(p));
+            return {vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(x), 16)),
+                    vreinterpretq_f32_u32(vshll_high_n_u16(x, 16))};
+        }
+
+        // Vuelca un acumulador float de un bloque en el total en double.
+        float64x2_t add_wide(float64x2_t acc, float32x4_t x) {
+            acc = vaddq_f64(acc, vcvt_f64_f32(vget_low_f32(x)));
+            return vaddq_f64(acc, vcvt_high_f64_f32(x));
+        }
+
+        template<typename H>
+        double half_sum_impl(const H* p, std::size_t n) {
+            float64x2_t acc = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            while (i + 8 <= n) {
+                const std::size_t end = n - i < half_block ? n : i + half_block;
+                float32x4_t a0 = vdupq_n_f32(0.0f), a1 = vdupq_n_f32(0.0f);
+                for (; i + 8 <= end; i += 8) {
+                    const float_pair x = load8(p + i);
+                    a0 = vaddq_f32(a0, x.lo);
+                    a1 = vaddq_f32(a1, x.hi);
+                }
+                acc = add_wide(acc, vaddq_f32(a0, a1));
+            }
+            return vaddvq_f64(acc) + tail::half_sum(p + i, n - i);
+        }
+
+        // mu se redondea a float: el error que anade es n * (mu - float(mu))^2.
+        template<typename H>
+        double half_sq_dev_impl(const H* p, std::size_t n, double mu) {
+            const float32x4_t m = vdupq_n_f32(static_cast<float>(mu));
+            float64x2_t acc = vdupq_n_f64(0.0);
+            std::size_t i = 0;
+            while (i + 8 <= n) {
+                const std::size_t end = n - i < half_block ? n : i + half_block;
+                float32x4_t a0 = vdupq_n_f32(0.0f), a1 = vdupq_n_f32(0.0f);
+                for (; i + 8 <= end; i += 8) {
+                    const float_pair x = load8(p + i);
+                    const float32x4_t d0 = vsubq_f32(x.lo, m), d1 = vsubq_f32(x.hi, m);
+                    a0 = vfmaq_f32(a0, d0, d0);
+                    a1 = vfmaq_f32(a1, d1, d1);
+                }
+                acc = add_wide(acc, vaddq_f32(a0, a1));
+            }
+            return vaddvq_f64(acc) + tail::half_sq_dev(p + i, n - i, mu);
+        }
+
+        template<typename H>
+        float half_max_impl(const H* p, std::size_t n) {
+            if (n < 8) return tail::half_max(p, n);
+            float32x4_t a = vdupq_n_f32(tail::widen(p[0]));
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const float_pair x = load8(p + i);
+                a = vbslq_f32(vcgtq_f32(x.lo, a), x.lo, a);
+                a = vbslq_f32(vcgtq_f32(x.hi, a), x.hi, a);
+            }
+            float lanes[4];
+            vst1q_f32(lanes, a);
+            float result = tail::max(lanes, 4);
+            for (; i < n; ++i) if (tail::widen(p[i]) > result) result = tail::widen(p[i]);
+            return result;
+        }
+
+        template<typename H>
+        float half_min_impl(const H* p, std::size_t n) {
+            if (n < 8) return tail::half_min(p, n);
+            float32x4_t a = vdupq_n_f32(tail::widen(p[0]));
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const float_pair x = load8(p + i);
+                a = vbslq_f32(vcltq_f32(x.lo, a), x.lo, a);
+                a = vbslq_f32(vcltq_f32(x.hi, a), x.hi, a);
+            }
+            float lanes[4];
+            vst1q_f32(lanes, a);
+            float result = tail::min(lanes, 4);
+            for (; i < n; ++i) if (tail::widen(p[i]) < result) result = tail::widen(p[i]);
+            return result;
+        }
+    }
+
+    double sum_wide(const float16* p, std::size_t n) { return half_sum_impl(p, n); }
+    double sum_wide(const bfloat16* p, std::size_t n) { return half_sum_impl(p, n); }
+    double sq_dev(const float16* p, std::size_t n, double mu) { return half_sq_dev_impl(p, n, mu); }
+    double sq_dev(const bfloat16* p, std::size_t n, double mu) { return half_sq_dev_impl(p, n, mu); }
+    float max(const float16* p, std::size_t n) { return half_max_impl(p, n); }
+    float max(const bfloat16* p, std::size_t n) { return half_max_impl(p, n); }
+    float min(const float16* p, std::size_t n) { return half_min_impl(p, n); }
+    float min(const bfloat16* p, std::size_t n) { return half_min_impl(p, n); }
+}
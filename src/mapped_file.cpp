@@ -0,0 +1,123 @@
+#include "core_numeric/mapped_column.h"
+
+#include <system_error>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace core_numeric {
+
+#if defined(_WIN32)
+
+    namespace {
+        [[noreturn]] void throw_last_error(const std::string& what) {
+            throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what);
+        }
+    }
+
+    mapped_file::mapped_file(const std::string& path, options opts) {
+        const DWORD flags = opts.pattern == access::sequential ? FILE_FLAG_SEQUENTIAL_SCAN :
+                            opts.pattern == access::random     ? FILE_FLAG_RANDOM_ACCESS : 0;
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | flags, nullptr);
+        if (file == INVALID_HANDLE_VALUE) throw_last_error("mapped_file: cannot open " + path);
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            throw_last_error("mapped_file: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0) {
+            CloseHandle(file);
+            return;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) throw_last_error("mapped_file: cannot map " + path);
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            throw_last_error("mapped_file: cannot map " + path);
+        }
+        data_ = static_cast<const std::byte*>(view);
+        handle_ = mapping;
+
+        if (opts.populate) {
+            WIN32_MEMORY_RANGE_ENTRY range{view, size_};
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        }
+    }
+
+    mapped_file::~mapped_file() {
+        if (data_) UnmapViewOfFile(data_);
+        if (handle_) CloseHandle(static_cast<HANDLE>(handle_));
+    }
+
+#else
+
+    namespace {
+        [[noreturn]] void throw_errno(const std::string& what) {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+    }
+
+    mapped_file::mapped_file(const std::string& path, options opts) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) throw_errno("mapped_file: cannot open " + path);
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            errno = err;
+            throw_errno("mapped_file: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0) {
+            ::close(fd);
+            return;
+        }
+
+        int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+        if (opts.populate) flags |= MAP_POPULATE;
+#endif
+        void* p = ::mmap(nullptr, size_, PROT_READ, flags, fd, 0);
+        const int err = errno;
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            size_ = 0;
+            errno = err;
+            throw_errno("mapped_file: cannot map " + path);
+        }
+        data_ = static_cast<const std::byte*>(p);
+
+        // Las pistas son opcionales: si el kernel no las acepta no es un error.
+        const int advice = opts.pattern == access::sequential ? MADV_SEQUENTIAL :
+                           opts.pattern == access::random     ? MADV_RANDOM : MADV_NORMAL;
+        ::madvise(p, size_, advice);
+#if defined(MADV_HUGEPAGE)
+        if (opts.huge_pages) ::madvise(p, size_, MADV_HUGEPAGE);
+#endif
+#if defined(MADV_WILLNEED)
+        if (opts.populate) ::madvise(p, size_, MADV_WILLNEED);
+#endif
+    }
+
+    mapped_file::~mapped_file() {
+        if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+
+#endif
+}
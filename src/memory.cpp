@@ -0,0 +1,27 @@
+#include "core_numeric/memory.h"
+
+#include <cstddef>
+
+namespace core_numeric {
+
+    namespace {
+        std::pmr::memory_resource* default_pool() noexcept {
+            // Bloques de hasta 1 MiB se reciclan (buffers de lectura incluidos).
+            thread_local std::pmr::unsynchronized_pool_resource pool(
+                std::pmr::pool_options{0, std::size_t{1} << 20});
+            return &pool;
+        }
+
+        thread_local std::pmr::memory_resource* current = nullptr;
+    }
+
+    std::pmr::memory_resource* scratch_resource() noexcept {
+        return current ? current : default_pool();
+    }
+
+    std::pmr::memory_resource* set_scratch_resource(std::pmr::memory_resource* resource) noexcept {
+        std::pmr::memory_resource* previous = current;
+        current = resource;
+        return previous;
+    }
+}
@@ -0,0 +1,122 @@
+#include "core_numeric/metrics.h"
+
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace core_numeric::metrics {
+
+    namespace {
+        struct entry {
+            sample labels;
+            detail::site counters;
+        };
+
+        struct registry {
+            std::mutex mutex;
+            std::deque<entry> entries; // direcciones estables para los site&
+            std::map<std::tuple<std::string, std::string, std::string, std::string>, detail::site*> index;
+        };
+
+        registry& the_registry() {
+            static registry r;
+            return r;
+        }
+
+        std::string label_set(const sample& s) {
+            return "function=\"" + s.function + "\",type=\"" + s.type + "\",kernel=\"" + s.kernel +
+                   "\",policy=\"" + s.policy + "\"";
+        }
+
+        void counter(std::string& out, const char* name, const char* help, const std::vector<sample>& samples,
+                     std::uint64_t sample::*field) {
+            out += std::string("# HELP ") + name + " " + help + "\n";
+            out += std::string("# TYPE ") + name + " counter\n";
+            for (const auto& s : samples)
+                out += std::string(name) + "{" + label_set(s) + "} " + std::to_string(s.*field) + "\n";
+        }
+    }
+
+    namespace detail {
+        site& register_site(const char* function, const char* type, const char* kernel, const char* policy) {
+            auto& r = the_registry();
+            std::lock_guard lock(r.mutex);
+            auto key = std::make_tuple(std::string(function), std::string(type), std::string(kernel), std::string(policy));
+            if (auto it = r.index.find(key); it != r.index.end()) return *it->second;
+
+            auto& e = r.entries.emplace_back();
+            e.labels.function = function;
+            e.labels.type = type;
+            e.labels.kernel = kernel;
+            e.labels.policy = policy;
+            r.index.emplace(std::move(key), &e.counters);
+            return e.counters;
+        }
+    }
+
+    std::vector<sample> snapshot() {
+        auto& r = the_registry();
+        std::lock_guard lock(r.mutex);
+        std::vector<sample> out;
+        out.reserve(r.entries.size());
+        for (const auto& e : r.entries) {
+            sample s = e.labels;
+            const auto& c = e.counters;
+            s.calls = c.calls.load(std::memory_order_relaxed);
+            s.elements = c.elements.load(std::memory_order_relaxed);
+            s.bytes = c.bytes.load(std::memory_order_relaxed);
+            s.threads = c.threads.load(std::memory_order_relaxed);
+            s.latency_ns = c.latency_ns.load(std::memory_order_relaxed);
+            for (std::size_t b = 0; b < latency_buckets; ++b) s.latency[b] = c.latency[b].load(std::memory_order_relaxed);
+            out.push_back(std::move(s));
+        }
+        return out;
+    }
+
+    void reset() {
+        auto& r = the_registry();
+        std::lock_guard lock(r.mutex);
+        for (auto& e : r.entries) {
+            auto& c = e.counters;
+            c.calls.store(0, std::memory_order_relaxed);
+            c.elements.store(0, std::memory_order_relaxed);
+            c.bytes.store(0, std::memory_order_relaxed);
+            c.threads.store(0, std::memory_order_relaxed);
+            c.latency_ns.store(0, std::memory_order_relaxed);
+            for (auto& b : c.latency) b.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::string prometheus() {
+        const auto samples = snapshot();
+        std::string out;
+        if (samples.empty()) return out;
+
+        counter(out, "core_numeric_calls_total", "Calls by function, element type, kernel and policy.", samples, &sample::calls);
+        counter(out, "core_numeric_elements_total", "Elements processed.", samples, &sample::elements);
+        counter(out, "core_numeric_bytes_total", "Bytes of input read.", samples, &sample::bytes);
+        counter(out, "core_numeric_threads_total", "Sum over calls of the threads used.", samples, &sample::threads);
+
+        out += "# HELP core_numeric_call_duration_seconds Latency per call.\n";
+        out += "# TYPE core_numeric_call_duration_seconds histogram\n";
+        char le[32];
+        for (const auto& s : samples) {
+            const std::string labels = label_set(s);
+            std::uint64_t cumulative = 0;
+            for (std::size_t b = 0; b + 1 < latency_buckets; ++b) {
+                cumulative += s.latency[b];
+                std::snprintf(le, sizeof le, "%.9g", static_cast<double>(std::uint64_t{1} << (b + 6)) * 1e-9);
+                out += "core_numeric_call_duration_seconds_bucket{" + labels + ",le=\"" + le + "\"} " +
+                       std::to_string(cumulative) + "\n";
+            }
+            cumulative += s.latency[latency_buckets - 1];
+            out += "core_numeric_call_duration_seconds_bucket{" + labels + ",le=\"+Inf\"} " + std::to_string(cumulative) + "\n";
+            std::snprintf(le, sizeof le, "%.9g", static_cast<double>(s.latency_ns) * 1e-9);
+            out += "core_numeric_call_duration_seconds_sum{" + labels + "} " + le + "\n";
+            out += "core_numeric_call_duration_seconds_count{" + labels + "} " + std::to_string(cumulative) + "\n";
+        }
+        return out;
+    }
+}
@@ -0,0 +1,77 @@
+#include "core_numeric/numa.h"
+
+#include <new>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace core_numeric::numa {
+
+#if defined(__linux__)
+    namespace {
+        // Constantes de <numaif.h>, que solo instala libnuma.
+        constexpr int mpol_bind = 2;
+        constexpr int mpol_interleave = 3;
+        constexpr unsigned long mpol_f_node = 1;
+        constexpr unsigned long mpol_f_addr = 2;
+        constexpr unsigned long max_nodes = 64;
+    }
+
+    int node_count() noexcept {
+        int n = 0;
+        struct stat st;
+        while (n < static_cast<int>(max_nodes) &&
+               ::stat(("/sys/devices/system/node/node" + std::to_string(n)).c_str(), &st) == 0)
+            ++n;
+        return n ? n : 1;
+    }
+
+    int node_of(const void* p) noexcept {
+        int node = -1;
+        if (::syscall(SYS_get_mempolicy, &node, nullptr, 0UL, p, mpol_f_node | mpol_f_addr) != 0) return -1;
+        return node;
+    }
+
+    void* allocate(std::size_t bytes, placement where, int node) {
+        if (bytes == 0) return nullptr;
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) throw std::bad_alloc();
+
+        unsigned long mask = 0;
+        int mode = 0;
+        if (where == placement::interleaved) {
+            const int nodes = node_count();
+            mask = nodes >= 64 ? ~0UL : (1UL << nodes) - 1;
+            mode = mpol_interleave;
+        } else if (where == placement::bind && node >= 0 && node < static_cast<int>(max_nodes)) {
+            mask = 1UL << node;
+            mode = mpol_bind;
+        }
+        // Sin soporte NUMA en el nucleo mbind falla y queda la politica por defecto.
+        if (mode) ::syscall(SYS_mbind, p, bytes, mode, &mask, max_nodes + 1, 0U);
+        return p;
+    }
+
+    void deallocate(void* p, std::size_t bytes) noexcept {
+        if (p) ::munmap(p, bytes);
+    }
+#else
+    int node_count() noexcept { return 1; }
+
+    int node_of(const void*) noexcept { return 0; }
+
+    void* allocate(std::size_t bytes, placement, int) {
+        if (bytes == 0) return nullptr;
+        return ::operator new(bytes, std::align_val_t{64});
+    }
+
+    void deallocate(void* p, std::size_t) noexcept {
+        if (p) ::operator delete(p, std::align_val_t{64});
+    }
+#endif
+}
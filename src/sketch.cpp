@@ -0,0 +1,115 @@
+#include "core_numeric/sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace core_numeric {
+
+    ddsketch::ddsketch(double relative_accuracy, std::size_t max_bins)
+        : accuracy_(relative_accuracy), max_bins_(max_bins) {
+        if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0))
+            throw std::invalid_argument("ddsketch: relative accuracy must be in (0, 1)");
+        if (max_bins == 0) throw std::invalid_argument("ddsketch: max_bins must be positive");
+        // Un cubo de ancho w en log2 interpolado abarca como mucho un factor 1 + w.
+        const double gamma = (1.0 + relative_accuracy) / (1.0 - relative_accuracy);
+        multiplier_ = 1.0 / (gamma - 1.0);
+    }
+
+    void ddsketch::store::grow(std::int64_t i, std::uint64_t n, std::size_t max_bins) {
+        if (bins.empty()) {
+            bins.assign(1, n);
+            offset = i;
+            return;
+        }
+        const auto cap = static_cast<std::int64_t>(max_bins);
+        const std::int64_t top = offset + static_cast<std::int64_t>(bins.size()) - 1;
+
+        if (i < offset) {
+            // El rango no puede pasar de max_bins: lo que quede debajo va al cubo mas bajo permitido.
+            const std::int64_t lowest = std::max(i, top - cap + 1);
+            bins.insert(bins.begin(), static_cast<std::size_t>(offset - lowest), 0);
+            offset = lowest;
+            bins[static_cast<std::size_t>(std::max(i, lowest) - offset)] += n;
+            return;
+        }
+
+        bins.resize(static_cast<std::size_t>(i - offset + 1), 0);
+        bins.back() += n;
+        if (bins.size() > max_bins) {
+            const std::size_t drop = bins.size() - max_bins;
+            std::uint64_t folded = 0;
+            for (std::size_t k = 0; k <= drop; ++k) folded += bins[k];
+            bins.erase(bins.begin(), bins.begin() + static_cast<std::ptrdiff_t>(drop));
+            bins.front() = folded;
+            offset += static_cast<std::int64_t>(drop);
+        }
+    }
+
+    void ddsketch::store::merge(const store& other, std::size_t max_bins) {
+        // De mayor a menor: los indices altos fijan el rango y los bajos colapsan.
+        for (std::size_t k = other.bins.size(); k-- > 0;)
+            if (other.bins[k]) add(other.offset + static_cast<std::int64_t>(k), other.bins[k], max_bins);
+    }
+
+    void ddsketch::merge(const ddsketch& other) {
+        if (other.accuracy_ != accuracy_)
+            throw std::invalid_argument("ddsketch: merging sketches with different accuracy");
+        if (other.count_ == 0) return;
+        count_ += other.count_;
+        zeros_ += other.zeros_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        positive_.merge(other.positive_, max_bins_);
+        negative_.merge(other.negative_, max_bins_);
+    }
+
+    double ddsketch::lower_bound(std::int64_t i) const {
+        const double f = static_cast<double>(i) / multiplier_;
+        const double e = std::floor(f);
+        return std::ldexp(1.0 + (f - e), static_cast<int>(e));
+    }
+
+    // Media armonica de los extremos del cubo: error relativo <= (gamma - 1) / (gamma + 1) = a.
+    double ddsketch::value(std::int64_t i) const {
+        const double lo = lower_bound(i);
+        const double hi = lower_bound(i + 1);
+        return 2.0 * lo * hi / (lo + hi);
+    }
+
+    double ddsketch::quantile(double q) const {
+        if (count_ == 0) throw std::invalid_argument("ddsketch: quantile of an empty sketch");
+        if (!(q >= 0.0 && q <= 1.0)) throw std::invalid_argument("ddsketch: quantile outside [0, 1]");
+        if (q == 0.0) return min_;
+        if (q == 1.0) return max_;
+
+        const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count_ - 1));
+        std::uint64_t seen = 0;
+        double result = max_;
+        bool found = false;
+
+        // Negativos de mayor a menor magnitud, ceros y positivos en orden.
+        for (std::size_t k = negative_.bins.size(); !found && k-- > 0;) {
+            seen += negative_.bins[k];
+            if (seen > rank) {
+                result = -value(negative_.offset + static_cast<std::int64_t>(k));
+                found = true;
+            }
+        }
+        if (!found) {
+            seen += zeros_;
+            if (seen > rank) {
+                result = 0.0;
+                found = true;
+            }
+        }
+        for (std::size_t k = 0; !found && k < positive_.bins.size(); ++k) {
+            seen += positive_.bins[k];
+            if (seen > rank) {
+                result = value(positive_.offset + static_cast<std::int64_t>(k));
+                found = true;
+            }
+        }
+        return std::clamp(result, min_, max_);
+    }
+}
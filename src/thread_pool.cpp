@@ -0,0 +1,296 @@
+#include "core_numeric/thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace core_numeric {
+
+    namespace {
+        struct task {
+            thread_pool::job* j = nullptr;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+        };
+
+        // Cola de un participante: el dueno empuja y saca por atras, los
+        // ladrones toman por delante los rangos mas grandes.
+        class task_queue {
+        public:
+            bool push(const task& t) {
+                std::lock_guard lock(mutex_);
+                if (tail_ - head_ == ring_.size()) return false;
+                ring_[tail_++ % ring_.size()] = t;
+                return true;
+            }
+
+            bool pop(task& t) {
+                std::lock_guard lock(mutex_);
+                if (tail_ == head_) return false;
+                t = ring_[--tail_ % ring_.size()];
+                return true;
+            }
+
+            bool steal(task& t) {
+                std::lock_guard lock(mutex_);
+                if (tail_ == head_) return false;
+                t = ring_[head_++ % ring_.size()];
+                return true;
+            }
+
+        private:
+            std::mutex mutex_;
+            std::array<task, 256> ring_{};
+            std::size_t head_ = 0;
+            std::size_t tail_ = 0;
+        };
+
+        // CPUs en orden de nodo NUMA segun /sys; un solo nodo si no hay datos.
+        std::vector<std::pair<int, int>> cpus_by_node() {
+            std::vector<std::pair<int, int>> cpus; // (cpu, nodo)
+#if defined(__linux__)
+            for (int node = 0;; ++node) {
+                std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                if (!in) break;
+                std::string list;
+                std::getline(in, list);
+                std::size_t pos = 0;
+                while (pos < list.size()) {
+                    const std::size_t comma = std::min(list.find(',', pos), list.size());
+                    const std::string item = list.substr(pos, comma - pos);
+                    const std::size_t dash = item.find('-');
+                    const int lo = std::stoi(item);
+                    const int hi = dash == std::string::npos ? lo : std::stoi(item.substr(dash + 1));
+                    for (int c = lo; c <= hi; ++c) cpus.emplace_back(c, node);
+                    pos = comma + 1;
+                }
+            }
+#endif
+            if (cpus.empty()) {
+                const int hw = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+                for (int c = 0; c < hw; ++c) cpus.emplace_back(c, 0);
+            }
+            return cpus;
+        }
+
+        void pin_to(std::thread& t, int cpu) {
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(t.native_handle(), sizeof(set), &set);
+#else
+            (void)t;
+            (void)cpu;
+#endif
+        }
+    }
+
+    struct thread_pool::impl {
+        // Cola 0: hilos externos que llaman a parallel_for; 1..n-1: trabajadores.
+        std::vector<std::unique_ptr<task_queue>> queues;
+        std::vector<std::vector<std::size_t>> victims; // orden de robo por cola
+        std::vector<std::thread> threads;
+
+        std::vector<int> node;                          // nodo de cada cola (0: -1)
+        std::vector<int> cpu_node;                      // nodo de cada CPU del sistema
+        std::vector<std::vector<std::size_t>> workers_on; // trabajadores por nodo
+        std::vector<std::vector<std::size_t>> caller_victims; // orden de robo del llamador por nodo
+
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        std::atomic<std::size_t> queued{0};
+        bool stop = false;
+
+        // El contador sube antes de publicar la tarea: un ladron nunca lo baja primero.
+        bool push(std::size_t home, const task& t) {
+            queued.fetch_add(1, std::memory_order_release);
+            if (!queues[home]->push(t)) {
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            {
+                std::lock_guard lock(sleep_mutex);
+            }
+            wake.notify_one();
+            return true;
+        }
+
+        bool find(std::size_t home, task& t) {
+            return find_in(home, victims[home], t);
+        }
+
+        bool find_in(std::size_t home, const std::vector<std::size_t>& order, task& t) {
+            if (queues[home]->pop(t) || std::any_of(order.begin(), order.end(),
+                                                    [&](std::size_t v) { return queues[v]->steal(t); })) {
+                queued.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+            return false;
+        }
+
+        int current_node() const {
+#if defined(__linux__)
+            const int cpu = sched_getcpu();
+            if (cpu >= 0 && static_cast<std::size_t>(cpu) < cpu_node.size()) return cpu_node[cpu];
+#endif
+            return -1;
+        }
+
+        // Divide el rango dejando mitades en la cola propia y ejecuta el resto.
+        void execute(std::size_t home, task t) {
+            while (t.end - t.begin > 1) {
+                const std::size_t mid = t.begin + (t.end - t.begin) / 2;
+                if (!push(home, {t.j, mid, t.end})) break;
+                t.end = mid;
+            }
+            for (std::size_t i = t.begin; i < t.end; ++i) {
+                if (!t.j->failed.load(std::memory_order_relaxed)) {
+                    try {
+                        t.j->fn(t.j->ctx, i);
+                    } catch (...) {
+                        if (!t.j->failed.exchange(true)) t.j->error = std::current_exception();
+                    }
+                }
+            }
+            t.j->remaining.fetch_sub(t.end - t.begin, std::memory_order_acq_rel);
+        }
+
+        void worker(std::size_t id) {
+            task t;
+            for (;;) {
+                if (find(id, t)) {
+                    execute(id, t);
+                    continue;
+                }
+                std::unique_lock lock(sleep_mutex);
+                wake.wait(lock, [&] { return stop || queued.load(std::memory_order_acquire) > 0; });
+                if (stop && queued.load() == 0) return;
+            }
+        }
+    };
+
+    thread_pool::thread_pool(options opts) : impl_(std::make_unique<impl>()) {
+        auto cpus = cpus_by_node();
+        for (const auto& [cpu, nd] : cpus) {
+            if (static_cast<std::size_t>(cpu) >= impl_->cpu_node.size()) impl_->cpu_node.resize(cpu + 1, -1);
+            impl_->cpu_node[cpu] = nd;
+        }
+        if (opts.node >= 0) {
+            std::erase_if(cpus, [&](const auto& c) { return c.second != opts.node; });
+            if (cpus.empty()) throw std::invalid_argument("thread_pool: unknown NUMA node");
+            opts.pin = true;
+        }
+
+        // Por defecto, una participacion por CPU disponible (todas o las del nodo).
+        std::size_t n = opts.threads ? opts.threads
+                      : opts.node >= 0 ? cpus.size() : std::thread::hardware_concurrency();
+        if (n == 0) n = 1;
+
+        // La CPU i % cpus.size() corresponde al trabajador i; el llamador no se fija.
+        auto& node = impl_->node;
+        node.assign(n, -1);
+        for (std::size_t i = 1; i < n; ++i) node[i] = cpus[i % cpus.size()].second;
+
+        int nodes = 0;
+        for (const auto& c : cpus) nodes = std::max(nodes, c.second + 1);
+        impl_->workers_on.resize(nodes);
+        for (std::size_t i = 1; i < n; ++i) impl_->workers_on[node[i]].push_back(i);
+
+        impl_->caller_victims.resize(nodes);
+        for (int k = 0; k < nodes; ++k) {
+            auto& v = impl_->caller_victims[k];
+            for (int same = 1; same >= 0; --same)
+                for (std::size_t w = 1; w < n; ++w)
+                    if ((node[w] == k) == static_cast<bool>(same)) v.push_back(w);
+        }
+
+        impl_->queues.resize(n);
+        for (auto& q : impl_->queues) q = std::make_unique<task_queue>();
+
+        // Se roba primero a la cola externa, despues al mismo nodo y por ultimo al resto.
+        impl_->victims.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            auto& v = impl_->victims[i];
+            if (i != 0) v.push_back(0);
+            for (int same = 1; same >= 0; --same)
+                for (std::size_t k = 1; k < n; ++k) {
+                    const std::size_t w = (i + k) % n;
+                    if (w != 0 && (node[w] == node[i]) == static_cast<bool>(same)) v.push_back(w);
+                }
+        }
+
+        impl_->threads.reserve(n - 1);
+        for (std::size_t i = 1; i < n; ++i) {
+            impl_->threads.emplace_back([this, i] { impl_->worker(i); });
+            if (opts.pin) pin_to(impl_->threads.back(), cpus[i % cpus.size()].first);
+        }
+    }
+
+    thread_pool::~thread_pool() {
+        {
+            std::lock_guard lock(impl_->sleep_mutex);
+            impl_->stop = true;
+        }
+        impl_->wake.notify_all();
+        for (auto& t : impl_->threads) t.join();
+    }
+
+    std::size_t thread_pool::size() const noexcept {
+        return impl_->queues.size();
+    }
+
+    void thread_pool::run(job& j, std::size_t n) {
+        impl_->execute(0, {&j, 0, n});
+        // Mientras quedan indices pendientes el llamador roba en lugar de esperar.
+        task t;
+        while (j.remaining.load(std::memory_order_acquire) != 0) {
+            if (impl_->find(0, t)) impl_->execute(0, t);
+            else std::this_thread::yield();
+        }
+    }
+
+    int thread_pool::node_of_worker(std::size_t i) const noexcept {
+        return i < impl_->node.size() ? impl_->node[i] : -1;
+    }
+
+    void thread_pool::run_nodes(job& j, std::size_t n) {
+        // Reparto inicial: cada indice a la cola de un trabajador de su nodo.
+        std::size_t rr = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const int nd = j.where(j.where_ctx, i);
+            std::size_t q = 0;
+            if (nd >= 0 && static_cast<std::size_t>(nd) < impl_->workers_on.size() && !impl_->workers_on[nd].empty()) {
+                const auto& ws = impl_->workers_on[nd];
+                q = ws[rr++ % ws.size()];
+            }
+            if (!impl_->push(q, {&j, i, i + 1})) impl_->execute(0, {&j, i, i + 1});
+        }
+        impl_->wake.notify_all();
+
+        const int here = impl_->current_node();
+        const auto& order = here >= 0 && static_cast<std::size_t>(here) < impl_->caller_victims.size()
+                                ? impl_->caller_victims[here] : impl_->victims[0];
+        task t;
+        while (j.remaining.load(std::memory_order_acquire) != 0) {
+            if (impl_->find_in(0, order, t)) impl_->execute(0, t);
+            else std::this_thread::yield();
+        }
+    }
+
+    thread_pool& default_pool() {
+        static thread_pool pool;
+        return pool;
+    }
+}
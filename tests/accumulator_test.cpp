@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::stats;
+
+TEST(Accumulator, PushAndMerge) {
+    cn::accumulator<double, stats::mean | stats::variance | stats::max> a, b;
+    const std::vector<double> batch{1, 2};
+    a.push(std::span<const double>(batch));
+    b.push(3.0);
+    b.push(4.0);
+    a.merge(b);
+
+    EXPECT_EQ(a.count(), 4u);
+    EXPECT_DOUBLE_EQ(a.mean(), 2.5);
+    EXPECT_DOUBLE_EQ(a.variance(), 1.25);
+    EXPECT_DOUBLE_EQ(a.max(), 4.0);
+}
+
+TEST(Accumulator, EmptyMeanMatchesContainerMean) {
+    const cn::accumulator<int, stats::mean> i;
+    EXPECT_THROW((void)i.mean(), std::invalid_argument);
+    EXPECT_THROW((void)cn::mean(std::vector<int>{}), std::invalid_argument);
+
+    const cn::accumulator<double, stats::mean> d;
+    EXPECT_TRUE(std::isnan(d.mean()));
+}
+
+template<typename T>
+class AccumulatorSpan : public ::testing::Test {};
+
+using LaneTypes = ::testing::Types<double, float, std::int32_t, std::int64_t>;
+TYPED_TEST_SUITE(AccumulatorSpan, LaneTypes);
+
+// Empujar todo el bloque da exactamente lo mismo que las funciones por contenedor.
+TYPED_TEST(AccumulatorSpan, MatchesContainerFunctions) {
+    using T = TypeParam;
+    const auto v = test_data::random<T>(100001);
+    cn::accumulator<T, stats::sum | stats::mean | stats::variance | stats::min | stats::max> a;
+    a.push(std::span<const T>(v));
+
+    EXPECT_EQ(a.sum(), cn::sum(v));
+    EXPECT_EQ(a.mean(), cn::mean(v));
+    EXPECT_EQ(a.variance(), cn::variance(v));
+    EXPECT_EQ(a.max(), cn::max(v));
+}
+
+TEST(Describe, FusedQuery) {
+    const std::vector<double> v{1, 2, 3, 4};
+    const auto d = cn::describe<stats::sum, stats::mean, stats::variance, stats::max>(v);
+    EXPECT_DOUBLE_EQ(d.sum(), 10.0);
+    EXPECT_DOUBLE_EQ(d.mean(), 2.5);
+    EXPECT_DOUBLE_EQ(d.variance(), 1.25);
+    EXPECT_DOUBLE_EQ(d.max(), 4.0);
+}
+
+TEST(Describe, LargeInputAgreesWithSeparateCalls) {
+    const auto v = test_data::random<double>(1000001);
+    const auto d = cn::describe<stats::sum, stats::mean, stats::variance, stats::max>(v);
+    EXPECT_EQ(d.variance(), cn::variance(v));
+    EXPECT_EQ(d.max(), cn::max(v));
+    EXPECT_NEAR(d.sum(), cn::sum(v), 1e-6);
+    EXPECT_NEAR(d.mean(), cn::mean(v), 1e-12);
+}
+
+TEST(Describe, NonContiguousRange) {
+    const std::list<int> l{3, 9, 2, 7};
+    const auto d = cn::describe<stats::min, stats::max, stats::count>(l);
+    EXPECT_EQ(d.count(), 4u);
+    EXPECT_EQ(d.min(), 2);
+    EXPECT_EQ(d.max(), 9);
+}
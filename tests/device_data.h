@@ -0,0 +1,42 @@
+#ifndef CORE_NUMERIC_TESTS_DEVICE_DATA_H
+#define CORE_NUMERIC_TESTS_DEVICE_DATA_H
+
+#include <cstddef>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "core_numeric/gpu.h"
+
+namespace device_data {
+
+    inline bool available() {
+        int n = 0;
+        return cudaGetDeviceCount(&n) == cudaSuccess && n > 0;
+    }
+
+    // Copia de un vector del host en memoria del dispositivo.
+    template<typename T>
+    class copy {
+    public:
+        explicit copy(const std::vector<T>& host) : size_(host.size()) {
+            cudaMalloc(reinterpret_cast<void**>(&data_), (size_ ? size_ : 1) * sizeof(T));
+            cudaMemcpy(data_, host.data(), size_ * sizeof(T), cudaMemcpyHostToDevice);
+        }
+        ~copy() { cudaFree(data_); }
+
+        copy(const copy&) = delete;
+        copy& operator=(const copy&) = delete;
+
+        core_numeric::device_span<const T> span() const { return {data_, size_}; }
+
+    private:
+        T* data_ = nullptr;
+        std::size_t size_;
+    };
+}
+
+#define CORE_NUMERIC_REQUIRE_DEVICE() \
+    if (!device_data::available()) GTEST_SKIP() << "no CUDA device"
+
+#endif // CORE_NUMERIC_TESTS_DEVICE_DATA_H
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+namespace simd = cn::simd;
+
+namespace {
+    // Variantes que esta CPU puede ejecutar; scalar siempre esta.
+    std::vector<simd::isa> runnable() {
+        std::vector<simd::isa> out;
+        for (simd::isa level : {simd::isa::scalar, simd::isa::neon, simd::isa::avx2, simd::isa::avx512}) {
+            try {
+                simd::use(level);
+                out.push_back(level);
+            } catch (const std::invalid_argument&) {
+            }
+        }
+        return out;
+    }
+
+    // Restaura la variante de arranque al salir de cada prueba.
+    class restore_isa {
+    public:
+        restore_isa() : saved_(simd::active()) {}
+        ~restore_isa() { simd::use(saved_); }
+
+    private:
+        simd::isa saved_;
+    };
+}
+
+TEST(Dispatch, StartsWithTheDetectedLevel) {
+    // Sin CORE_NUMERIC_ISA, la tabla de arranque es la de detect().
+    if (std::getenv("CORE_NUMERIC_ISA") == nullptr) {
+        EXPECT_EQ(simd::active(), simd::detect());
+    }
+    EXPECT_STREQ(simd::name(simd::isa::avx2), "avx2");
+    EXPECT_STREQ(simd::name(simd::isa::scalar), "scalar");
+}
+
+TEST(Dispatch, UseSwitchesAndRejectsMissingVariants) {
+    restore_isa guard;
+    const auto levels = runnable();
+    ASSERT_FALSE(levels.empty());
+    EXPECT_EQ(levels.front(), simd::isa::scalar);
+    for (simd::isa level : levels) {
+        simd::use(level);
+        EXPECT_EQ(simd::active(), level);
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    EXPECT_THROW(simd::use(simd::isa::neon), std::invalid_argument);
+#endif
+}
+
+// Cada variante da lo mismo que el lazo escalar en todos los puntos de entrada.
+TEST(Dispatch, EveryVariantMatchesScalar) {
+    restore_isa guard;
+    for (simd::isa level : runnable()) {
+        simd::use(level);
+        for (std::size_t n : test_data::sizes) {
+            const auto d = test_data::random<double>(n, 70);
+            const auto f = test_data::random<float>(n, 71);
+            const auto i = test_data::random<std::int32_t>(n, 72);
+            const auto l = test_data::random<std::int64_t>(n, 73);
+            const auto w = test_data::random<double>(n, 74);
+            std::vector<cn::float16> h(f.begin(), f.end());
+            std::vector<std::uint8_t> bits((n + 7) / 8, 0xa5);
+            const double tol = 1e-9 * 1000 * static_cast<double>(n);
+            const char* at = simd::name(level);
+
+            EXPECT_NEAR(simd::sum(d.data(), n), simd::scalar::sum(d.data(), n), tol) << at << n;
+            EXPECT_NEAR(simd::sum_wide(f.data(), n), (simd::scalar::sum<float, double>(f.data(), n)), tol) << at << n;
+            EXPECT_EQ(simd::sum(i.data(), n), simd::scalar::sum(i.data(), n)) << at << n;
+            EXPECT_EQ(simd::sum(l.data(), n), simd::scalar::sum(l.data(), n)) << at << n;
+            EXPECT_EQ(simd::sum_wide(i.data(), n), (simd::scalar::sum<std::int32_t, std::int64_t>(i.data(), n))) << at << n;
+            EXPECT_EQ(simd::sum_sq(i.data(), n).lo, simd::scalar::sum_sq(i.data(), n).lo) << at << n;
+            EXPECT_EQ(simd::sum_sq(i.data(), n).hi, simd::scalar::sum_sq(i.data(), n).hi) << at << n;
+
+            EXPECT_EQ(simd::max(d.data(), n), simd::scalar::max(d.data(), n)) << at << n;
+            EXPECT_EQ(simd::min(f.data(), n), simd::scalar::min(f.data(), n)) << at << n;
+            EXPECT_EQ(simd::max(i.data(), n), simd::scalar::max(i.data(), n)) << at << n;
+            EXPECT_EQ(simd::min(l.data(), n), simd::scalar::min(l.data(), n)) << at << n;
+            EXPECT_EQ(static_cast<float>(simd::max(h.data(), n)), static_cast<float>(simd::scalar::max(h.data(), n))) << at << n;
+
+            const double dev = simd::scalar::sq_dev(d.data(), n, 1.0);
+            EXPECT_NEAR(simd::sq_dev(d.data(), n, 1.0), dev, 1e-12 * dev) << at << n;
+            EXPECT_NEAR(simd::sq_dev(i.data(), n, 1.0), simd::scalar::sq_dev(i.data(), n, 1.0), 1e-12 * dev) << at << n;
+            EXPECT_NEAR(simd::weighted_sum(d.data(), w.data(), n).sum, simd::scalar::weighted_sum(d.data(), w.data(), n).sum,
+                        1e-9 * 1e6 * static_cast<double>(n)) << at << n;
+            EXPECT_NEAR(simd::masked_sum(d.data(), bits.data(), n), simd::scalar::masked_sum(d.data(), bits.data(), n), tol) << at << n;
+            EXPECT_EQ(simd::nan_sum(d.data(), n).count, n) << at << n;
+            EXPECT_NEAR(simd::sum_wide(h.data(), n), (simd::scalar::sum<cn::float16, double>(h.data(), n)), tol) << at << n;
+        }
+
+        // NaN en un carril del primer bloque: el escalar lo salta.
+        std::vector<cn::float16> h(40, cn::float16(1.0f));
+        h[3] = cn::float16(std::nanf(""));
+        h[19] = cn::float16(100.0f);
+        h[25] = cn::float16(-5.0f);
+        const char* at = simd::name(level);
+        EXPECT_EQ(static_cast<float>(simd::max(h.data(), h.size())), static_cast<float>(simd::scalar::max(h.data(), h.size()))) << at;
+        EXPECT_EQ(static_cast<float>(simd::min(h.data(), h.size())), static_cast<float>(simd::scalar::min(h.data(), h.size()))) << at;
+    }
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    // p "nodos" en hilos con un buzon por par (origen, destino).
+    class mailboxes {
+    public:
+        explicit mailboxes(int size) : size_(size) {}
+
+        struct endpoint {
+            mailboxes* net;
+            int me;
+
+            int rank() const { return me; }
+            int size() const { return net->size_; }
+            void send(int peer, std::span<const std::byte> msg) { net->post(me, peer, msg); }
+            std::vector<std::byte> recv(int peer) { return net->take(peer, me); }
+        };
+
+        endpoint at(int rank) { return {this, rank}; }
+
+        std::size_t bytes_sent(int rank) {
+            std::lock_guard lock(mutex_);
+            return sent_[rank];
+        }
+
+    private:
+        void post(int from, int to, std::span<const std::byte> msg) {
+            {
+                std::lock_guard lock(mutex_);
+                boxes_[{from, to}].emplace_back(msg.begin(), msg.end());
+                sent_[from] += msg.size();
+            }
+            ready_.notify_all();
+        }
+
+        std::vector<std::byte> take(int from, int to) {
+            std::unique_lock lock(mutex_);
+            auto& box = boxes_[{from, to}];
+            ready_.wait(lock, [&] { return !box.empty(); });
+            auto msg = std::move(box.front());
+            box.pop_front();
+            return msg;
+        }
+
+        int size_;
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::map<std::pair<int, int>, std::deque<std::vector<std::byte>>> boxes_;
+        std::map<int, std::size_t> sent_;
+    };
+
+    static_assert(cn::Communicator<mailboxes::endpoint>);
+
+    // Ejecuta f(endpoint) en cada rango y devuelve los resultados por rango.
+    template<typename F>
+    auto run_ranks(mailboxes& net, int p, F f) {
+        std::vector<std::invoke_result_t<F&, mailboxes::endpoint&>> out(static_cast<std::size_t>(p));
+        std::vector<std::thread> threads;
+        for (int r = 0; r < p; ++r)
+            threads.emplace_back([&, r] {
+                auto ep = net.at(r);
+                out[static_cast<std::size_t>(r)] = f(ep);
+            });
+        for (auto& t : threads) t.join();
+        return out;
+    }
+
+    constexpr auto global_stats = cn::stats::mean | cn::stats::variance | cn::stats::max | cn::stats::quantiles;
+    using global_acc = cn::accumulator<double, global_stats>;
+
+    std::vector<double> shard(int rank) {
+        return test_data::random<double>(1000 + 137 * static_cast<std::size_t>(rank), 100 + rank);
+    }
+
+    global_acc summary(int rank) {
+        global_acc a;
+        const auto x = shard(rank);
+        a.push(std::span<const double>(x));
+        return a;
+    }
+}
+
+TEST(Distributed, AllReduceIsIdenticalOnEveryRank) {
+    for (int p : {1, 2, 3, 5, 8, 9}) {
+        mailboxes net(p);
+        const auto results = run_ranks(net, p, [](auto& comm) { return cn::all_reduce(comm, summary(comm.rank())); });
+
+        std::vector<global_acc> parts;
+        std::vector<double> all;
+        for (int r = 0; r < p; ++r) {
+            parts.push_back(summary(r));
+            const auto x = shard(r);
+            all.insert(all.end(), x.begin(), x.end());
+        }
+        const auto expected = cn::serialize(cn::merge_all(std::span<const global_acc>(parts)));
+        for (const auto& r : results) EXPECT_EQ(cn::serialize(r), expected) << p;
+
+        EXPECT_EQ(results[0].count(), all.size());
+        EXPECT_NEAR(results[0].mean(), cn::mean(all), 1e-9);
+        EXPECT_NEAR(results[0].variance(), cn::variance(all), 1e-9 * cn::variance(all));
+        EXPECT_EQ(results[0].max(), cn::max(all));
+        EXPECT_NEAR(results[0].median(), cn::describe<cn::stats::quantiles>(all).median(), 1e-9);
+    }
+}
+
+TEST(Distributed, TrafficDoesNotGrowWithData) {
+    const int p = 8;
+    std::vector<std::size_t> sent;
+    for (std::size_t n : {1000u, 100000u}) {
+        mailboxes net(p);
+        run_ranks(net, p, [n](auto& comm) {
+            const auto x = test_data::random<double>(n, 7 + comm.rank());
+            return cn::all_reduce(comm, cn::describe<cn::stats::mean, cn::stats::variance>(x)).count();
+        });
+        sent.push_back(net.bytes_sent(0) + net.bytes_sent(5));
+    }
+    EXPECT_EQ(sent[0], sent[1]);
+}
+
+TEST(Distributed, TreeReduceToAnyRoot) {
+    const int p = 6;
+    mailboxes net(p);
+    const auto results = run_ranks(net, p, [](auto& comm) {
+        return cn::tree_reduce(comm, cn::moments(shard(comm.rank())), 4);
+    });
+
+    std::vector<double> all;
+    for (int r = 0; r < p; ++r) {
+        const auto x = shard(r);
+        all.insert(all.end(), x.begin(), x.end());
+    }
+    EXPECT_EQ(results[4].count, all.size());
+    EXPECT_NEAR(cn::variance(results[4]), cn::variance(all), 1e-9 * cn::variance(all));
+    EXPECT_LT(results[5].count, all.size()); // solo su subarbol
+
+    auto comm = net.at(0);
+    EXPECT_THROW(cn::tree_reduce(comm, cn::moments(shard(0)), p), std::invalid_argument);
+}
+
+TEST(Distributed, MergeAllMatchesSingleAccumulator) {
+    const auto x = test_data::random<double>(10000, 3);
+    std::vector<cn::moments_state<double>> parts;
+    for (std::size_t i = 0; i < x.size(); i += 1250)
+        parts.push_back(cn::moments(std::span<const double>(x).subspan(i, 1250)));
+    const auto m = cn::merge_all(std::span<const cn::moments_state<double>>(parts));
+    EXPECT_EQ(m.count, x.size());
+    EXPECT_NEAR(cn::variance(m), cn::variance(x), 1e-10 * cn::variance(x));
+    EXPECT_EQ(cn::merge_all(std::span<const cn::moments_state<double>>()).count, 0u);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    template<typename F>
+    std::vector<double> materialize(std::size_t n, F f) {
+        std::vector<double> out(n);
+        for (std::size_t i = 0; i < n; ++i) out[i] = f(i);
+        return out;
+    }
+}
+
+TEST(Expr, MatchesMaterializedVector) {
+    const auto x = test_data::random<double>(10007, 1);
+    const auto y = test_data::random<double>(10007, 2);
+    const auto d = cn::square(cn::expr(x) - cn::expr(y));
+    const auto tmp = materialize(x.size(), [&](std::size_t i) { return (x[i] - y[i]) * (x[i] - y[i]); });
+
+    ASSERT_EQ(d.size(), x.size());
+    EXPECT_EQ(d[17], tmp[17]);
+    EXPECT_NEAR(cn::sum(d), cn::sum(tmp), 1e-9 * cn::sum(tmp));
+    EXPECT_NEAR(cn::mean(d), cn::mean(tmp), 1e-9 * cn::mean(tmp));
+    EXPECT_NEAR(cn::variance(d), cn::variance(tmp), 1e-9 * cn::variance(tmp));
+    EXPECT_EQ(cn::max(d), cn::max(tmp));
+    EXPECT_NEAR(cn::transform_reduce(d, [](double v) { return 2.0 * v; }), 2.0 * cn::sum(tmp), 1e-9 * cn::sum(tmp));
+}
+
+TEST(Expr, ScalarsRangesAndMapping) {
+    const std::vector<double> x{1.0, -2.0, 3.0};
+    const std::vector<double> y{4.0, 5.0, 6.0};
+    EXPECT_DOUBLE_EQ(cn::sum(2.0 * cn::expr(x) + 1.0), 7.0);
+    EXPECT_DOUBLE_EQ(cn::sum(cn::expr(x) * y), 4.0 - 10.0 + 18.0);
+    EXPECT_DOUBLE_EQ(cn::sum(cn::abs(x)), 6.0);
+    EXPECT_DOUBLE_EQ(cn::max(-cn::expr(x)), 2.0);
+    EXPECT_DOUBLE_EQ(cn::sum(cn::map(x, [](double v) { return v * 10.0; })), 20.0);
+    EXPECT_DOUBLE_EQ(cn::sum(cn::weighted(x, y)), 12.0);
+    EXPECT_DOUBLE_EQ(cn::sum(cn::expr(std::vector<double>{1.0, 2.0}) / 2.0), 1.5);
+
+    std::vector<double> seen;
+    for (double v : cn::expr(x) + 1.0) seen.push_back(v);
+    EXPECT_EQ(seen, (std::vector<double>{2.0, -1.0, 4.0}));
+
+    EXPECT_THROW(cn::expr(x) - std::vector<double>{1.0}, std::invalid_argument);
+}
+
+TEST(Expr, IntegerExpressionsStayExact) {
+    const auto a = test_data::random<int>(20000, 3);
+    const auto b = test_data::random<int>(20000, 4);
+    std::vector<int> diff(a.size());
+    for (std::size_t i = 0; i < a.size(); ++i) diff[i] = a[i] - b[i];
+
+    const auto e = cn::expr(a) - cn::expr(b);
+    EXPECT_EQ(cn::sum(e), cn::sum(diff));
+    EXPECT_EQ(cn::mean(e), cn::mean(diff));
+    EXPECT_EQ(cn::variance(e), cn::variance(diff));
+    const auto m = cn::moments(e);
+    EXPECT_EQ(m.min, cn::min(diff));
+    EXPECT_EQ(m.max, cn::max(diff));
+}
+
+TEST(Expr, MaskedSkipsEntries) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> x{1.0, nan, 3.0, nan, 5.0};
+    const auto valid = cn::masked(x, cn::expr(x) == cn::expr(x));
+    EXPECT_DOUBLE_EQ(cn::sum(valid), 9.0);
+    EXPECT_DOUBLE_EQ(cn::mean(valid), 3.0);
+    EXPECT_DOUBLE_EQ(cn::variance(valid), 8.0 / 3.0);
+    EXPECT_DOUBLE_EQ(cn::max(valid), 5.0);
+
+    std::vector<double> seen;
+    for (double v : valid) seen.push_back(v);
+    EXPECT_EQ(seen, (std::vector<double>{1.0, 3.0, 5.0}));
+
+    // Dos bloques de 512 y un NaN que abre el segundo: como max(c), solo
+    // cuenta un NaN en el primer elemento.
+    std::vector<double> w(1024, 1.0);
+    w[512] = nan;
+    w[513] = 1e9;
+    w[700] = -1e9;
+    const auto m = cn::moments(cn::expr(w) * 1.0);
+    EXPECT_EQ(cn::max(w), 1e9);
+    EXPECT_EQ(cn::max(cn::expr(w)), cn::max(w));
+    EXPECT_EQ(cn::max(cn::expr(w) * 1.0), cn::max(w));
+    EXPECT_EQ(m.max, cn::max(w));
+    EXPECT_EQ(m.min, cn::min(w));
+    EXPECT_EQ(cn::max(cn::masked(w, cn::expr(w) == cn::expr(w))), cn::max(w));
+    w[0] = nan;
+    EXPECT_TRUE(std::isnan(cn::max(cn::expr(w) * 1.0)));
+    EXPECT_TRUE(std::isnan(cn::moments(cn::expr(w) * 1.0).max));
+
+    // Mas de un bloque y mascara de bool.
+    const auto v = test_data::random<int>(5000, 5);
+    std::vector<bool> keep(v.size());
+    std::vector<int> kept;
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        keep[i] = v[i] % 3 != 0;
+        if (keep[i]) kept.push_back(v[i]);
+    }
+    EXPECT_EQ(cn::sum(cn::masked(v, keep)), cn::sum(kept));
+    EXPECT_EQ(cn::mean(cn::masked(v, keep)), cn::mean(kept));
+    EXPECT_EQ(cn::variance(cn::masked(v, keep)), cn::variance(kept));
+    EXPECT_EQ(cn::max(cn::masked(cn::expr(v), cn::expr(v) < 0)), -1);
+
+    const std::vector<bool> none(v.size(), false);
+    EXPECT_THROW(cn::max(cn::masked(v, none)), std::invalid_argument);
+    EXPECT_THROW(cn::mean(cn::masked(v, none)), std::invalid_argument);
+    EXPECT_THROW(cn::masked(v, std::vector<bool>(3)), std::invalid_argument);
+}
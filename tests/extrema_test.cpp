@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Extrema, EmptyInputThrows) {
+    const std::vector<double> empty;
+    EXPECT_THROW(cn::max(empty), std::invalid_argument);
+    EXPECT_THROW(cn::max(std::list<int>{}), std::invalid_argument);
+    EXPECT_THROW(cn::min(empty), std::invalid_argument);
+    EXPECT_THROW(cn::argmax(empty), std::invalid_argument);
+    EXPECT_THROW(cn::minmax(empty), std::invalid_argument);
+    EXPECT_TRUE(cn::top_k(empty, 3).empty());
+}
+
+TEST(Extrema, ArgmaxFirstOccurrence) {
+    EXPECT_EQ(cn::argmax(std::vector<int>{1, 7, 3, 7}), 1u);
+    EXPECT_EQ(cn::argmin(std::list<int>{4, 2, 9, 2}), 1u);
+
+    auto v = test_data::random<double>(100003);
+    v[77777] = 5000.0;
+    v[90000] = 5000.0;
+    v[12345] = -5000.0;
+    EXPECT_EQ(cn::argmax(v), 77777u);
+    EXPECT_EQ(cn::argmin(v), 12345u);
+
+    const auto par = cn::execution::par.on(4);
+    EXPECT_EQ(cn::argmax(par, v), 77777u);
+    EXPECT_EQ(cn::argmin(par, v), 12345u);
+}
+
+// Como el lazo escalar: solo cuenta un NaN en el primer elemento, tambien
+// cuando abre un bloque de L1 (2048).
+TEST(Extrema, ArgExtremeWithNaN) {
+    const std::vector<double> head{std::nan(""), 1.0, 2.0};
+    const std::list<double> head_list(head.begin(), head.end());
+    EXPECT_EQ(cn::argmax(head), 0u);
+    EXPECT_EQ(cn::argmin(head), 0u);
+    EXPECT_EQ(cn::argmax(head_list), 0u);
+    EXPECT_EQ(cn::argmin(head_list), 0u);
+
+    std::vector<double> v(5000, 1.0);
+    v[2048] = std::nan("");
+    v[4000] = 5.0;
+    v[4500] = -5.0;
+    const std::list<double> l(v.begin(), v.end());
+    EXPECT_EQ(cn::argmax(v), 4000u);
+    EXPECT_EQ(cn::argmin(v), 4500u);
+    EXPECT_EQ(cn::argmax(l), 4000u);
+    EXPECT_EQ(cn::argmin(l), 4500u);
+
+    v[3] = std::nan("");
+    auto par = cn::execution::par.on(4);
+    par.cutoff = 0;
+    par.grain = 1000;
+    EXPECT_EQ(cn::argmax(par, v), 4000u);
+    EXPECT_EQ(cn::argmin(par, v), 4500u);
+}
+
+TYPED_TEST_SUITE_P(MinMaxLayouts);
+template<typename T> class MinMaxLayouts : public ::testing::Test {};
+
+TYPED_TEST_P(MinMaxLayouts, MatchesStd) {
+    for (std::size_t n : test_data::sizes) {
+        const auto v = test_data::random<TypeParam>(n);
+        const std::list<TypeParam> l(v.begin(), v.end());
+        const auto [lo, hi] = std::minmax_element(v.begin(), v.end());
+
+        const auto a = cn::minmax(v);
+        const auto b = cn::minmax(l);
+        EXPECT_EQ(a.min, *lo);
+        EXPECT_EQ(a.max, *hi);
+        EXPECT_EQ(b.min, *lo);
+        EXPECT_EQ(b.max, *hi);
+        EXPECT_EQ(cn::min(v), *lo);
+        EXPECT_EQ(cn::argmax(v), cn::argmax(l));
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MinMaxLayouts, MatchesStd);
+using MinMaxTypes = ::testing::Types<double, float, std::int32_t, std::int64_t>;
+INSTANTIATE_TYPED_TEST_SUITE_P(AllLanes, MinMaxLayouts, MinMaxTypes);
+
+TEST(Extrema, TopKMatchesSort) {
+    const auto v = test_data::random<double>(200003);
+    auto sorted = v;
+    std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+
+    for (std::size_t k : {1u, 5u, 100u, 1000u}) {
+        const std::vector<double> expected(sorted.begin(), sorted.begin() + k);
+        EXPECT_EQ(cn::top_k(v, k), expected);
+        EXPECT_EQ(cn::top_k(std::list<double>(v.begin(), v.end()), k), expected);
+        EXPECT_EQ(cn::top_k(cn::execution::par.on(4), v, k), expected);
+    }
+
+    // Menos elementos que k y repetidos.
+    EXPECT_EQ(cn::top_k(std::vector<int>{3, 1, 3, 2}, 10), (std::vector<int>{3, 3, 2, 1}));
+    EXPECT_EQ(cn::top_k(std::vector<int>{5, 5, 5, 5}, 2), (std::vector<int>{5, 5}));
+}
+
+TEST(Extrema, ParallelMinMax) {
+    const auto v = test_data::random<std::int64_t>(300007);
+    const auto s = cn::minmax(v);
+    const auto p = cn::minmax(cn::execution::par.on(3), v);
+    EXPECT_EQ(p.min, s.min);
+    EXPECT_EQ(p.max, s.max);
+}
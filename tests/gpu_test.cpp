@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "device_data.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::execution::device;
+
+namespace {
+    // Cota documentada en gpu.h: 2 * n * eps * sum|x|.
+    template<typename T>
+    double sum_tolerance(const std::vector<T>& x) {
+        double abs = 0.0;
+        for (T v : x) abs += std::abs(static_cast<double>(v));
+        return 2.0 * static_cast<double>(x.size()) * std::numeric_limits<double>::epsilon() * abs;
+    }
+}
+
+template<typename T>
+class Gpu : public ::testing::Test {};
+
+using FloatTypes = ::testing::Types<double, float>;
+TYPED_TEST_SUITE(Gpu, FloatTypes);
+
+TYPED_TEST(Gpu, MatchesCpuWithinTolerance) {
+    CORE_NUMERIC_REQUIRE_DEVICE();
+    using T = TypeParam;
+    for (std::size_t n : test_data::sizes) {
+        const auto x = test_data::random<T>(n, 50);
+        const device_data::copy<T> d(x);
+
+        // La CPU suma float en float; la referencia es la suma ancha.
+        const double cpu_sum = cn::detail::floating_sum(x);
+        EXPECT_NEAR(static_cast<double>(cn::sum(device, d.span())), cpu_sum,
+                    sum_tolerance(x) + std::abs(cpu_sum) * std::numeric_limits<T>::epsilon()) << n;
+        EXPECT_NEAR(cn::mean(device, d.span()), cn::mean(x), sum_tolerance(x) / static_cast<double>(n)) << n;
+
+        const auto m = cn::moments(device, d.span());
+        const auto c = cn::moments(x);
+        EXPECT_EQ(m.count, c.count);
+        EXPECT_NEAR(m.mean, c.mean, sum_tolerance(x) / static_cast<double>(n)) << n;
+        EXPECT_NEAR(m.m2, c.m2, 1e-12 * c.m2 + 1e-12) << n;
+        EXPECT_EQ(m.min, c.min) << n;
+        EXPECT_EQ(m.max, c.max) << n;
+        EXPECT_NEAR(cn::variance(device, d.span(), 1), cn::variance(x, 1), 1e-12 * cn::variance(x)) << n;
+
+        EXPECT_EQ(cn::argmax(device, d.span()), cn::argmax(x)) << n;
+        EXPECT_EQ(cn::argmin(device, d.span()), cn::argmin(x)) << n;
+        EXPECT_EQ(cn::max(device, d.span()), cn::max(x)) << n;
+        EXPECT_EQ(cn::min(device, d.span()), cn::min(x)) << n;
+    }
+}
+
+TYPED_TEST(Gpu, LargeInputUsesEveryBlock) {
+    CORE_NUMERIC_REQUIRE_DEVICE();
+    using T = TypeParam;
+    const auto x = test_data::random<T>(std::size_t{1} << 24, 51);
+    const device_data::copy<T> d(x);
+    EXPECT_NEAR(cn::mean(device, d.span()), cn::mean(x), sum_tolerance(x) / static_cast<double>(x.size()));
+    EXPECT_NEAR(cn::variance(device, d.span()), cn::variance(x), 1e-10 * cn::variance(x));
+    EXPECT_EQ(cn::argmax(device.grid(7), d.span()), cn::argmax(x));
+}
+
+TEST(Gpu, TiesKeepTheFirstIndexAndResultsAreReproducible) {
+    CORE_NUMERIC_REQUIRE_DEVICE();
+    std::vector<double> x(100000, 1.0);
+    x[70000] = x[30000] = x[90000] = 5.0;
+    x[12345] = -5.0;
+    const device_data::copy<double> d(x);
+    EXPECT_EQ(cn::argmax(device, d.span()), 30000u);
+    EXPECT_EQ(cn::argmin(device, d.span()), 12345u);
+
+    const auto y = test_data::random<double>(1000003, 52);
+    const device_data::copy<double> e(y);
+    const double first = cn::sum(device, e.span());
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(cn::sum(device, e.span()), first);
+}
+
+TEST(Gpu, EmptyRange) {
+    CORE_NUMERIC_REQUIRE_DEVICE();
+    const cn::device_span<const double> empty;
+    EXPECT_EQ(cn::sum(device, empty), 0.0);
+    EXPECT_TRUE(std::isnan(cn::mean(device, empty)));
+    EXPECT_TRUE(std::isnan(cn::variance(device, empty)));
+    EXPECT_EQ(cn::moments(device, empty).count, 0u);
+    EXPECT_THROW(cn::max(device, empty), std::invalid_argument);
+    EXPECT_THROW(cn::argmin(device, empty), std::invalid_argument);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "core_numeric/gpu_reduce.cuh"
+#include "device_data.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::execution::device;
+
+namespace {
+    struct range {
+        double lo;
+        double hi;
+    };
+}
+
+TEST(GpuTransformReduce, DeviceLambdas) {
+    CORE_NUMERIC_REQUIRE_DEVICE();
+    for (std::size_t n : test_data::sizes) {
+        const auto x = test_data::random<double>(n, 60);
+        const device_data::copy<double> d(x);
+
+        const double sq = cn::transform_reduce(device, d.span(), 0.0,
+            [] __device__ (double a, double b) { return a + b; },
+            [] __device__ (double v) { return v * v; });
+        double expected = 0.0;
+        for (double v : x) expected += v * v;
+        EXPECT_NEAR(sq, expected, 2.0 * static_cast<double>(n) * std::numeric_limits<double>::epsilon() * expected) << n;
+
+        // Resultado compuesto: viaja por __shfl_down_sync en palabras de 32 bits.
+        const auto r = cn::transform_reduce(device, d.span(),
+            range{std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()},
+            [] __device__ (range a, range b) { return range{fmin(a.lo, b.lo), fmax(a.hi, b.hi)}; },
+            [] __device__ (double v) { return range{v, v}; });
+        double lo = x[0], hi = x[0];
+        for (double v : x) { lo = std::fmin(lo, v); hi = std::fmax(hi, v); }
+        EXPECT_EQ(r.lo, lo) << n;
+        EXPECT_EQ(r.hi, hi) << n;
+
+        const auto positives = cn::transform_reduce(device.grid(3), d.span(), std::size_t{0},
+            [] __device__ (std::size_t a, std::size_t b) { return a + b; },
+            [] __device__ (double v) { return static_cast<std::size_t>(v > 0.0); });
+        std::size_t count = 0;
+        for (double v : x) count += v > 0.0;
+        EXPECT_EQ(positives, count) << n;
+    }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::stats;
+
+namespace {
+    // Referencia: el std::map<clave, vector> que group_reduce sustituye.
+    template<typename K, typename Q>
+    std::map<K, std::vector<Q>> buckets(const std::vector<K>& keys, const std::vector<Q>& values) {
+        std::map<K, std::vector<Q>> out;
+        for (std::size_t i = 0; i < keys.size(); ++i) out[keys[i]].push_back(values[i]);
+        return out;
+    }
+
+    std::vector<std::int64_t> random_keys(std::size_t n, std::int64_t distinct, unsigned seed) {
+        std::mt19937_64 g(seed);
+        std::uniform_int_distribution<std::int64_t> d(0, distinct - 1);
+        std::vector<std::int64_t> k(n);
+        for (auto& x : k) x = d(g) * 7919 - 3;
+        return k;
+    }
+}
+
+TEST(GroupReduce, MatchesPerBucketReductions) {
+    for (std::size_t n : test_data::sizes) {
+        const auto keys = random_keys(n, 37, 1);
+        const auto values = test_data::random<double>(n, 2);
+        const auto t = cn::group_reduce<stats::sum, stats::mean, stats::variance, stats::min, stats::max>(keys, values);
+        const auto ref = buckets(keys, values);
+
+        ASSERT_EQ(t.size(), ref.size()) << n;
+        for (const auto& [k, xs] : ref) {
+            const auto a = t.at(k);
+            EXPECT_EQ(a.count(), xs.size());
+            EXPECT_NEAR(a.sum(), cn::sum(xs), 1e-9 * static_cast<double>(xs.size()) * 1000.0);
+            EXPECT_NEAR(a.mean(), cn::mean(xs), 1e-9);
+            EXPECT_NEAR(a.variance(), cn::variance(xs), 1e-9 * cn::variance(xs) + 1e-9);
+            EXPECT_EQ(a.min(), *std::min_element(xs.begin(), xs.end()));
+            EXPECT_EQ(a.max(), cn::max(xs));
+        }
+    }
+}
+
+TEST(GroupReduce, KeysInFirstAppearanceOrder) {
+    const std::vector<std::string> keys{"b", "a", "b", "c", "a", "b"};
+    const std::vector<int> values{1, 2, 3, 4, 5, 6};
+    const auto t = cn::group_reduce<stats::sum, stats::mean, stats::max>(keys, values);
+
+    ASSERT_EQ(t.size(), 3u);
+    EXPECT_EQ(t.keys()[0], "b");
+    EXPECT_EQ(t.keys()[1], "a");
+    EXPECT_EQ(t.keys()[2], "c");
+    EXPECT_EQ(t[0].sum(), 10);
+    EXPECT_EQ(t[0].mean(), 3);      // entero, como mean(vector<int>)
+    EXPECT_EQ(t[1].max(), 5);
+    EXPECT_EQ(t.count(2), 1u);
+    EXPECT_EQ(t.find("z"), t.npos);
+    EXPECT_THROW(t.at("z"), std::out_of_range);
+}
+
+TEST(GroupReduce, ShiftedVarianceSurvivesLargeOffsets) {
+    // sum x^2 - (sum x)^2 / n perderia todos los digitos con este desplazamiento.
+    std::vector<int> keys;
+    std::vector<double> values;
+    for (int i = 0; i < 10000; ++i) {
+        keys.push_back(i % 3);
+        values.push_back(1e9 + static_cast<double>(i % 10));
+    }
+    const auto t = cn::group_reduce<stats::variance>(keys, values);
+    for (int k = 0; k < 3; ++k) {
+        std::vector<double> xs;
+        for (std::size_t i = 0; i < keys.size(); ++i) if (keys[i] == k) xs.push_back(values[i]);
+        EXPECT_NEAR(t.at(k).variance(), cn::variance(xs), 1e-9 * cn::variance(xs));
+    }
+}
+
+TEST(GroupReduce, MergeCombinesTables) {
+    const auto keys = random_keys(5000, 100, 3);
+    const auto values = test_data::random<double>(5000, 4);
+    const std::vector<std::int64_t> k1(keys.begin(), keys.begin() + 2000), k2(keys.begin() + 2000, keys.end());
+    const std::vector<double> v1(values.begin(), values.begin() + 2000), v2(values.begin() + 2000, values.end());
+
+    auto a = cn::group_reduce<stats::mean, stats::variance, stats::max>(k1, v1);
+    a.merge(cn::group_reduce<stats::mean, stats::variance, stats::max>(k2, v2));
+    const auto whole = cn::group_reduce<stats::mean, stats::variance, stats::max>(keys, values);
+
+    ASSERT_EQ(a.size(), whole.size());
+    for (std::size_t g = 0; g < whole.size(); ++g) {
+        const auto x = a.at(whole.keys()[g]);
+        EXPECT_EQ(x.count(), whole[g].count());
+        EXPECT_NEAR(x.mean(), whole[g].mean(), 1e-9);
+        EXPECT_NEAR(x.variance(), whole[g].variance(), 1e-9 * whole[g].variance());
+        EXPECT_EQ(x.max(), whole[g].max());
+    }
+}
+
+TEST(GroupReduce, ParallelIsBitIdentical) {
+    const std::size_t n = 200003;
+    for (std::int64_t distinct : {5, 1000, 100000}) {
+        const auto keys = random_keys(n, distinct, 5);
+        const auto values = test_data::random<double>(n, 6);
+        const auto seq = cn::group_reduce<stats::sum, stats::variance, stats::min>(keys, values);
+        const auto par = cn::group_reduce<stats::sum, stats::variance, stats::min>(cn::execution::par.on(4), keys, values);
+
+        ASSERT_EQ(par.size(), seq.size()) << distinct;
+        for (std::size_t g = 0; g < seq.size(); ++g) {
+            const auto x = par.at(seq.keys()[g]);
+            EXPECT_EQ(x.count(), seq[g].count());
+            EXPECT_EQ(x.sum(), seq[g].sum());
+            EXPECT_EQ(x.variance(), seq[g].variance());
+            EXPECT_EQ(x.min(), seq[g].min());
+        }
+    }
+}
+
+TEST(GroupReduce, GenericRangesAndErrors) {
+    const std::list<int> keys{1, 2, 1, 2, 3};
+    const std::list<float> values{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    const auto t = cn::group_reduce<stats::mean>(keys, values);
+    EXPECT_DOUBLE_EQ(t.at(1).mean(), 2.0);
+    EXPECT_DOUBLE_EQ(t.at(2).mean(), 3.0);
+
+    const std::vector<int> k{1, 2};
+    const std::vector<double> v{1.0};
+    EXPECT_THROW(cn::group_reduce<stats::sum>(k, v), std::invalid_argument);
+    EXPECT_THROW(cn::group_reduce<stats::sum>(cn::execution::par.on(4), k, v), std::invalid_argument);
+    EXPECT_TRUE(cn::group_reduce<stats::sum>(std::vector<int>{}, std::vector<double>{}).empty());
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    template<typename H>
+    std::vector<H> narrow(const std::vector<double>& x) {
+        std::vector<H> out;
+        out.reserve(x.size());
+        for (double v : x) out.push_back(H(static_cast<float>(v)));
+        return out;
+    }
+
+    // Los mismos valores ya ensanchados: la referencia se calcula en double.
+    template<typename H>
+    std::vector<double> widen(const std::vector<H>& x) {
+        return std::vector<double>(x.begin(), x.end());
+    }
+
+    double abs_sum(const std::vector<double>& x) {
+        double s = 0.0;
+        for (double v : x) s += std::fabs(v);
+        return s;
+    }
+}
+
+TEST(Half, Float16RoundTripsEveryValue) {
+    for (std::uint32_t b = 0; b <= 0xffff; ++b) {
+        const auto h = cn::float16::from_bits(static_cast<std::uint16_t>(b));
+        const float f = h;
+        if (std::isnan(f)) {
+            EXPECT_TRUE(std::isnan(static_cast<float>(cn::float16(f)))) << b;
+            continue;
+        }
+        EXPECT_EQ(cn::float16(f).bits, b) << b;
+    }
+    EXPECT_EQ(cn::float16(1.0f).bits, 0x3c00);
+    EXPECT_EQ(cn::float16(-2.0f).bits, 0xc000);
+    EXPECT_EQ(cn::float16(65504.0f).bits, 0x7bff);
+    EXPECT_EQ(cn::float16(65520.0f).bits, 0x7c00);
+    EXPECT_EQ(cn::float16(std::ldexp(1.0f, -24)).bits, 0x0001);
+    EXPECT_EQ(cn::float16(1.0f + std::ldexp(1.0f, -11)).bits, 0x3c00);     // empate: al par
+    EXPECT_EQ(cn::float16(1.0f + 3 * std::ldexp(1.0f, -11)).bits, 0x3c02);
+}
+
+TEST(Half, BFloat16RoundsToNearestEven) {
+    EXPECT_EQ(cn::bfloat16(1.0f).bits, 0x3f80);
+    EXPECT_EQ(static_cast<float>(cn::bfloat16::from_bits(0xc2f7)), -123.5f);
+    EXPECT_EQ(cn::bfloat16(1.0f + std::ldexp(1.0f, -8)).bits, 0x3f80);     // empate: al par
+    EXPECT_EQ(cn::bfloat16(1.0f + 3 * std::ldexp(1.0f, -8)).bits, 0x3f82);
+    EXPECT_TRUE(std::isnan(static_cast<float>(cn::bfloat16(std::nanf("")))));
+    for (std::uint32_t b = 0; b <= 0xffff; b += 7) {
+        const auto h = cn::bfloat16::from_bits(static_cast<std::uint16_t>(b));
+        if (!std::isnan(static_cast<float>(h))) {
+            EXPECT_EQ(cn::bfloat16(static_cast<float>(h)).bits, b) << b;
+        }
+    }
+}
+
+template<typename H>
+class HalfReductions : public ::testing::Test {};
+
+using HalfTypes = ::testing::Types<cn::float16, cn::bfloat16>;
+TYPED_TEST_SUITE(HalfReductions, HalfTypes);
+
+TYPED_TEST(HalfReductions, MatchDoubleReference) {
+    using H = TypeParam;
+    for (std::size_t n : test_data::sizes) {
+        const auto x = narrow<H>(test_data::random<double>(n, 11));
+        const auto ref = widen(x);
+        const double tol = 1e-6 * abs_sum(ref);
+
+        EXPECT_NEAR(cn::sum(x), cn::sum(ref), tol) << n;
+        EXPECT_NEAR(cn::mean(x), cn::mean(ref), tol / static_cast<double>(n)) << n;
+        EXPECT_NEAR(cn::variance(x), cn::variance(ref), 1e-5 * cn::variance(ref) + 1e-9) << n;
+        EXPECT_EQ(static_cast<double>(cn::max(x)), cn::max(ref)) << n;
+
+        const auto m = cn::moments(x);
+        const auto mr = cn::moments(ref);
+        EXPECT_EQ(m.count, n);
+        EXPECT_EQ(static_cast<double>(m.min), mr.min) << n;
+        EXPECT_EQ(static_cast<double>(m.max), mr.max) << n;
+    }
+}
+
+TYPED_TEST(HalfReductions, GenericAndParallelPathsAgree) {
+    using H = TypeParam;
+    const auto x = narrow<H>(test_data::random<double>(10007, 12));
+    const std::deque<H> d(x.begin(), x.end());
+    const auto ref = widen(x);
+
+    EXPECT_NEAR(cn::mean(d), cn::mean(ref), 1e-9);
+    EXPECT_NEAR(cn::variance(d), cn::variance(ref), 1e-9 * cn::variance(ref));
+    EXPECT_EQ(static_cast<double>(cn::max(d)), cn::max(ref));
+
+    auto par = cn::execution::par.on(4);
+    par.cutoff = 0;
+    par.grain = 1000;
+    EXPECT_NEAR(cn::mean(par, x), cn::mean(ref), 1e-6);
+    EXPECT_NEAR(cn::variance(par, x), cn::variance(ref), 1e-5 * cn::variance(ref));
+    EXPECT_EQ(static_cast<double>(cn::max(par, x)), cn::max(ref));
+}
+
+// Sumar en 16 bits se estanca en cuanto el total supera 2^11 veces el
+// sumando; los kernels acumulan en float / double y no pierden nada aqui.
+TYPED_TEST(HalfReductions, AccumulatesWide) {
+    using H = TypeParam;
+    const std::size_t n = std::size_t{1} << 20;
+    const std::vector<H> x(n, H(0.1f));
+    const double v = static_cast<float>(x[0]);
+    EXPECT_NEAR(cn::mean(x), v, 1e-6 * v);
+    EXPECT_NEAR(cn::sum(x), v * static_cast<double>(n), 1e-6 * v * static_cast<double>(n));
+    EXPECT_NEAR(cn::variance(x), 0.0, 1e-9);
+}
+
+TEST(Half, SpecialValues) {
+    std::vector<cn::float16> x(100, cn::float16(1.0f));
+    x[37] = cn::float16(-std::numeric_limits<float>::infinity());
+    x[71] = cn::float16::from_bits(0x0001);
+    EXPECT_EQ(static_cast<float>(cn::moments(x).min), -std::numeric_limits<float>::infinity());
+    EXPECT_EQ(static_cast<float>(cn::max(x)), 1.0f);
+    x[37] = cn::float16(1.0f);
+    EXPECT_GT(static_cast<float>(cn::moments(x).min), 0.0f);
+}
+
+// Un NaN fuera de p[0] no cuenta, como en el lazo escalar; tambien en los
+// carriles del primer bloque de los kernels.
+TYPED_TEST(HalfReductions, MaxMinSkipNaNPastTheFirst) {
+    using H = TypeParam;
+    std::vector<H> x(40, H(1.0f));
+    x[3] = H(std::nanf(""));
+    x[19] = H(100.0f);
+    x[25] = H(-5.0f);
+    EXPECT_EQ(static_cast<float>(cn::max(x)), 100.0f);
+    EXPECT_EQ(static_cast<float>(cn::min(x)), -5.0f);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Histogram, CountsEachBin) {
+    for (std::size_t n : test_data::sizes) {
+        const auto x = test_data::random<double>(n, 9);
+        const auto h = cn::histogram_of(x, -500.0, 500.0, 10);
+
+        std::vector<std::uint64_t> expected(10, 0);
+        std::uint64_t under = 0, over = 0;
+        for (double v : x) {
+            if (v < -500.0) ++under;
+            else if (v >= 500.0) ++over;
+            else ++expected[static_cast<std::size_t>((v + 500.0) / 100.0)];
+        }
+        EXPECT_EQ(std::vector<std::uint64_t>(h.counts().begin(), h.counts().end()), expected) << n;
+        EXPECT_EQ(h.underflow(), under);
+        EXPECT_EQ(h.overflow(), over);
+        EXPECT_EQ(h.count(), n);
+    }
+}
+
+TEST(Histogram, EdgesAndSpecialValues) {
+    const std::vector<double> x{0.0, 0.999999, 1.0, 3.9999999999999996, 4.0, -0.0,
+                                std::numeric_limits<double>::quiet_NaN(),
+                                std::numeric_limits<double>::infinity()};
+    const auto h = cn::histogram_of(x, 0.0, 4.0, 4);
+    EXPECT_EQ(h[0], 3u);
+    EXPECT_EQ(h[1], 1u);
+    EXPECT_EQ(h[3], 1u);
+    EXPECT_EQ(h.overflow(), 2u);
+    EXPECT_EQ(h.count(), 7u); // sin el NaN
+    EXPECT_DOUBLE_EQ(h.lower(2), 2.0);
+    EXPECT_DOUBLE_EQ(h.width(), 1.0);
+
+    EXPECT_THROW(cn::histogram(0.0, 1.0, 0), std::invalid_argument);
+    EXPECT_THROW(cn::histogram(1.0, 1.0, 4), std::invalid_argument);
+}
+
+TEST(Histogram, MergeAndParallelMatchSerial) {
+    const auto x = test_data::random<int>(300001, 10);
+    const auto serial = cn::histogram_of(x, -1000.0, 1001.0, 2001);
+    const auto par = cn::histogram_of(cn::execution::par.on(4), x, -1000.0, 1001.0, 2001);
+    EXPECT_TRUE(std::equal(serial.counts().begin(), serial.counts().end(), par.counts().begin()));
+
+    const std::list<int> l(x.begin(), x.begin() + 1000);
+    auto a = cn::histogram_of(l, -1000.0, 1001.0, 2001);
+    a.merge(cn::histogram_of(std::vector<int>(x.begin() + 1000, x.end()), -1000.0, 1001.0, 2001));
+    EXPECT_TRUE(std::equal(serial.counts().begin(), serial.counts().end(), a.counts().begin()));
+    EXPECT_THROW(a.merge(cn::histogram(0.0, 1.0, 2001)), std::invalid_argument);
+}
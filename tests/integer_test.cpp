@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(IntegerSum, WidensInsteadOfOverflowing) {
+    const std::vector<int> v(1000, std::numeric_limits<int>::max());
+    const std::list<int> l(v.begin(), v.end());
+    const std::int64_t expected = 1000LL * std::numeric_limits<int>::max();
+
+    static_assert(std::is_same_v<decltype(cn::sum(v)), std::int64_t>);
+    EXPECT_EQ(cn::sum(v), expected);
+    EXPECT_EQ(cn::sum(l), expected);
+    EXPECT_EQ(cn::mean(v), std::numeric_limits<int>::max());
+    EXPECT_EQ(cn::sum(cn::execution::par.on(4), v), expected);
+
+    const std::vector<unsigned> u(10, 4000000000u);
+    EXPECT_EQ(cn::sum(u), 40000000000ULL);
+}
+
+TEST(IntegerSum, Policies) {
+    const std::vector<int> v{std::numeric_limits<int>::max(), 1, 1};
+    EXPECT_EQ(cn::sum<cn::integer::wrap>(v), std::numeric_limits<int>::min() + 1);
+    EXPECT_EQ(cn::sum<cn::integer::widen>(v), std::int64_t{std::numeric_limits<int>::max()} + 2);
+    EXPECT_EQ(cn::sum<cn::integer::saturate>(v), std::numeric_limits<int>::max());
+    EXPECT_THROW(cn::sum<cn::integer::checked>(v), std::overflow_error);
+
+    const std::vector<int> n{std::numeric_limits<int>::min(), -1};
+    EXPECT_EQ(cn::sum<cn::integer::saturate>(n), std::numeric_limits<int>::min());
+
+    // Solo cuenta el resultado final: se desborda a mitad de camino pero cabe.
+    const std::vector<int> back{std::numeric_limits<int>::max(), 1, -1};
+    EXPECT_EQ(cn::sum<cn::integer::checked>(back), std::numeric_limits<int>::max());
+}
+
+TEST(IntegerSum, SixtyFourBitUsesWideAccumulator) {
+    constexpr auto big = std::numeric_limits<std::int64_t>::max();
+    const std::vector<std::int64_t> v{big, big, -big, -5};
+    EXPECT_EQ(cn::sum<cn::integer::checked>(v), big - 5);
+
+    const std::vector<std::int64_t> over{big, big};
+    EXPECT_THROW(cn::sum<cn::integer::checked>(over), std::overflow_error);
+    EXPECT_EQ(cn::sum<cn::integer::saturate>(over), big);
+
+    const std::vector<std::int64_t> under{-big, -big};
+    EXPECT_EQ(cn::sum<cn::integer::saturate>(under), std::numeric_limits<std::int64_t>::min());
+
+    const std::vector<std::uint64_t> u{std::numeric_limits<std::uint64_t>::max(), 1};
+    EXPECT_THROW(cn::sum<cn::integer::checked>(u), std::overflow_error);
+}
+
+TEST(IntegerSum, ParallelPoliciesMatchSequential) {
+    auto v = test_data::random<int>(200003);
+    for (std::size_t i = 0; i < v.size(); i += 3) v[i] = std::numeric_limits<int>::max() / 4;
+    const auto par = cn::execution::par.on(4);
+    EXPECT_EQ(cn::sum<cn::integer::wrap>(par, v), cn::sum<cn::integer::wrap>(v));
+    EXPECT_EQ(cn::sum<cn::integer::saturate>(par, v), std::numeric_limits<int>::max());
+    EXPECT_THROW(cn::sum<cn::integer::checked>(par, v), std::overflow_error);
+    EXPECT_EQ(cn::sum<cn::integer::widen>(par, v), cn::sum(v));
+}
+
+TEST(IntegerVariance, ExactForLargeValues) {
+    // Valores enormes con varianza pequena: los dos caminos en double pierden
+    // la parte baja, las sumas enteras no.
+    std::vector<int> v;
+    for (int i = 0; i < 100001; ++i) v.push_back(2000000000 + (i % 3) - 1);
+    const std::list<int> l(v.begin(), v.end());
+
+    std::int64_t s1 = 0;
+    long double s2 = 0;
+    for (int x : v) {
+        s1 += x - 2000000000;
+        s2 += static_cast<long double>(x - 2000000000) * (x - 2000000000);
+    }
+    const long double n = v.size();
+    const double exact = static_cast<double>((s2 - s1 * s1 / n) / n);
+
+    EXPECT_DOUBLE_EQ(cn::variance(v), exact);
+    EXPECT_DOUBLE_EQ(cn::variance(l), exact);
+    EXPECT_EQ(cn::max(v), 2000000001);
+}
+
+TEST(IntegerVariance, SimdMatchesGenericExactly) {
+    for (std::size_t n : test_data::sizes) {
+        const auto v = test_data::random<int>(n);
+        const std::list<int> l(v.begin(), v.end());
+        SCOPED_TRACE(n);
+        const auto a = cn::moments(v);
+        const auto b = cn::moments(l);
+        EXPECT_EQ(a.m2, b.m2);
+        EXPECT_EQ(a.mean, b.mean);
+        EXPECT_EQ(a.min, b.min);
+        EXPECT_EQ(a.max, b.max);
+    }
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    template<typename T>
+    std::filesystem::path write_column(const std::string& name, const std::vector<T>& v) {
+        const auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+        return path;
+    }
+}
+
+TEST(MappedColumn, ReductionsMatchInMemoryVector) {
+    const auto v = test_data::random<double>(100003);
+    const auto path = write_column("core_numeric_mapped_double.bin", v);
+    {
+        const cn::mapped_column<double> col(path.string());
+        ASSERT_EQ(col.size(), v.size());
+        EXPECT_EQ(cn::sum(col), cn::sum(v));
+        EXPECT_EQ(cn::mean(col), cn::mean(v));
+        EXPECT_EQ(cn::variance(col), cn::variance(v));
+        EXPECT_EQ(cn::max(col), cn::max(v));
+        EXPECT_NEAR(cn::variance(cn::execution::par.on(4), col), cn::variance(v), 1e-9 * cn::variance(v));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MappedColumn, Int64Column) {
+    const auto v = test_data::random<std::int64_t>(4099);
+    const auto path = write_column("core_numeric_mapped_int64.bin", v);
+    {
+        const cn::mapped_column<std::int64_t> col(path.string(), {cn::mapped_file::access::random, false, true});
+        EXPECT_EQ(cn::sum(col), cn::sum(v));
+        EXPECT_EQ(cn::max(col), cn::max(v));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MappedColumn, EmptyFile) {
+    const auto path = write_column("core_numeric_mapped_empty.bin", std::vector<double>{});
+    {
+        const cn::mapped_column<double> col(path.string());
+        EXPECT_TRUE(col.empty());
+        EXPECT_EQ(cn::sum(col), 0.0);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MappedColumn, Errors) {
+    EXPECT_THROW(cn::mapped_column<double>("/nonexistent/core_numeric.bin"), std::system_error);
+
+    const auto path = write_column("core_numeric_mapped_odd.bin", std::vector<char>{1, 2, 3});
+    EXPECT_THROW(cn::mapped_column<double>(path.string()), std::runtime_error);
+    std::filesystem::remove(path);
+}
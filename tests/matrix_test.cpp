@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+// Filas y columnas que no son multiplo de los mosaicos internos.
+TEST(ColumnMoments, MatchesPerColumnMoments) {
+    for (auto [rows, cols] : {std::pair<std::size_t, std::size_t>{1, 1}, {3, 700}, {129, 5}, {300, 513}}) {
+        const auto v = test_data::random<double>(rows * cols);
+        const cn::matrix_view<double> m(v.data(), rows, cols);
+        const auto batched = cn::column_moments(m);
+        ASSERT_EQ(batched.size(), cols);
+        for (std::size_t j = 0; j < cols; ++j) {
+            const auto ref = cn::moments(m.column(j));
+            EXPECT_EQ(batched[j].count, rows);
+            EXPECT_NEAR(batched[j].mean, ref.mean, 1e-9);
+            EXPECT_NEAR(cn::variance(batched[j]), cn::variance(ref), 1e-9 * (1 + cn::variance(ref)));
+            EXPECT_EQ(batched[j].min, ref.min);
+            EXPECT_EQ(batched[j].max, ref.max);
+        }
+    }
+}
+
+// NaN al principio de un bloque de 128 filas: como moments() sobre la columna.
+TEST(ColumnMoments, NaNAtBlockBoundaryMatchesMoments) {
+    const std::size_t rows = 300, cols = 3;
+    std::vector<double> v(rows * cols, 1.0);
+    v[128 * cols] = std::nan("");
+    v[129 * cols] = 1e9;
+    v[130 * cols] = -1e9;
+    v[256 * cols + 1] = std::nan("");
+    v[cols + 2] = std::nan("");
+    const cn::matrix_view<double> m(v.data(), rows, cols);
+    const auto r = cn::column_moments(m);
+    for (std::size_t j = 0; j < cols; ++j) {
+        const auto e = cn::moments(m.column(j));
+        EXPECT_EQ(r[j].min, e.min) << j;
+        EXPECT_EQ(r[j].max, e.max) << j;
+    }
+    EXPECT_EQ(r[0].max, 1e9);
+    EXPECT_EQ(r[0].min, -1e9);
+}
+
+TEST(ColumnMoments, StrideAndIntegers) {
+    const std::size_t rows = 200, cols = 37, stride = 40;
+    const auto v = test_data::random<std::int32_t>(rows * stride);
+    const cn::matrix_view<std::int32_t> m(v.data(), rows, cols, stride);
+    const auto batched = cn::column_moments(m);
+    for (std::size_t j = 0; j < cols; ++j) {
+        const auto ref = cn::moments(m.column(j));
+        EXPECT_NEAR(cn::variance(batched[j]), cn::variance(ref), 1e-9 * cn::variance(ref));
+        EXPECT_EQ(batched[j].max, ref.max);
+    }
+}
+
+TEST(RowMoments, MatchesPerRowMoments) {
+    const std::size_t rows = 50, cols = 2100;
+    const auto v = test_data::random<float>(rows * cols);
+    const auto batched = cn::row_moments(v.data(), rows, cols);
+    ASSERT_EQ(batched.size(), rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        const std::vector<float> r(v.begin() + i * cols, v.begin() + (i + 1) * cols);
+        const auto ref = cn::moments(r);
+        EXPECT_EQ(batched[i].m2, ref.m2);
+        EXPECT_EQ(batched[i].max, ref.max);
+    }
+}
+
+TEST(ColumnMoments, EmptyMatrix) {
+    EXPECT_TRUE(cn::column_moments<double>(nullptr, 0, 0).empty());
+    const auto zero_rows = cn::column_moments<double>(nullptr, 0, 4);
+    ASSERT_EQ(zero_rows.size(), 4u);
+    EXPECT_EQ(zero_rows[0].count, 0u);
+}
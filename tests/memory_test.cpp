@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::stats;
+
+// Contador de operator new global para todo el ejecutable de pruebas.
+namespace {
+    std::atomic<std::size_t> allocations{0};
+
+    // Cuenta bytes pedidos a traves del recurso y delega en el upstream.
+    class counting_resource : public std::pmr::memory_resource {
+    public:
+        std::size_t bytes = 0;
+
+    private:
+        void* do_allocate(std::size_t n, std::size_t align) override {
+            bytes += n;
+            return std::pmr::new_delete_resource()->allocate(n, align);
+        }
+        void do_deallocate(void* p, std::size_t n, std::size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, n, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    template<typename F>
+    std::size_t count_allocations(F f) {
+        const std::size_t before = allocations.load();
+        f();
+        return allocations.load() - before;
+    }
+}
+
+void* operator new(std::size_t n) {
+    ++allocations;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+TEST(Scratch, SteadyStateCallsDoNotAllocate) {
+    const auto v = test_data::random<double>(100003);
+    const auto one = cn::execution::par.on(1);
+
+    // Calentamiento: el pool del hilo reserva sus bloques una vez (y con
+    // CORE_NUMERIC_METRICS cada funcion registra su serie en la primera llamada).
+    volatile double sink = cn::variance(one, v) + cn::sum(one, v) + cn::variance(v) +
+                           cn::describe<stats::mean, stats::variance, stats::max>(v).variance();
+
+    EXPECT_EQ(count_allocations([&] { sink = cn::variance(v); }), 0u);
+    EXPECT_EQ(count_allocations([&] { sink = cn::describe<stats::mean, stats::variance, stats::max>(v).variance(); }), 0u);
+    EXPECT_EQ(count_allocations([&] { sink = cn::variance(one, v); }), 0u);
+    EXPECT_EQ(count_allocations([&] { sink = cn::sum(one, v); }), 0u);
+
+    // Con varios hilos el pool ya existe y los parciales salen del pool del hilo.
+    const auto four = cn::execution::par.on(4);
+    sink = cn::variance(four, v);
+    EXPECT_EQ(count_allocations([&] { sink = cn::variance(four, v); }), 0u);
+    (void)sink;
+}
+
+TEST(Scratch, CustomResourceReceivesInternalBuffers) {
+    const auto v = test_data::random<double>(100003);
+    counting_resource arena;
+    {
+        cn::scoped_scratch_resource scope(&arena);
+        EXPECT_EQ(cn::scratch_resource(), &arena);
+        EXPECT_NEAR(cn::variance(cn::execution::par.on(2), v), cn::variance(v), 1e-9 * cn::variance(v));
+        cn::reduce_stream<stats::sum>(cn::span_source<double>(v), {4096, 2});
+    }
+    EXPECT_NE(cn::scratch_resource(), &arena);
+    EXPECT_GE(arena.bytes, 2 * 4096 * sizeof(double));
+}
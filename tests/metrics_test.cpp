@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+namespace metrics = core_numeric::metrics;
+
+namespace {
+    const metrics::sample* find(const std::vector<metrics::sample>& s, const std::string& function,
+                                const std::string& type, const std::string& policy) {
+        const auto it = std::find_if(s.begin(), s.end(), [&](const metrics::sample& m) {
+            return m.function == function && m.type == type && m.policy == policy && m.calls > 0;
+        });
+        return it == s.end() ? nullptr : &*it;
+    }
+}
+
+// Sin -DCORE_NUMERIC_METRICS=ON las macros no generan codigo y no hay series.
+TEST(Metrics, CompiledOutRecordsNothing) {
+    if constexpr (metrics::enabled) GTEST_SKIP() << "instrumentation enabled";
+    const auto v = test_data::random<double>(1000);
+    (void)cn::sum(v);
+    EXPECT_TRUE(metrics::snapshot().empty());
+    EXPECT_TRUE(metrics::prometheus().empty());
+}
+
+TEST(Metrics, CountsOutermostCalls) {
+    if constexpr (!metrics::enabled) GTEST_SKIP() << "build with -DCORE_NUMERIC_METRICS=ON";
+    metrics::reset();
+    const auto v = test_data::random<double>(1000);
+    const std::list<int> l{1, 2, 3};
+    (void)cn::sum(v);
+    (void)cn::sum(v);
+    (void)cn::variance(v); // no cuenta el moments interno
+    (void)cn::sum(l);
+
+    const auto s = metrics::snapshot();
+    const auto* sum = find(s, "sum", "double", "seq");
+    ASSERT_NE(sum, nullptr);
+    EXPECT_EQ(sum->calls, 2u);
+    EXPECT_EQ(sum->elements, 2000u);
+    EXPECT_EQ(sum->bytes, 2000u * sizeof(double));
+    EXPECT_EQ(sum->threads, 2u);
+    EXPECT_NE(sum->kernel, "generic");
+
+    EXPECT_EQ(find(s, "moments", "double", "seq"), nullptr);
+    ASSERT_NE(find(s, "variance", "double", "seq"), nullptr);
+    const auto* generic = find(s, "sum", "int32", "seq");
+    ASSERT_NE(generic, nullptr);
+    EXPECT_EQ(generic->kernel, "generic");
+
+    std::uint64_t in_buckets = 0;
+    for (auto b : sum->latency) in_buckets += b;
+    EXPECT_EQ(in_buckets, 2u);
+}
+
+TEST(Metrics, ParallelCallsRecordThreadsOnce) {
+    if constexpr (!metrics::enabled) GTEST_SKIP() << "build with -DCORE_NUMERIC_METRICS=ON";
+    cn::thread_pool pool({4});
+    metrics::reset();
+    const auto v = test_data::random<double>(1 << 20);
+    (void)cn::sum(cn::execution::par.with(pool), v);
+
+    const auto s = metrics::snapshot();
+    const auto* par = find(s, "sum", "double", "par");
+    ASSERT_NE(par, nullptr);
+    EXPECT_EQ(par->calls, 1u);
+    EXPECT_EQ(par->elements, v.size());
+    EXPECT_EQ(par->threads, 4u);
+    EXPECT_EQ(find(s, "sum", "double", "seq"), nullptr); // los bloques no cuentan
+
+    const std::string text = metrics::prometheus();
+    EXPECT_NE(text.find("# TYPE core_numeric_calls_total counter"), std::string::npos);
+    EXPECT_NE(text.find("core_numeric_calls_total{function=\"sum\",type=\"double\",kernel=\"" + par->kernel +
+                        "\",policy=\"par\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("core_numeric_call_duration_seconds_bucket{function=\"sum\",type=\"double\",kernel=\"" +
+                        par->kernel + "\",policy=\"par\",le=\"+Inf\"} 1"), std::string::npos);
+}
+
+// La ISA se resuelve en cada llamada: tras simd::use() las llamadas van a otra serie.
+TEST(Metrics, KernelFollowsTheActiveIsa) {
+    if constexpr (!metrics::enabled) GTEST_SKIP() << "build with -DCORE_NUMERIC_METRICS=ON";
+    const auto saved = cn::simd::active();
+    metrics::reset();
+    const auto v = test_data::random<double>(1000);
+    cn::simd::use(cn::simd::isa::scalar);
+    (void)cn::sum(v);
+    cn::simd::use(saved);
+    (void)cn::sum(v);
+
+    const auto s = metrics::snapshot();
+    const auto calls = [&](const char* kernel) {
+        std::uint64_t c = 0;
+        for (const auto& m : s)
+            if (m.function == "sum" && m.type == "double" && m.policy == "seq" && m.kernel == kernel) c += m.calls;
+        return c;
+    };
+    if (saved == cn::simd::isa::scalar) {
+        EXPECT_EQ(calls("scalar"), 2u);
+    } else {
+        EXPECT_EQ(calls("scalar"), 1u);
+        EXPECT_EQ(calls(cn::simd::name(saved)), 1u);
+    }
+}
+
+// La serie sigue el camino tomado, no el tipo de contenedor: un vector
+// contiguo por un bucle escalar queda en "generic".
+TEST(Metrics, KernelFollowsThePathTaken) {
+    if constexpr (!metrics::enabled) GTEST_SKIP() << "build with -DCORE_NUMERIC_METRICS=ON";
+    metrics::reset();
+    const auto v = test_data::random<double>(1000);
+    (void)cn::sum(v);
+    (void)cn::sum<cn::summation::kahan>(v);
+    (void)cn::moments<4>(v);
+    (void)cn::transform_reduce(v, [](double x) { return x * x; });
+
+    const auto s = metrics::snapshot();
+    const auto kernel = [&](const char* function) {
+        std::vector<std::string> k;
+        for (const auto& m : s)
+            if (m.function == function && m.type == "double" && m.policy == "seq" && m.calls > 0)
+                k.push_back(m.kernel);
+        return k;
+    };
+    const auto sum = kernel("sum");
+    ASSERT_EQ(sum.size(), 2u);
+    EXPECT_EQ(std::count(sum.begin(), sum.end(), "generic"), 1);
+    EXPECT_EQ(kernel("moments"), std::vector<std::string>{"generic"});
+    EXPECT_EQ(kernel("transform_reduce"), std::vector<std::string>{"generic"});
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <list>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Moments, SinglePassStatistics) {
+    const auto m = cn::moments(std::vector<double>{1, 2, 3, 4});
+    EXPECT_EQ(m.count, 4u);
+    EXPECT_DOUBLE_EQ(cn::mean(m), 2.5);
+    EXPECT_DOUBLE_EQ(cn::variance(m), 1.25);
+    EXPECT_DOUBLE_EQ(m.min, 1.0);
+    EXPECT_DOUBLE_EQ(cn::max(m), 4.0);
+}
+
+TEST(Moments, HigherOrder) {
+    const auto m = cn::moments<4>(std::vector<int>{2, 4, 4, 4, 5, 5, 7, 9});
+    EXPECT_DOUBLE_EQ(m.m2 / m.count, 4.0);
+    EXPECT_DOUBLE_EQ(m.m3 / m.count, 5.25);
+    EXPECT_DOUBLE_EQ(m.m4 / m.count, 44.5);
+}
+
+TEST(Moments, BlockedKernelMatchesWelford) {
+    auto v = test_data::random<double>(100003);
+    for (auto& x : v) x += 1e6;
+    const std::list<double> l(v.begin(), v.end());
+
+    const auto a = cn::moments(v);
+    const auto b = cn::moments(l);
+    EXPECT_EQ(a.count, b.count);
+    EXPECT_NEAR(a.mean, b.mean, 1e-12 * b.mean);
+    EXPECT_NEAR(a.m2, b.m2, 1e-9 * b.m2);
+    EXPECT_EQ(a.min, b.min);
+    EXPECT_EQ(a.max, b.max);
+}
+
+TEST(Moments, MergeEqualsWholeRange) {
+    const auto v = test_data::random<double>(5000);
+    const std::vector<double> left(v.begin(), v.begin() + 1234), right(v.begin() + 1234, v.end());
+
+    const auto whole = cn::moments<4>(v);
+    const auto merged = cn::merge<4>(cn::moments<4>(left), cn::moments<4>(right));
+    EXPECT_EQ(merged.count, whole.count);
+    EXPECT_NEAR(merged.mean, whole.mean, 1e-9);
+    EXPECT_NEAR(merged.m2, whole.m2, 1e-9 * whole.m2);
+    EXPECT_NEAR(merged.m3, whole.m3, 1e-7 * std::abs(whole.m4 / whole.m2));
+    EXPECT_NEAR(merged.m4, whole.m4, 1e-9 * whole.m4);
+}
+
+// Como max()/min(): solo cuenta un NaN en el primer elemento, tambien cuando
+// abre un bloque de L1 (2048) o de describe.
+TEST(Moments, ExtremaFollowMaxMinWithNaN) {
+    std::vector<double> v(5000, 1.0);
+    v[2048] = std::nan("");
+    v[4000] = 5.0;
+    v[4500] = -3.0;
+    const std::list<double> l(v.begin(), v.end());
+    const auto m = cn::moments(v);
+    const auto r = cn::minmax(v);
+    const auto d = cn::describe<cn::stats::min, cn::stats::max>(v);
+    const auto dv = cn::describe<cn::stats::variance, cn::stats::max>(v);
+
+    EXPECT_EQ(cn::max(v), 5.0);
+    EXPECT_EQ(cn::max(l), 5.0);
+    EXPECT_EQ(m.max, cn::max(v));
+    EXPECT_EQ(m.min, cn::min(v));
+    EXPECT_EQ(r.max, cn::max(v));
+    EXPECT_EQ(r.min, cn::min(v));
+    EXPECT_EQ(cn::minmax(l).max, cn::max(v));
+    EXPECT_EQ(d.max(), cn::max(v));
+    EXPECT_EQ(d.min(), cn::min(v));
+    EXPECT_EQ(dv.max(), cn::max(v));
+
+    // Camino generico por pares con un NaN en uno de los dos.
+    for (const auto& w : {std::vector<double>{5, 1, std::nan("")},
+                           std::vector<double>{5, 1, std::nan(""), 9, 0},
+                           std::vector<double>{5, std::nan(""), 1, 9}}) {
+        const std::list<double> wl(w.begin(), w.end());
+        EXPECT_EQ(cn::minmax(wl).min, cn::min(wl));
+        EXPECT_EQ(cn::minmax(wl).max, cn::max(wl));
+        EXPECT_EQ(cn::minmax(wl).min, cn::minmax(w).min);
+        EXPECT_EQ(cn::minmax(wl).max, cn::minmax(w).max);
+    }
+
+    v[0] = std::nan("");
+    EXPECT_TRUE(std::isnan(cn::max(v)));
+    EXPECT_TRUE(std::isnan(cn::moments(v).max));
+    EXPECT_TRUE(std::isnan(cn::minmax(v).min));
+    EXPECT_TRUE(std::isnan((cn::describe<cn::stats::max>(v).max())));
+}
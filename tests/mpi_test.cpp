@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <span>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+// Se lanza con mpiexec -n 4 (ver CMakeLists.txt); cada proceso es un rango.
+
+TEST(Mpi, AllReduceMatchesGatheredData) {
+    cn::mpi_communicator comm;
+    const auto x = test_data::random<double>(5000 + 100 * static_cast<std::size_t>(comm.rank()), 40 + comm.rank());
+    cn::accumulator<double, cn::stats::mean | cn::stats::variance | cn::stats::max | cn::stats::quantiles> local;
+    local.push(std::span<const double>(x));
+    const auto global = cn::all_reduce(comm, local);
+
+    std::vector<double> all;
+    for (int r = 0; r < comm.size(); ++r) {
+        const auto part = test_data::random<double>(5000 + 100 * static_cast<std::size_t>(r), 40 + r);
+        all.insert(all.end(), part.begin(), part.end());
+    }
+    EXPECT_EQ(global.count(), all.size());
+    EXPECT_NEAR(global.mean(), cn::mean(all), 1e-9);
+    EXPECT_NEAR(global.variance(), cn::variance(all), 1e-9 * cn::variance(all));
+    EXPECT_EQ(global.max(), cn::max(all));
+
+    // Mismo estado en todos los rangos.
+    const auto mine = cn::serialize(global);
+    auto root = mine;
+    int n = static_cast<int>(root.size());
+    MPI_Bcast(&n, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    root.resize(static_cast<std::size_t>(n));
+    MPI_Bcast(root.data(), n, MPI_BYTE, 0, MPI_COMM_WORLD);
+    EXPECT_EQ(mine, root);
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    int rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (rank != 0) delete ::testing::UnitTest::GetInstance()->listeners().Release(
+        ::testing::UnitTest::GetInstance()->listeners().default_result_printer());
+    int failed = RUN_ALL_TESTS();
+    MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Finalize();
+    return failed;
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::nan_policy::propagate;
+using cn::nan_policy::skip;
+
+namespace {
+    template<typename T>
+    std::vector<T> without_nan(const std::vector<T>& x) {
+        std::vector<T> out;
+        for (T v : x) if (!std::isnan(v)) out.push_back(v);
+        return out;
+    }
+
+    // Un NaN cada 'every' elementos, empezando en 'first'.
+    template<typename T>
+    std::vector<T> with_nans(std::size_t n, std::size_t first, std::size_t every, unsigned seed) {
+        auto x = test_data::random<T>(n, seed);
+        for (std::size_t i = first; i < n; i += every) x[i] = std::numeric_limits<T>::quiet_NaN();
+        return x;
+    }
+}
+
+template<typename T>
+class NanPolicies : public ::testing::Test {};
+
+using FloatTypes = ::testing::Types<double, float>;
+TYPED_TEST_SUITE(NanPolicies, FloatTypes);
+
+TYPED_TEST(NanPolicies, SkipMatchesFilteredInput) {
+    using T = TypeParam;
+    for (std::size_t n : test_data::sizes) {
+        const auto x = with_nans<T>(n, n / 3, 7, 21);
+        const auto clean = without_nan(x);
+        if (clean.size() < 2) continue;
+
+        EXPECT_NEAR(*cn::mean<skip>(x), cn::mean(clean), 1e-9 * 1000) << n;
+        EXPECT_NEAR(*cn::variance<skip>(x), cn::variance(clean), 1e-9 * cn::variance(clean)) << n;
+        EXPECT_NEAR(*cn::variance<skip>(x, 1), cn::variance(clean, 1), 1e-9 * cn::variance(clean)) << n;
+        EXPECT_EQ(*cn::max<skip>(x), cn::max(clean)) << n;
+        EXPECT_EQ(*cn::min<skip>(x), cn::min(clean)) << n;
+
+        const std::deque<T> d(x.begin(), x.end());
+        EXPECT_NEAR(*cn::mean<skip>(d), cn::mean(clean), 1e-9 * 1000) << n;
+        EXPECT_NEAR(*cn::variance<skip>(d), cn::variance(clean), 1e-9 * cn::variance(clean)) << n;
+        EXPECT_EQ(*cn::max<skip>(d), cn::max(clean)) << n;
+    }
+}
+
+TYPED_TEST(NanPolicies, PropagateReturnsNanWherever) {
+    using T = TypeParam;
+    for (std::size_t n : test_data::sizes) {
+        for (std::size_t at : {std::size_t{0}, n / 2, n - 1}) {
+            auto x = test_data::random<T>(n, 22);
+            x[at] = std::numeric_limits<T>::quiet_NaN();
+            EXPECT_TRUE(std::isnan(*cn::mean<propagate>(x))) << n << " " << at;
+            EXPECT_TRUE(std::isnan(*cn::variance<propagate>(x))) << n << " " << at;
+            EXPECT_TRUE(std::isnan(*cn::max<propagate>(x))) << n << " " << at;
+            EXPECT_TRUE(std::isnan(*cn::min<propagate>(x))) << n << " " << at;
+        }
+        const auto clean = test_data::random<T>(n, 23);
+        EXPECT_EQ(*cn::max<propagate>(clean), cn::max(clean));
+        EXPECT_EQ(*cn::min<propagate>(clean), cn::min(clean));
+    }
+}
+
+TYPED_TEST(NanPolicies, EmptyOrAllNanIsNullopt) {
+    using T = TypeParam;
+    const std::vector<T> empty;
+    const std::vector<T> nans(100, std::numeric_limits<T>::quiet_NaN());
+
+    EXPECT_FALSE(cn::mean<propagate>(empty));
+    EXPECT_FALSE(cn::variance<propagate>(empty));
+    EXPECT_FALSE(cn::max<propagate>(empty));
+    EXPECT_FALSE(cn::min<skip>(empty));
+
+    EXPECT_FALSE(cn::mean<skip>(nans));
+    EXPECT_FALSE(cn::variance<skip>(nans));
+    EXPECT_FALSE(cn::max<skip>(nans));
+    EXPECT_FALSE(cn::min<skip>(nans));
+    EXPECT_TRUE(std::isnan(*cn::max<propagate>(nans)));
+
+    // Un solo valor: varianza de poblacion 0 y muestral indefinida.
+    const std::vector<T> one{T(3)};
+    EXPECT_EQ(*cn::variance<skip>(one), 0.0);
+    EXPECT_FALSE(cn::variance<skip>(one, 1));
+    EXPECT_EQ(*cn::max<skip>(std::vector<T>{-std::numeric_limits<T>::infinity()}),
+              -std::numeric_limits<T>::infinity());
+}
+
+TEST(NanPolicies, IntegersIgnoreThePolicy) {
+    const auto x = test_data::random<int>(1000, 24);
+    EXPECT_EQ(*cn::mean<skip>(x), cn::mean(x));
+    EXPECT_EQ(*cn::variance<skip>(x), cn::variance(x));
+    EXPECT_EQ(*cn::max<propagate>(x), cn::max(x));
+    EXPECT_FALSE(cn::mean<skip>(std::vector<int>{}));
+    EXPECT_FALSE(cn::max<skip>(std::vector<int>{}));
+}
+
+TEST(NanPolicies, HalfFloats) {
+    std::vector<cn::float16> x{cn::float16(1.0f), cn::float16(std::nanf("")), cn::float16(3.0f)};
+    EXPECT_EQ(*cn::mean<skip>(x), 2.0);
+    EXPECT_EQ(static_cast<float>(*cn::max<skip>(x)), 3.0f);
+    EXPECT_TRUE(std::isnan(static_cast<float>(*cn::max<propagate>(x))));
+}
+
+TEST(Ddof, SampleVariance) {
+    const auto x = test_data::random<double>(1001, 25);
+    const double pop = cn::variance(x);
+    const double n = static_cast<double>(x.size());
+    EXPECT_DOUBLE_EQ(cn::variance(x, 0), pop);
+    EXPECT_DOUBLE_EQ(cn::variance(x, 1), pop * n / (n - 1));
+
+    const auto acc = cn::describe<cn::stats::variance>(x);
+    EXPECT_DOUBLE_EQ(acc.variance(1), cn::variance(x, 1));
+    EXPECT_TRUE(std::isnan(cn::variance(std::vector<double>{1.0}, 1)));
+}
+
+TEST(EmptyInput, DefinedSemantics) {
+    const std::vector<double> empty;
+    EXPECT_TRUE(std::isnan(cn::mean(empty)));
+    EXPECT_TRUE(std::isnan(cn::variance(empty)));
+    EXPECT_THROW(cn::max(empty), std::invalid_argument);
+    EXPECT_THROW(cn::mean(std::vector<int>{}), std::invalid_argument);
+    EXPECT_THROW(cn::mean(cn::execution::par, std::vector<int>{}), std::invalid_argument);
+}
+
+// Los kernels despachados y los escalares coinciden en suma y conteo.
+TEST(NanKernels, MatchScalar) {
+    for (std::size_t n : test_data::sizes) {
+        const auto x = with_nans<double>(n, 1, 5, 26);
+        const auto a = cn::simd::nan_sum(x.data(), n);
+        const auto b = cn::simd::scalar::nan_sum(x.data(), n);
+        EXPECT_EQ(a.count, b.count) << n;
+        EXPECT_NEAR(a.value, b.value, 1e-9 * 1000 * static_cast<double>(n)) << n;
+        EXPECT_EQ(cn::simd::nan_max(x.data(), n).value, cn::simd::scalar::nan_max(x.data(), n).value) << n;
+        EXPECT_EQ(cn::simd::nan_min(x.data(), n).count, b.count) << n;
+        EXPECT_NEAR(cn::simd::nan_sq_dev(x.data(), n, 1.0), cn::simd::scalar::nan_sq_dev(x.data(), n, 1.0),
+                    1e-9 * cn::simd::scalar::nan_sq_dev(x.data(), n, 1.0) + 1e-9) << n;
+    }
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Numa, Topology) {
+    EXPECT_GE(cn::numa::node_count(), 1);
+    std::vector<double> v(1 << 16, 1.0);
+    const int node = cn::numa::node_of(v.data());
+    EXPECT_TRUE(node == -1 || (node >= 0 && node < cn::numa::node_count()));
+}
+
+TEST(Numa, BufferPlacements) {
+    for (auto where : {cn::numa::placement::first_touch, cn::numa::placement::interleaved, cn::numa::placement::bind}) {
+        cn::numa::buffer<double> buf(300007, where, 0);
+        ASSERT_EQ(buf.size(), 300007u);
+        cn::first_touch(cn::execution::par.on(4), buf, 2.0);
+        EXPECT_EQ(cn::sum(buf), 2.0 * 300007);
+        EXPECT_EQ(cn::max(buf), 2.0);
+    }
+    cn::numa::buffer<int> empty(0);
+    EXPECT_EQ(empty.size(), 0u);
+}
+
+TEST(Numa, NodeAffinePartitionMatchesPlainParallel) {
+    cn::thread_pool pool({4, true});
+    cn::numa::buffer<double> buf(500009);
+    const auto src = test_data::random<double>(buf.size());
+    std::copy(src.begin(), src.end(), buf.begin());
+
+    const auto par = cn::execution::par.on(4).with(pool);
+    EXPECT_EQ(cn::variance(par.numa(), buf), cn::variance(par, buf));
+    EXPECT_EQ(cn::sum(par.numa(), buf), cn::sum(par, buf));
+    EXPECT_EQ(cn::max(par.numa(), src), cn::max(src));
+}
+
+TEST(Numa, ParallelForNodesRunsEveryIndexOnce) {
+    cn::thread_pool pool({3});
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for_nodes(hits.size(), [](std::size_t i) { return static_cast<int>(i % 3) - 1; },
+                            [&](std::size_t i) { hits[i].fetch_add(1); });
+    for (const auto& h : hits) ASSERT_EQ(h.load(), 1);
+}
+
+TEST(Numa, PinnedPoolOnNode) {
+    cn::thread_pool pool({2, false, 0});
+    EXPECT_EQ(pool.size(), 2u);
+    EXPECT_EQ(pool.node_of_worker(1), 0);
+    EXPECT_THROW(cn::thread_pool({2, false, 1000}), std::invalid_argument);
+}
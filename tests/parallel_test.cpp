@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <list>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Parallel, MatchesSerialResults) {
+    const auto v = test_data::random<double>(200003);
+    const auto par = cn::execution::par.on(4);
+
+    EXPECT_NEAR(cn::sum(par, v), cn::sum(v), 1e-6);
+    EXPECT_NEAR(cn::mean(par, v), cn::mean(v), 1e-12);
+    EXPECT_NEAR(cn::variance(par, v), cn::variance(v), 1e-9 * cn::variance(v));
+    EXPECT_EQ(cn::max(par, v), cn::max(v));
+    EXPECT_NEAR(cn::transform_reduce(par, v, [](double x) { return x * x; }),
+                cn::transform_reduce(v, [](double x) { return x * x; }), 1e-3);
+}
+
+TEST(Parallel, TransformReduceWithCombine) {
+    const auto v = test_data::random<int>(100003);
+    const auto par = cn::execution::par.on(4);
+    const auto max_op = [](long a, long b) { return a > b ? a : b; };
+    const auto sq = [](int x) { return static_cast<long>(x) * x; };
+
+    EXPECT_EQ(cn::transform_reduce(par, v, 0L, max_op, sq), cn::transform_reduce(v, 0L, max_op, sq));
+    EXPECT_EQ(cn::transform_reduce(par, v, 0L, std::plus<>{}, sq), cn::transform_reduce(cn::execution::seq, v, 0L, std::plus<>{}, sq));
+}
+
+TEST(Parallel, DeterministicForFixedThreadCount) {
+    const auto v = test_data::random<double>(300007);
+    const auto par = cn::execution::par.on(3);
+    const double first = cn::sum(par, v);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(cn::sum(par, v), first);
+}
+
+TEST(Parallel, IntegerAndSequencedPolicies) {
+    const auto v = test_data::random<int>(100000);
+    EXPECT_EQ(cn::sum(cn::execution::par.on(4), v), cn::sum(v));
+    EXPECT_EQ(cn::mean(cn::execution::par.on(4), v), cn::mean(v));
+    EXPECT_EQ(cn::sum(cn::execution::seq, v), cn::sum(v));
+}
+
+TEST(Parallel, NonRandomAccessFallsBackToSerial) {
+    const std::list<int> l{1, 2, 3, 4};
+    EXPECT_EQ(cn::sum(cn::execution::par, l), 10);
+}
+
+TEST(Parallel, DescribeMergesChunks) {
+    using cn::stats;
+    const auto v = test_data::random<double>(100000);
+    const auto d = cn::describe<stats::variance, stats::max>(cn::execution::par.on(4), v);
+    EXPECT_NEAR(d.variance(), cn::variance(v), 1e-9 * cn::variance(v));
+    EXPECT_EQ(d.max(), cn::max(v));
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Sum, MatchesExpectedValues) {
+    EXPECT_EQ(cn::sum(std::vector<int>{1, 2, 3, 4}), 10);
+    EXPECT_DOUBLE_EQ(cn::sum(std::vector<double>{1.5, 2.0, 0.5}), 4.0);
+}
+
+TEST(Mean, MatchesExpectedValues) {
+    EXPECT_EQ(cn::mean(std::vector<int>{1, 2, 3, 4}), 2);
+    EXPECT_DOUBLE_EQ(cn::mean(std::vector<double>{1, 2, 3, 4}), 2.5);
+}
+
+TEST(Variance, MatchesExpectedValues) {
+    EXPECT_DOUBLE_EQ(cn::variance(std::vector<int>{1, 2, 3, 4}), 1.25);
+    EXPECT_DOUBLE_EQ(cn::variance(std::vector<double>{1, 2, 3, 4}), 1.25);
+}
+
+TEST(Max, MatchesExpectedValues) {
+    EXPECT_EQ(cn::max(std::vector<int>{3, 9, 2, 7}), 9);
+    EXPECT_DOUBLE_EQ(cn::max(std::vector<double>{1.2, 4.8, 3.1}), 4.8);
+}
+
+TEST(TransformReduce, MatchesExpectedValues) {
+    EXPECT_DOUBLE_EQ(cn::transform_reduce(std::vector<double>{1, 2, 3}, [](double x) { return x * x; }), 14.0);
+    EXPECT_EQ(cn::transform_reduce(std::vector<int>{1, 2, 3}, [](int x) { return x + 10; }), 36);
+}
+
+TEST(TransformReduce, IdentityAndCombine) {
+    const auto v = test_data::random<double>(1003);
+    const std::list<double> l(v.begin(), v.end());
+    const auto abs_max = [](double a, double b) { return std::fmax(a, b); };
+    const auto abs = [](double x) { return std::fabs(x); };
+
+    // Contiguo (carriles) y generico deben dar lo mismo con una operacion exacta.
+    EXPECT_EQ(cn::transform_reduce(v, 0.0, abs_max, abs), cn::transform_reduce(l, 0.0, abs_max, abs));
+    EXPECT_EQ(cn::transform_reduce(std::vector<int>{1, 2, 3, 4}, 1, std::multiplies<>{}, [](int x) { return x; }), 24);
+    EXPECT_EQ(cn::transform_reduce(std::vector<int>{}, 0, std::plus<>{}, [](int x) { return x; }), 0);
+
+    double s = 0.0;
+    for (double x : v) s += x * x;
+    EXPECT_NEAR(cn::transform_reduce(v, [](double x) { return x * x; }), s, 1e-12 * s);
+}
+
+// Los kernels SIMD (vector) deben coincidir con el lazo generico (list).
+template<typename T>
+class SimdAgainstGeneric : public ::testing::Test {};
+
+using LaneTypes = ::testing::Types<double, float, std::int32_t, std::int64_t>;
+TYPED_TEST_SUITE(SimdAgainstGeneric, LaneTypes);
+
+TYPED_TEST(SimdAgainstGeneric, SumMeanVarianceMax) {
+    using T = TypeParam;
+    for (std::size_t n : test_data::sizes) {
+        const auto v = test_data::random<T>(n);
+        const std::list<T> l(v.begin(), v.end());
+        SCOPED_TRACE(n);
+
+        const double tol = std::is_same_v<T, float> ? 1e-4 : 1e-9;
+        if constexpr (std::is_integral_v<T>) {
+            EXPECT_EQ(cn::sum(v), cn::sum(l));
+            EXPECT_EQ(cn::mean(v), cn::mean(l));
+        } else {
+            EXPECT_NEAR(cn::sum(v), cn::sum(l), tol * (1.0 + std::fabs(cn::sum(l))) * static_cast<double>(n));
+            EXPECT_NEAR(cn::mean(v), cn::mean(l), 1e-9 * 1000.0);
+        }
+        EXPECT_NEAR(cn::variance(v), cn::variance(l), 1e-9 * (1.0 + cn::variance(l)));
+
+        T expected = v[0];
+        for (T x : v) if (x > expected) expected = x;
+        EXPECT_EQ(cn::max(v), expected);
+    }
+}
+
+TEST(Max, IgnoresNaNAfterFirstElementLikeScalarLoop) {
+    std::vector<double> v(37, 1.0);
+    v[5] = std::nan("");
+    v[20] = 3.0;
+    EXPECT_DOUBLE_EQ(cn::max(v), 3.0);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(Rolling, IntegerMatchesBatchExactly) {
+    const auto v = test_data::random<int>(5000);
+    for (std::size_t w : {1u, 2u, 7u, 64u, 1000u}) {
+        const auto means = cn::rolling_mean(v, w);
+        const auto vars = cn::rolling_variance(v, w);
+        const auto maxs = cn::rolling_max(v, w);
+        ASSERT_EQ(means.size(), v.size() - w + 1);
+        for (std::size_t i = 0; i < means.size(); i += 13) {
+            const std::span<const int> win(v.data() + i, w);
+            EXPECT_EQ(means[i], cn::mean(win));
+            EXPECT_EQ(vars[i], cn::variance(win));
+            EXPECT_EQ(maxs[i], cn::max(win));
+        }
+    }
+}
+
+TEST(Rolling, FloatingStaysCloseOverLongStreams) {
+    // Valores grandes con poca dispersion: el peor caso para altas y bajas.
+    auto v = test_data::random<double>(200000);
+    for (auto& x : v) x = 1e6 + x * 1e-3;
+    const std::size_t w = 500;
+    const auto means = cn::rolling_mean(v, w);
+    const auto vars = cn::rolling_variance(v, w);
+    const auto maxs = cn::rolling_max(v, w);
+    for (std::size_t i = 0; i < means.size(); i += 997) {
+        const std::span<const double> win(v.data() + i, w);
+        EXPECT_NEAR(means[i], cn::mean(win), 1e-9 * 1e6);
+        EXPECT_NEAR(vars[i], cn::variance(win), 1e-6 * cn::variance(win));
+        EXPECT_EQ(maxs[i], cn::max(win));
+    }
+}
+
+TEST(Rolling, CountWindowMinMaxAndGenericRanges) {
+    cn::count_window<int, cn::stats::min | cn::stats::max> win(3);
+    const std::list<int> xs{5, 1, 4, 4, 9, 2, 2, 2};
+    std::vector<int> lo, hi;
+    for (int x : xs) {
+        win.push(x);
+        lo.push_back(win.min());
+        hi.push_back(win.max());
+    }
+    EXPECT_EQ(lo, (std::vector<int>{5, 1, 1, 1, 4, 2, 2, 2}));
+    EXPECT_EQ(hi, (std::vector<int>{5, 5, 5, 4, 9, 9, 9, 2}));
+    EXPECT_EQ(cn::rolling_max(xs, 3), (std::vector<int>{5, 4, 9, 9, 9, 2}));
+    EXPECT_TRUE(cn::rolling_mean(xs, 9).empty());
+}
+
+// Los NaN no cuentan salvo que la ventana solo tenga NaN.
+TEST(Rolling, MinMaxIgnoreNaN) {
+    const double nan = std::nan("");
+    const std::vector<double> xs{1, 5, nan};
+    EXPECT_EQ(cn::rolling_max(xs, 3).back(), cn::max(xs));
+
+    cn::count_window<double, cn::stats::min | cn::stats::max> win(2);
+    std::vector<double> lo, hi;
+    for (double x : {3.0, nan, nan, 2.0, nan, 7.0}) {
+        win.push(x);
+        lo.push_back(win.min());
+        hi.push_back(win.max());
+    }
+    EXPECT_EQ(lo[0], 3.0);
+    EXPECT_EQ(hi[1], 3.0);
+    EXPECT_TRUE(std::isnan(lo[2]));
+    EXPECT_TRUE(std::isnan(hi[2]));
+    EXPECT_EQ(hi[3], 2.0);
+    EXPECT_EQ(lo[4], 2.0);
+    EXPECT_EQ(hi[5], 7.0);
+    EXPECT_EQ(lo[5], 7.0);
+}
+
+TEST(Rolling, EmptyIntegerMeanThrows) {
+    cn::time_window<int, cn::stats::mean> win(5);
+    EXPECT_THROW((void)win.mean(), std::invalid_argument);
+    win.push(0, 4);
+    EXPECT_EQ(win.mean(), 4);
+    win.advance(10);
+    EXPECT_THROW((void)win.mean(), std::invalid_argument);
+    EXPECT_THROW((void)cn::mean(std::vector<int>{}), std::invalid_argument);
+}
+
+TEST(Rolling, TimeWindowEvictsBySpan) {
+    cn::time_window<double> win(10);
+    const std::vector<std::int64_t> ts{0, 3, 9, 10, 15, 30};
+    const std::vector<double> xs{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    win.push(std::span(ts).first(3), std::span(xs).first(3));
+    EXPECT_EQ(win.count(), 3u);
+    EXPECT_DOUBLE_EQ(win.mean(), 2.0);
+
+    win.push(ts[3], xs[3]); // sale t = 0
+    EXPECT_EQ(win.count(), 3u);
+    EXPECT_DOUBLE_EQ(win.mean(), 3.0);
+    EXPECT_DOUBLE_EQ(win.max(), 4.0);
+
+    win.push(ts[4], xs[4]); // sale t = 3
+    EXPECT_DOUBLE_EQ(win.mean(), 4.0);
+    EXPECT_DOUBLE_EQ(win.variance(), 2.0 / 3.0);
+
+    win.advance(26);
+    EXPECT_TRUE(win.empty());
+    EXPECT_TRUE(std::isnan(win.mean()));
+    EXPECT_THROW(win.max(), std::invalid_argument);
+
+    win.push(ts[5], xs[5]);
+    EXPECT_DOUBLE_EQ(win.max(), 6.0);
+    EXPECT_THROW(win.push(29, 1.0), std::invalid_argument);
+}
+
+TEST(Rolling, InvalidArguments) {
+    EXPECT_THROW((cn::count_window<double>(0)), std::invalid_argument);
+    EXPECT_THROW((cn::time_window<double>(0)), std::invalid_argument);
+    EXPECT_THROW(cn::rolling_mean(std::vector<double>{1.0}, 0), std::invalid_argument);
+
+    cn::time_window<double> win(5);
+    const std::vector<std::int64_t> ts{1, 2};
+    const std::vector<double> xs{1.0};
+    EXPECT_THROW(win.push(ts, xs), std::invalid_argument);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    constexpr auto all_stats = cn::stats::count | cn::stats::sum | cn::stats::mean | cn::stats::variance |
+                               cn::stats::min | cn::stats::max;
+
+    template<typename X>
+    X round_trip(const X& x) {
+        const auto bytes = cn::serialize(x);
+        EXPECT_EQ(bytes.size(), cn::serialized_size(x));
+        return cn::deserialize<X>(std::span<const std::byte>(bytes));
+    }
+
+    // Mismos bytes: el estado se reconstruyo campo a campo.
+    template<typename X>
+    bool same_state(const X& a, const X& b) {
+        return cn::serialize(a) == cn::serialize(b);
+    }
+}
+
+TEST(Serialize, MomentsRoundTrip) {
+    const auto x = test_data::random<double>(10007, 1);
+    const auto m = cn::moments<4>(x);
+    const auto r = round_trip(m);
+    EXPECT_EQ(r.count, m.count);
+    EXPECT_EQ(r.mean, m.mean);
+    EXPECT_EQ(r.m2, m.m2);
+    EXPECT_EQ(r.m4, m.m4);
+    EXPECT_EQ(r.min, m.min);
+    EXPECT_EQ(r.max, m.max);
+
+    const auto i = cn::moments(test_data::random<int>(1000, 2));
+    EXPECT_TRUE(same_state(round_trip(i), i));
+    const std::vector<cn::float16> h{cn::float16(1.5f), cn::float16(-2.0f), cn::float16(7.0f)};
+    EXPECT_EQ(round_trip(cn::moments(h)).min.bits, cn::float16(-2.0f).bits);
+}
+
+TEST(Serialize, AccumulatorKeepsOnlyRequestedStats) {
+    const auto x = test_data::random<double>(2049, 3);
+    const auto full = cn::describe<cn::stats::sum, cn::stats::mean, cn::stats::variance, cn::stats::min,
+                                   cn::stats::max>(x);
+    const auto r = round_trip(full);
+    EXPECT_EQ(r.count(), full.count());
+    EXPECT_EQ(r.sum(), full.sum());
+    EXPECT_EQ(r.mean(), full.mean());
+    EXPECT_EQ(r.variance(), full.variance());
+    EXPECT_EQ(r.min(), full.min());
+    EXPECT_EQ(r.max(), full.max());
+
+    // Cabecera de 6 bytes, count y la suma de la media.
+    const auto small = cn::describe<cn::stats::mean>(x);
+    EXPECT_EQ(cn::serialized_size(small), 6u + 8u + 8u);
+    const auto bytes = cn::serialize(small);
+    EXPECT_EQ(bytes[0], std::byte{'C'});
+    EXPECT_EQ(bytes[2], std::byte{cn::wire_version});
+
+    const auto ints = cn::describe<cn::stats::sum, cn::stats::max>(test_data::random<int>(100, 4));
+    EXPECT_TRUE(same_state(round_trip(ints), ints));
+}
+
+TEST(Serialize, SketchRoundTripAndMerge) {
+    const auto x = test_data::random<double>(50000, 5);
+    cn::accumulator<double, cn::stats::mean | cn::stats::quantiles> a(cn::ddsketch(0.005, 512));
+    a.push(std::span<const double>(x));
+    const auto r = round_trip(a);
+    EXPECT_EQ(r.sketch().relative_accuracy(), 0.005);
+    EXPECT_EQ(r.sketch().max_bins(), 512u);
+    for (double q : {0.0, 0.01, 0.5, 0.99, 1.0}) EXPECT_EQ(r.quantile(q), a.quantile(q)) << q;
+
+    // merge_serialized suma los cubos desde el buffer y da lo mismo que merge().
+    const auto y = test_data::random<double>(7000, 6);
+    decltype(a) b(cn::ddsketch(0.005, 512));
+    b.push(std::span<const double>(y));
+    auto merged = a;
+    merged.merge(b);
+    auto streamed = a;
+    const auto bytes = cn::serialize(b);
+    cn::merge_serialized(streamed, std::span<const std::byte>(bytes));
+    EXPECT_TRUE(same_state(streamed, merged));
+
+    cn::ddsketch s(0.01);
+    for (double v : y) s.push(v);
+    EXPECT_TRUE(same_state(round_trip(s), s));
+}
+
+TEST(Serialize, MergeSerializedMatchesMerge) {
+    const auto x = test_data::random<double>(3000, 7);
+    const auto y = test_data::random<double>(5000, 8);
+    auto a = cn::describe<all_stats>(x);
+    const auto b = cn::describe<all_stats>(y);
+    auto expected = a;
+    expected.merge(b);
+    const auto bytes = cn::serialize(b);
+    cn::merge_serialized(a, std::span<const std::byte>(bytes));
+    EXPECT_TRUE(same_state(a, expected));
+
+    std::vector<double> xy(x);
+    xy.insert(xy.end(), y.begin(), y.end());
+    EXPECT_NEAR(a.variance(), cn::variance(xy), 1e-9 * a.variance());
+}
+
+TEST(Serialize, RejectsForeignOrDamagedBuffers) {
+    const auto x = test_data::random<double>(100, 9);
+    const auto acc = cn::describe<cn::stats::mean, cn::stats::variance>(x);
+    auto bytes = cn::serialize(acc);
+    using Acc = std::remove_cvref_t<decltype(acc)>;
+
+    const std::span<const std::byte> all(bytes);
+    EXPECT_THROW(cn::deserialize<Acc>(all.first(bytes.size() - 1)), std::invalid_argument);
+    EXPECT_THROW(cn::deserialize<Acc>(all.first(3)), std::invalid_argument);
+    EXPECT_THROW((cn::deserialize<cn::accumulator<double, cn::stats::mean>>(all)), std::invalid_argument);
+    EXPECT_THROW((cn::deserialize<cn::accumulator<float, cn::stats::mean | cn::stats::variance>>(all)),
+                 std::invalid_argument);
+    EXPECT_THROW(cn::deserialize<cn::moments_state<double>>(all), std::invalid_argument);
+
+    auto longer = bytes;
+    longer.push_back(std::byte{0});
+    EXPECT_THROW(cn::deserialize<Acc>(std::span<const std::byte>(longer)), std::invalid_argument);
+
+    bytes[2] = std::byte{cn::wire_version + 1};
+    EXPECT_THROW(cn::deserialize<Acc>(std::span<const std::byte>(bytes)), std::invalid_argument);
+    bytes[0] = std::byte{'X'};
+    EXPECT_THROW(cn::deserialize<Acc>(std::span<const std::byte>(bytes)), std::invalid_argument);
+
+    std::vector<std::byte> tiny(3);
+    EXPECT_THROW(cn::serialize(acc, std::span<std::byte>(tiny)), std::invalid_argument);
+
+    auto other = cn::ddsketch(0.02);
+    other.push(1.0);
+    const auto sketch_bytes = cn::serialize(other);
+    cn::ddsketch mine(0.01);
+    EXPECT_THROW(cn::merge_serialized(mine, std::span<const std::byte>(sketch_bytes)), std::invalid_argument);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::stats;
+
+namespace {
+    double exact_quantile(std::vector<double> v, double q) {
+        const auto k = static_cast<std::size_t>(q * static_cast<double>(v.size() - 1));
+        std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end());
+        return v[k];
+    }
+
+    void expect_relative(double approx, double exact, double a) {
+        EXPECT_LE(std::abs(approx - exact), a * std::abs(exact) + 1e-300) << approx << " vs " << exact;
+    }
+}
+
+TEST(DDSketch, RelativeErrorBound) {
+    std::mt19937_64 g(7);
+    std::lognormal_distribution<double> d(0.0, 2.0);
+    std::vector<double> v(200000);
+    for (auto& x : v) x = d(g);
+
+    cn::ddsketch s(0.01);
+    s.push(v);
+    EXPECT_EQ(s.count(), v.size());
+    for (double q : {0.01, 0.25, 0.5, 0.9, 0.99, 0.999})
+        expect_relative(s.quantile(q), exact_quantile(v, q), 0.01);
+    EXPECT_EQ(s.quantile(0.0), *std::min_element(v.begin(), v.end()));
+    EXPECT_EQ(s.quantile(1.0), *std::max_element(v.begin(), v.end()));
+}
+
+TEST(DDSketch, NegativesAndZeros) {
+    auto v = test_data::random<double>(50001);
+    for (std::size_t i = 0; i < v.size(); i += 10) v[i] = 0.0;
+    cn::ddsketch s(0.02);
+    s.push(v);
+    for (double q : {0.05, 0.3, 0.5, 0.7, 0.95}) expect_relative(s.quantile(q), exact_quantile(v, q), 0.02);
+}
+
+TEST(DDSketch, MergeEqualsSinglePass) {
+    const auto v = test_data::random<double>(100000);
+    cn::ddsketch whole, a, b;
+    whole.push(v);
+    a.push(std::span<const double>(v).first(40000));
+    b.push(std::span<const double>(v).subspan(40000));
+    a.merge(b);
+    for (double q : {0.1, 0.5, 0.99}) EXPECT_EQ(a.quantile(q), whole.quantile(q));
+
+    EXPECT_THROW(a.merge(cn::ddsketch(0.05)), std::invalid_argument);
+    EXPECT_THROW(cn::ddsketch().quantile(0.5), std::invalid_argument);
+    EXPECT_THROW(whole.quantile(1.5), std::invalid_argument);
+}
+
+TEST(DDSketch, BoundedMemoryKeepsHighQuantiles) {
+    // 1e-6 .. 1e6 no cabe en 256 cubos al 1%: colapsan los valores pequenos.
+    std::vector<double> v;
+    for (int i = 0; i < 100000; ++i) v.push_back(std::pow(10.0, -6.0 + 12.0 * i / 99999.0));
+    cn::ddsketch s(0.01, 256);
+    s.push(v);
+    expect_relative(s.quantile(0.99), exact_quantile(v, 0.99), 0.01);
+    expect_relative(s.quantile(0.999), exact_quantile(v, 0.999), 0.01);
+}
+
+TEST(DDSketch, DescribeAccumulatorAndParallel) {
+    const auto v = test_data::random<double>(300007);
+    const auto d = cn::describe<stats::mean, stats::variance, stats::max, stats::quantiles>(v);
+    EXPECT_EQ(d.variance(), cn::variance(v));
+    EXPECT_EQ(d.max(), cn::max(v));
+    for (double q : {0.5, 0.99, 0.999}) expect_relative(d.quantile(q), exact_quantile(v, q), 0.01);
+
+    const auto p = cn::describe<stats::quantiles>(cn::execution::par.on(4), v);
+    EXPECT_EQ(p.count(), v.size());
+    for (double q : {0.5, 0.99}) EXPECT_EQ(p.quantile(q), d.quantile(q));
+
+    cn::accumulator<int, stats::quantiles> ints{cn::ddsketch(0.001)};
+    for (int i = 1; i <= 1000; ++i) ints.push(i);
+    EXPECT_NEAR(ints.median(), 500, 0.5);
+
+    const auto s = cn::reduce_stream<stats::quantiles>(cn::span_source<double>(v), {4096, 2});
+    EXPECT_EQ(s.quantile(0.99), d.quantile(0.99));
+}
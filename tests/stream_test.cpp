@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+using cn::stats;
+
+TEST(ReduceStream, MatchesDescribeOnTheSameData) {
+    const auto v = test_data::random<double>(300007);
+    // Bloques multiplo de moments_block: la particion coincide con describe.
+    const auto s = cn::reduce_stream<stats::mean, stats::variance, stats::max>(
+        cn::span_source<double>(v), {cn::simd::moments_block * 8, 2});
+    const auto d = cn::describe<stats::mean, stats::variance, stats::max>(v);
+
+    EXPECT_EQ(s.count(), v.size());
+    EXPECT_EQ(s.variance(), d.variance());
+    EXPECT_EQ(s.max(), d.max());
+    EXPECT_NEAR(s.mean(), d.mean(), 1e-12);
+}
+
+TEST(ReduceStream, SmallChunksAndManyBuffers) {
+    const auto v = test_data::random<int>(10001);
+    const auto s = cn::reduce_stream<stats::sum, stats::min, stats::max>(cn::span_source<int>(v), {7, 5});
+    EXPECT_EQ(s.sum(), cn::sum(v));
+    EXPECT_EQ(s.max(), cn::max(v));
+}
+
+TEST(ReduceStream, FileSource) {
+    const auto v = test_data::random<double>(50000);
+    const auto path = std::filesystem::temp_directory_path() / "core_numeric_stream.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(double)));
+    }
+    const auto s = cn::reduce_stream<stats::variance>(cn::file_source<double>(path.string()), {4096, 3});
+    EXPECT_NEAR(s.variance(), cn::variance(v), 1e-9 * cn::variance(v));
+    std::filesystem::remove(path);
+}
+
+TEST(ReduceStream, ErrorsPropagateFromTheReaderThread) {
+    EXPECT_THROW(cn::file_source<double>("/nonexistent/core_numeric.bin"), std::system_error);
+
+    const auto path = std::filesystem::temp_directory_path() / "core_numeric_stream_odd.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write("12345678abc", 11);
+    }
+    EXPECT_THROW(cn::reduce_stream<stats::sum>(cn::file_source<double>(path.string())), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(ReduceStream, EmptySource) {
+    const std::vector<double> v;
+    const auto s = cn::reduce_stream<stats::count, stats::sum>(cn::span_source<double>(v));
+    EXPECT_EQ(s.count(), 0u);
+    EXPECT_EQ(s.sum(), 0.0);
+}
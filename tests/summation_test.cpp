@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    std::vector<double> one_and_tiny() {
+        std::vector<double> v(1000001, 1e-16);
+        v[0] = 1.0;
+        return v;
+    }
+}
+
+TEST(Summation, CompensatedTiersRecoverSmallTerms) {
+    const auto v = one_and_tiny();
+    const double exact = 1.0 + 1e-10;
+    EXPECT_NEAR(cn::sum<cn::summation::kahan>(v), exact, 1e-16);
+    EXPECT_NEAR(cn::sum<cn::summation::pairwise>(v), exact, 1e-13);
+    // blocked suma cada bloque de 1024 con el kernel SIMD activo: cota de la
+    // suma ingenua del bloque mas la cascada, igual para cualquier ISA.
+    const double eps = std::numeric_limits<double>::epsilon();
+    EXPECT_NEAR(cn::sum<cn::summation::blocked>(v), exact, (1024 + 64) * eps * exact);
+}
+
+TEST(Summation, NaiveIsTheDefaultSum) {
+    const std::vector<double> v{1.5, 2.0, 0.5};
+    EXPECT_EQ(cn::sum<cn::summation::naive>(v), cn::sum(v));
+    EXPECT_EQ(cn::variance<cn::summation::naive>(v), cn::variance(v));
+}
+
+TEST(Summation, PolicyAppliesToMeanVarianceAndTransformReduce) {
+    const std::vector<double> w{1e9 + 1, 1e9 + 2, 1e9 + 3, 1e9 + 4};
+    EXPECT_DOUBLE_EQ(cn::mean<cn::summation::kahan>(w), 1e9 + 2.5);
+    EXPECT_DOUBLE_EQ(cn::variance<cn::summation::kahan>(w), 1.25);
+    EXPECT_DOUBLE_EQ(cn::transform_reduce<cn::summation::pairwise>(std::vector<double>{1, 2, 3},
+                                                                   [](double x) { return x * x; }), 14.0);
+}
+
+TEST(Summation, IntegersIgnoreThePolicy) {
+    const std::vector<int> v{1, 2, 3, 4};
+    EXPECT_EQ(cn::sum<cn::summation::kahan>(v), 10);
+    EXPECT_EQ(cn::mean<cn::summation::pairwise>(v), 2);
+}
@@ -0,0 +1,30 @@
+#ifndef CORE_NUMERIC_TESTS_TEST_DATA_H
+#define CORE_NUMERIC_TESTS_TEST_DATA_H
+
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace test_data {
+
+    // Datos pseudoaleatorios reproducibles en [-1000, 1000].
+    template<typename T>
+    std::vector<T> random(std::size_t n, unsigned seed = 42) {
+        std::mt19937_64 g(seed);
+        std::vector<T> v(n);
+        if constexpr (std::is_floating_point_v<T>) {
+            std::uniform_real_distribution<T> d(T(-1000), T(1000));
+            for (auto& x : v) x = d(g);
+        } else {
+            std::uniform_int_distribution<T> d(-1000, 1000);
+            for (auto& x : v) x = d(g);
+        }
+        return v;
+    }
+
+    // Tamanos alrededor de los anchos de carril y de los bloques internos.
+    inline const std::vector<std::size_t> sizes{1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1000, 2047, 2048, 2049, 10007};
+}
+
+#endif // CORE_NUMERIC_TESTS_TEST_DATA_H
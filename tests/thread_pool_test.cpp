@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+TEST(ThreadPool, RunsEveryIndexOnce) {
+    cn::thread_pool pool({4});
+    EXPECT_EQ(pool.size(), 4u);
+    for (std::size_t n : {1u, 2u, 3u, 17u, 1000u, 5000u}) {
+        std::vector<std::atomic<int>> hits(n);
+        pool.parallel_for(n, [&](std::size_t i) { hits[i].fetch_add(1); });
+        for (std::size_t i = 0; i < n; ++i) ASSERT_EQ(hits[i].load(), 1) << "n=" << n << " i=" << i;
+    }
+}
+
+TEST(ThreadPool, NestedAndSingleThreaded) {
+    cn::thread_pool pool({3});
+    std::atomic<int> total{0};
+    pool.parallel_for(8, [&](std::size_t) {
+        pool.parallel_for(8, [&](std::size_t) { total.fetch_add(1); });
+    });
+    EXPECT_EQ(total.load(), 64);
+
+    cn::thread_pool one({1});
+    int serial = 0;
+    one.parallel_for(10, [&](std::size_t i) { serial += static_cast<int>(i); });
+    EXPECT_EQ(serial, 45);
+}
+
+TEST(ThreadPool, PropagatesExceptions) {
+    cn::thread_pool pool({4});
+    EXPECT_THROW(pool.parallel_for(100, [](std::size_t i) {
+        if (i == 37) throw std::runtime_error("boom");
+    }), std::runtime_error);
+
+    // El pool sigue utilizable tras el error.
+    std::atomic<int> n{0};
+    pool.parallel_for(10, [&](std::size_t) { n.fetch_add(1); });
+    EXPECT_EQ(n.load(), 10);
+}
+
+TEST(ThreadPool, PoliciesShareThePool) {
+    cn::thread_pool pool({4});
+    const auto v = test_data::random<double>(500009);
+    const auto par = cn::execution::par.on(4).with(pool);
+
+    const double a = cn::variance(par, v);
+    for (int k = 0; k < 5; ++k) EXPECT_EQ(cn::variance(par, v), a);
+    EXPECT_NEAR(a, cn::variance(v), 1e-9 * a);
+    EXPECT_EQ(cn::max(par, v), cn::max(v));
+}
+
+TEST(ThreadPool, SequentialCutoffMatchesSerial) {
+    const auto v = test_data::random<double>(50000);
+    const auto small = cn::execution::par.on(8);
+    EXPECT_EQ(cn::sum(small, v), cn::sum(v));
+    EXPECT_EQ(cn::variance(small, v), cn::variance(v));
+}
+
+TEST(ThreadPool, BatchedMatrixPaths) {
+    cn::thread_pool pool({4});
+    const std::size_t rows = 300, cols = 1500;
+    const auto v = test_data::random<float>(rows * cols);
+    const cn::matrix_view<float> m(v.data(), rows, cols);
+    const auto par = cn::execution::par.with(pool);
+
+    const auto a = cn::column_moments(par, m);
+    const auto b = cn::column_moments(m);
+    for (std::size_t j = 0; j < cols; ++j) ASSERT_EQ(a[j].m2, b[j].m2);
+
+    const auto r = cn::row_moments(par, m);
+    const auto s = cn::row_moments(m);
+    for (std::size_t i = 0; i < rows; ++i) ASSERT_EQ(r[i].m2, s[i].m2);
+}
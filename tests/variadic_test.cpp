@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+
+#include "core_numeric/core_numeric.h"
+
+namespace cn = core_numeric;
+
+TEST(Variadic, RuntimeValues) {
+    EXPECT_EQ(cn::sum_variadic(1, 2, 33, 4), 40);
+    EXPECT_DOUBLE_EQ(cn::sum_variadic(0.5, 1, 2.5), 4.0);
+    EXPECT_DOUBLE_EQ(cn::mean_variadic(0.1, 2, 3, 4), 2.275);
+    EXPECT_DOUBLE_EQ(cn::variance_variadic(1, 2, 3, 4), 1.25);
+    EXPECT_DOUBLE_EQ(cn::max_variadic(1, 2.7, 3, 4), 4.0);
+    EXPECT_EQ(cn::max_variadic(1, 2, 33, 4), 33);
+}
+
+TEST(Variadic, CompileTimeEvaluation) {
+    static_assert(cn::sum_variadic(1, 2, 33, 4) == 40);
+    static_assert(cn::mean_variadic(1, 2, 3, 4) == 2.5);
+    static_assert(cn::variance_variadic(1, 2, 3, 4) == 1.25);
+    static_assert(cn::max_variadic(1, 2, 33, 4) == 33);
+
+    constexpr auto m = cn::moments_variadic(1, 2, 3, 4);
+    static_assert(m.count == 4 && m.mean == 2.5 && m.min == 1 && m.max == 4);
+    EXPECT_DOUBLE_EQ(cn::variance(m), 1.25);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <list>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    struct record {
+        int id;
+        double price;
+        float weight;
+    };
+}
+
+TEST(Views, SpanAndSubrangeWithoutCopy) {
+    const auto v = test_data::random<double>(1000);
+    const std::span<const double> s(v.data() + 100, 500);
+    const std::vector<double> copy(v.begin() + 100, v.begin() + 600);
+
+    EXPECT_EQ(cn::sum(s), cn::sum(copy));
+    EXPECT_EQ(cn::max(s), cn::max(copy));
+    EXPECT_EQ(cn::variance(s), cn::variance(copy));
+    EXPECT_EQ(cn::sum(std::span<const double>(copy)), cn::sum(copy));
+}
+
+TEST(Views, StandardRangeViews) {
+    EXPECT_EQ(cn::sum(std::views::iota(1, 101)), 5050);
+    EXPECT_EQ(cn::max(std::views::iota(1, 101)), 100);
+    EXPECT_DOUBLE_EQ(cn::mean(std::array<double, 4>{1, 2, 3, 4}), 2.5);
+
+    const std::list<int> l{5, 1, 9, 3};
+    EXPECT_EQ(cn::max(l), 9);  // el camino generico ya no usa operator[]
+    EXPECT_EQ(cn::sum(l | std::views::take(2)), 6);
+}
+
+TEST(Views, StridedView) {
+    const auto v = test_data::random<double>(3 * 1001);
+    std::vector<double> every_third;
+    for (std::size_t i = 1; i < v.size(); i += 3) every_third.push_back(v[i]);
+
+    const auto s = cn::strided(v.data() + 1, every_third.size(), 3);
+    EXPECT_EQ(s.size(), every_third.size());
+    EXPECT_EQ(cn::sum(s), cn::sum(std::list<double>(every_third.begin(), every_third.end())));
+    EXPECT_EQ(cn::max(s), cn::max(every_third));
+    EXPECT_NEAR(cn::variance(s), cn::variance(every_third), 1e-9 * cn::variance(every_third));
+
+    // Paso negativo: recorrido inverso.
+    const auto r = cn::strided(v.data() + v.size() - 1, v.size(), -1);
+    EXPECT_EQ(cn::max(r), cn::max(v));
+
+    const auto par = cn::execution::par.on(3);
+    EXPECT_NEAR(cn::sum(par, s), cn::sum(s), 1e-9);
+}
+
+TEST(Views, Projections) {
+    std::vector<record> records;
+    for (int i = 0; i < 1000; ++i)
+        records.push_back({i, 0.5 * i, static_cast<float>(i % 7)});
+
+    EXPECT_DOUBLE_EQ(cn::sum(records, &record::price), 0.5 * 999 * 1000 / 2);
+    EXPECT_EQ(cn::max(records, &record::id), 999);
+    EXPECT_EQ(cn::max(records, &record::weight), 6.0f);
+    EXPECT_DOUBLE_EQ(cn::mean(records, [](const record& r) { return r.price * 2; }), 499.5);
+
+    std::vector<double> prices;
+    for (const auto& r : records) prices.push_back(r.price);
+    EXPECT_NEAR(cn::variance(records, &record::price), cn::variance(prices), 1e-9);
+
+    using cn::stats;
+    const auto d = cn::describe<stats::mean, stats::max>(records, &record::price);
+    EXPECT_DOUBLE_EQ(d.max(), 499.5);
+}
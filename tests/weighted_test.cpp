@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "core_numeric/core_numeric.h"
+#include "test_data.h"
+
+namespace cn = core_numeric;
+
+namespace {
+    // Pesos enteros repetidos: la referencia es el vector con cada x_i repetido w_i veces.
+    template<typename T>
+    std::vector<T> repeat(const std::vector<T>& x, const std::vector<T>& w) {
+        std::vector<T> out;
+        for (std::size_t i = 0; i < x.size(); ++i)
+            for (int k = 0; k < static_cast<int>(w[i]); ++k) out.push_back(x[i]);
+        return out;
+    }
+
+    std::vector<std::uint8_t> bits_of(const std::vector<bool>& keep) {
+        std::vector<std::uint8_t> bits((keep.size() + 7) / 8, 0);
+        for (std::size_t i = 0; i < keep.size(); ++i)
+            if (keep[i]) bits[i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+        return bits;
+    }
+}
+
+TEST(Weighted, FrequencyWeightsMatchRepetition) {
+    for (std::size_t n : test_data::sizes) {
+        const auto x = test_data::random<double>(n, 7);
+        std::vector<double> w(n);
+        for (std::size_t i = 0; i < n; ++i) w[i] = static_cast<double>(i % 4);
+        const auto rep = repeat(x, w);
+        if (rep.empty()) continue;
+
+        const double tol = 1e-9 * static_cast<double>(n);
+        EXPECT_NEAR(cn::weighted_sum(x, w), cn::sum(rep), tol * 1000.0) << n;
+        EXPECT_NEAR(cn::weighted_mean(x, w), cn::mean(rep), tol) << n;
+        EXPECT_NEAR(cn::weighted_variance(x, w), cn::variance(rep), tol * cn::variance(rep) + 1e-9) << n;
+        EXPECT_EQ(cn::weighted_max(x, w), cn::max(rep)) << n;
+    }
+}
+
+TEST(Weighted, FloatAndMixedTypes) {
+    const auto x = test_data::random<float>(3001, 8);
+    std::vector<float> w(x.size(), 0.5f);
+    EXPECT_NEAR(cn::weighted_mean(x, w), cn::mean(x), 1e-6);
+    EXPECT_NEAR(cn::weighted_variance(x, w), cn::variance(x), 1e-6 * cn::variance(x));
+
+    const std::vector<int> xi{1, 2, 3, 4};
+    const std::vector<double> wi{1.0, 0.0, 0.0, 1.0};
+    EXPECT_DOUBLE_EQ(cn::weighted_mean(xi, wi), 2.5);
+    EXPECT_EQ(cn::weighted_max(xi, wi), 4);
+
+    EXPECT_TRUE(std::isnan(cn::weighted_mean(xi, std::vector<double>(4, 0.0))));
+    EXPECT_THROW(cn::weighted_max(xi, std::vector<double>(4, 0.0)), std::invalid_argument);
+    EXPECT_THROW(cn::weighted_sum(xi, std::vector<double>(3, 1.0)), std::invalid_argument);
+}
+
+TEST(Masked, MatchesCompactedCopy) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t n : test_data::sizes) {
+        auto x = test_data::random<double>(n, 9);
+        std::vector<bool> keep(n);
+        std::vector<double> kept;
+        for (std::size_t i = 0; i < n; ++i) {
+            keep[i] = i % 5 != 1;
+            if (keep[i]) kept.push_back(x[i]);
+            else x[i] = nan;
+        }
+        const auto bits = bits_of(keep);
+        if (kept.empty()) continue;
+
+        EXPECT_NEAR(cn::masked_sum(x, bits), cn::sum(kept), 1e-9 * static_cast<double>(n) * 1000.0) << n;
+        EXPECT_NEAR(cn::masked_mean(x, bits), cn::mean(kept), 1e-9 * static_cast<double>(n)) << n;
+        EXPECT_NEAR(cn::masked_variance(x, bits), cn::variance(kept), 1e-9 * cn::variance(kept) + 1e-9) << n;
+        EXPECT_EQ(cn::masked_max(x, bits), cn::max(kept)) << n;
+        EXPECT_EQ(cn::masked_moments(x, bits).count, kept.size()) << n;
+    }
+}
+
+TEST(Masked, FloatAndIntegers) {
+    const auto f = test_data::random<float>(1000, 10);
+    const auto v = test_data::random<int>(1000, 11);
+    std::vector<bool> keep(v.size());
+    std::vector<float> fk;
+    std::vector<int> vk;
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        keep[i] = v[i] > 0;
+        if (keep[i]) {
+            fk.push_back(f[i]);
+            vk.push_back(v[i]);
+        }
+    }
+    const auto bits = bits_of(keep);
+    EXPECT_EQ(cn::masked_max(f, bits), cn::max(fk));
+    EXPECT_NEAR(cn::masked_mean(f, bits), cn::mean(fk), 1e-9);
+    EXPECT_EQ(cn::masked_sum(v, bits), cn::sum(vk));
+    EXPECT_EQ(cn::masked_mean(v, bits), cn::mean(vk));
+    EXPECT_EQ(cn::masked_max(v, bits), cn::max(vk));
+    EXPECT_NEAR(cn::masked_variance(v, bits), cn::variance(vk), 1e-9 * cn::variance(vk));
+
+    const std::vector<std::uint8_t> none(bits.size(), 0);
+    EXPECT_THROW(cn::masked_max(v, none), std::invalid_argument);
+    EXPECT_THROW(cn::masked_mean(v, none), std::invalid_argument);
+    EXPECT_TRUE(std::isnan(cn::masked_mean(f, none)));
+    EXPECT_THROW(cn::masked_sum(v, std::vector<std::uint8_t>(3)), std::invalid_argument);
+}
+
+TEST(Weighted, ParallelMatchesSerial) {
+    const std::size_t n = 1000003;
+    const auto x = test_data::random<double>(n, 12);
+    const auto w = test_data::random<double>(n, 13);
+    std::vector<double> aw(n);
+    std::vector<bool> keep(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        aw[i] = std::abs(w[i]);
+        keep[i] = w[i] > 0.0;
+    }
+    const auto bits = bits_of(keep);
+    const auto par = cn::execution::par.on(4);
+
+    EXPECT_NEAR(cn::weighted_sum(par, x, aw), cn::weighted_sum(x, aw), 1e-6 * std::abs(cn::weighted_sum(x, aw)));
+    EXPECT_NEAR(cn::weighted_mean(par, x, aw), cn::weighted_mean(x, aw), 1e-9);
+    EXPECT_NEAR(cn::weighted_variance(par, x, aw), cn::weighted_variance(x, aw), 1e-9 * cn::weighted_variance(x, aw));
+    EXPECT_EQ(cn::weighted_max(par, x, aw), cn::weighted_max(x, aw));
+
+    EXPECT_NEAR(cn::masked_sum(par, x, bits), cn::masked_sum(x, bits), 1e-6 * std::abs(cn::masked_sum(x, bits)));
+    EXPECT_NEAR(cn::masked_mean(par, x, bits), cn::masked_mean(x, bits), 1e-9);
+    EXPECT_NEAR(cn::masked_variance(par, x, bits), cn::masked_variance(x, bits), 1e-9 * cn::masked_variance(x, bits));
+    EXPECT_EQ(cn::masked_max(par, x, bits), cn::masked_max(x, bits));
+    EXPECT_EQ(cn::masked_moments(par, x, bits).count, cn::masked_moments(x, bits).count);
+}